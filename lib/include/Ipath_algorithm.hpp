@@ -4,6 +4,7 @@
 #include "matrix_utils.hpp"
 #include "path.hpp"
 #include "performance_measure.hpp"
+#include <atomic>
 #include <string>
 
 // Type-safe structures for clarity and error avoidance
@@ -42,8 +43,37 @@ struct MaxStartingPoints
  */
 class PathAlgorithm : public PerformanceMeasure
 {
+protected:
+    /**
+     * @brief Non-owning pointer to an external cancellation flag (may be null)
+     *
+     * Set by callers that race or supervise engines. Implementations poll it
+     * through isCancelled() and return an empty path once it is raised.
+     */
+    const std::atomic<bool> *cancellationFlag = nullptr;
+
+    /**
+     * @brief Checks whether the caller requested cancellation
+     * @return true if a cancellation flag is attached and raised
+     */
+    [[nodiscard]] bool isCancelled() const
+    {
+        return cancellationFlag != nullptr && cancellationFlag->load(std::memory_order_relaxed);
+    }
+
 public:
     virtual ~PathAlgorithm() = default;
+
+    /**
+     * @brief Attaches an external cancellation flag
+     * @param flag Flag polled during the search, nullptr to detach
+     *
+     * The flag must outlive every findViablePath() call made while attached.
+     */
+    void setCancellationFlag(const std::atomic<bool> *flag)
+    {
+        cancellationFlag = flag;
+    }
     
     /**
      * @brief Finds a viable path in the given matrix world
@@ -0,0 +1,144 @@
+/**
+ * @file algorithm_registry.hpp
+ * @brief Registry and factory of path finding algorithm implementations
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef ALGORITHM_REGISTRY_H
+#define ALGORITHM_REGISTRY_H
+
+#include "Ipath_algorithm.hpp"
+#include "world_statistics.hpp"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @struct AlgorithmDescriptor
+ * @brief Registration record of a single path finding engine
+ *
+ * Describes how to construct an engine and how the automatic selection should
+ * treat it. Engines without an applicability predicate (e.g. "auto" itself)
+ * can be created by name but are never picked by the automatic selection.
+ */
+struct AlgorithmDescriptor
+{
+    std::string name;        ///< Short identifier used on the command line (e.g. "dfs")
+    std::string description; ///< One-line human readable description
+    uint8_t costRank = 0;    ///< Relative cost, lower values are tried first in auto mode
+    bool isComplete = false; ///< True if an empty result proves that no path exists
+
+    /// Returns true if the engine is worth trying for the given world and length
+    std::function<bool(const WorldStatistics &, PathLength)> isApplicable;
+
+    /// Creates a fresh engine instance
+    std::function<std::unique_ptr<PathAlgorithm>()> factory;
+};
+
+/**
+ * @class AlgorithmRegistry
+ * @brief Process-wide registry of path finding engines selectable by name
+ *
+ * The built-in engines are registered explicitly in the constructor rather than
+ * through static self-registration, which the linker would silently drop from
+ * the static library. Additional engines can be registered at runtime.
+ *
+ * @note All methods are thread-safe
+ */
+class AlgorithmRegistry
+{
+private:
+    std::vector<AlgorithmDescriptor> descriptors; ///< Registered engines in registration order
+    std::array<std::map<std::string, uint32_t>, 3>
+        winCounts;                                ///< Portfolio wins per engine, per density class
+    mutable std::mutex registryMutex;             ///< Guards descriptors and winCounts
+
+    /**
+     * @brief Buckets a world into a coarse density class for win bookkeeping
+     * @param stats World statistics
+     * @return 0 for open worlds, 1 for mixed, 2 for cluttered
+     */
+    static size_t densityClass(const WorldStatistics &stats);
+
+    /**
+     * @brief Constructs the registry and registers the built-in engines
+     */
+    AlgorithmRegistry();
+
+public:
+    /**
+     * @brief Gets the process-wide registry instance
+     * @return Reference to the singleton registry
+     */
+    static AlgorithmRegistry &instance();
+
+    AlgorithmRegistry(const AlgorithmRegistry &) = delete;
+    AlgorithmRegistry &operator=(const AlgorithmRegistry &) = delete;
+
+    /**
+     * @brief Registers a new engine or replaces an existing one with the same name
+     * @param descriptor Engine registration record
+     * @throws std::invalid_argument If the name is empty or the factory is missing
+     */
+    void registerAlgorithm(AlgorithmDescriptor descriptor);
+
+    /**
+     * @brief Creates an engine instance by name
+     * @param name Short engine identifier (e.g. "dfs", "auto")
+     * @return Newly created engine
+     * @throws std::invalid_argument If no engine with this name is registered
+     */
+    [[nodiscard]] std::unique_ptr<PathAlgorithm> create(const std::string &name) const;
+
+    /**
+     * @brief Checks whether an engine with the given name is registered
+     * @param name Short engine identifier
+     * @return true if registered, false otherwise
+     */
+    [[nodiscard]] bool contains(const std::string &name) const;
+
+    /**
+     * @brief Gets a snapshot of all registration records
+     * @return Copy of the descriptors in registration order
+     */
+    [[nodiscard]] std::vector<AlgorithmDescriptor> getDescriptors() const;
+
+    /**
+     * @brief Ranks the engines applicable to a query, cheapest first
+     * @param stats Statistics of the world to be searched
+     * @param pathLength Requested path length
+     * @return Applicable descriptors, most frequent portfolio winners first
+     *
+     * Engines are ordered by recorded wins on worlds of the same density class
+     * (descending), then by costRank (ascending). Without any recorded races
+     * this is plain cost order. Ranking is stable, so ties keep registration order.
+     */
+    [[nodiscard]] std::vector<AlgorithmDescriptor> selectEngines(const WorldStatistics &stats,
+                                                                 PathLength pathLength) const;
+
+    /**
+     * @brief Records that an engine won a race on a world
+     * @param name Registry name of the winning engine
+     * @param stats Statistics of the world the race ran on
+     *
+     * Feeds the learned part of the selectEngines() ordering.
+     */
+    void recordWin(const std::string &name, const WorldStatistics &stats);
+
+    /**
+     * @brief Gets the number of recorded wins of an engine on similar worlds
+     * @param name Registry name of the engine
+     * @param stats Statistics selecting the density class
+     * @return Number of recorded wins
+     */
+    [[nodiscard]] uint32_t getWinCount(const std::string &name, const WorldStatistics &stats) const;
+};
+
+#endif
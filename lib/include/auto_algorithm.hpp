@@ -0,0 +1,60 @@
+/**
+ * @file auto_algorithm.hpp
+ * @brief Automatic engine selection based on world statistics
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef AUTO_ALGORITHM_H
+#define AUTO_ALGORITHM_H
+
+#include "Ipath_algorithm.hpp"
+#include "matrix_utils.hpp"
+#include "path.hpp"
+#include <string>
+
+/**
+ * @class AutoSelectAlgorithm
+ * @brief Meta algorithm that picks registered engines from cheap world statistics
+ *
+ * Computes WorldStatistics once, asks the AlgorithmRegistry for the engines
+ * applicable to the query and runs them cheapest first. The first non-empty
+ * path is returned. An empty result of a complete engine ends the search,
+ * because no other engine can do better.
+ */
+class AutoSelectAlgorithm : public PathAlgorithm
+{
+private:
+    std::string lastSelectedEngine; ///< Name of the engine that produced the last result
+
+public:
+    /**
+     * @brief Finds a viable path using the cheapest engine likely to succeed
+     * @param matrixWorld Reference to the matrix world
+     * @param pathLength Target path length wrapped in PathLength struct
+     * @param maxStartingPoints Maximum starting points forwarded to the engines
+     * @return Path object containing the found path (empty if none found)
+     * @throws std::invalid_argument If pathLength.value is zero or exceeds matrix size
+     */
+    [[nodiscard]] Path findViablePath(const MatrixWorld &matrixWorld,
+                                      PathLength pathLength,
+                                      MaxStartingPoints maxStartingPoints = {}) override;
+
+    /** @brief Returns the name of the algorithm */
+    [[nodiscard]] std::string getAlgorithmName() const override
+    {
+        return "Automatic Engine Selection";
+    }
+
+    /**
+     * @brief Gets the short name of the engine that ran last
+     * @return Registry name of the last engine tried, empty if none ran
+     */
+    [[nodiscard]] const std::string &getLastSelectedEngine() const
+    {
+        return lastSelectedEngine;
+    }
+};
+
+#endif
@@ -0,0 +1,187 @@
+/**
+ * @file batch_runner.hpp
+ * @brief Batch query mode: job files run on a thread pool over cached worlds
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#include "Ipath_algorithm.hpp"
+#include "candidate_ranking.hpp"
+#include "matrix_utils.hpp"
+#include "path.hpp"
+#include "result_output.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @struct BatchJob
+ * @brief One query of a job file
+ */
+struct BatchJob
+{
+    std::string world;                   ///< World reference, see loadWorldReference()
+    PathLength pathLength{0};            ///< Requested path length
+    std::string algorithm;               ///< Registry name of the engine
+    MaxStartingPoints maxStartingPoints; ///< Starting points limit
+    size_t lineNumber = 0;               ///< Line of the job in its file
+};
+
+/**
+ * @brief Outcome of a batch job
+ */
+enum class BatchStatus : uint8_t
+{
+    Found,      ///< A path was found
+    NotFound,   ///< The engine gave up without a path
+    Infeasible, ///< The feasibility bound proves no path exists
+    Failed      ///< The world or the engine could not be set up
+};
+
+/**
+ * @struct BatchResult
+ * @brief Result of a batch job
+ */
+struct BatchResult
+{
+    BatchStatus status = BatchStatus::NotFound; ///< Outcome
+    Path path;                                  ///< Found path (empty otherwise)
+    double micros = 0.0;                        ///< Search time, world loading excluded
+    std::string message;                        ///< Reason for Infeasible and Failed
+    uint16_t rows = 0;                          ///< World rows (0 if the world failed to load)
+    uint16_t cols = 0;                          ///< World columns
+    size_t blockedCells = 0;                    ///< Blocked cells of the world
+
+    /// Counters of the search with --enableMeasurement (std::nullopt otherwise)
+    std::optional<PerformanceMeasure::Measures> counters;
+};
+
+/**
+ * @struct CachedWorld
+ * @brief World shared by all jobs referencing it, with its per-world indexes
+ */
+struct CachedWorld
+{
+    MatrixWorld world;                               ///< Decoded world, never mutated
+    uint32_t feasibilityBound{};                     ///< checkPathFeasibility() upper bound of the world
+    size_t blockedCells{};                           ///< countBlockedCells() of the world
+    std::shared_ptr<const CandidateRanking> ranking; ///< Unpruned ranking the path service patches (null in batches)
+};
+
+/**
+ * @brief Wraps a world with its per-world indexes
+ * @param world World to share
+ * @return Cached world, feasibility bound and blocked cells computed once
+ */
+[[nodiscard]] std::shared_ptr<CachedWorld> makeCachedWorld(MatrixWorld world);
+
+/**
+ * @brief Builds the world a job refers to
+ * @param reference "RxC" for an open world of R rows and C columns (e.g.
+ *        "100x80"), a MovingAI ".map" file, or a ".pbm"/".pgm" image
+ * @return Decoded world
+ * @throws std::runtime_error If a file cannot be opened or mapped
+ * @throws std::invalid_argument If the reference is not recognised or the file is malformed
+ */
+[[nodiscard]] MatrixWorld loadWorldReference(const std::string &reference);
+
+/**
+ * @class WorldCache
+ * @brief Thread-safe cache of worlds by reference, each loaded once
+ *
+ * The first job asking for a reference loads it; concurrent jobs asking for
+ * the same reference wait for that load instead of repeating it. Cached
+ * worlds are never mutated, so their versions stay fixed and the shared
+ * version-keyed indexes (candidate rankings, CSR graphs) are reused by every
+ * job on the same world.
+ */
+class WorldCache
+{
+    std::mutex cacheMutex;                                                          ///< Guards worlds
+    std::map<std::string, std::shared_future<std::shared_ptr<const CachedWorld>>> worlds; ///< Loads by reference
+
+public:
+    /**
+     * @brief Returns the cached world, loading it on first use
+     * @param reference World reference
+     * @return Shared world
+     * @throws Whatever loadWorldReference() threw for this reference (rethrown to every caller)
+     */
+    [[nodiscard]] std::shared_ptr<const CachedWorld> get(const std::string &reference);
+
+    /**
+     * @brief Gets the number of references seen so far
+     */
+    [[nodiscard]] size_t size();
+};
+
+/**
+ * @brief Parses a job file
+ * @param text File contents: one job per line, "WORLD PATH_LENGTH [ALGORITHM
+ *        [MAX_STARTING_POINTS]]" separated by blanks, # comments
+ * @param defaultAlgorithm Engine of jobs without an ALGORITHM field
+ * @param defaultMaxStartingPoints Limit of jobs without a MAX_STARTING_POINTS field
+ * @return Jobs in file order
+ * @throws std::invalid_argument If a line is malformed; the message names the line number
+ */
+[[nodiscard]] std::vector<BatchJob> loadBatchJobs(std::string_view text, const std::string &defaultAlgorithm,
+                                                  MaxStartingPoints defaultMaxStartingPoints);
+
+/**
+ * @brief Loads a job file
+ * @param filePath Path of the job file
+ * @param defaultAlgorithm Engine of jobs without an ALGORITHM field
+ * @param defaultMaxStartingPoints Limit of jobs without a MAX_STARTING_POINTS field
+ * @return Jobs in file order
+ * @throws std::runtime_error If the file cannot be opened or mapped
+ * @throws std::invalid_argument If a line is malformed
+ */
+[[nodiscard]] std::vector<BatchJob> loadBatchJobFile(const std::string &filePath, const std::string &defaultAlgorithm,
+                                                     MaxStartingPoints defaultMaxStartingPoints);
+
+/**
+ * @brief Runs jobs on a thread pool and reports results in submission order
+ * @param jobs Jobs to run
+ * @param threadCount Worker threads (0 = hardware concurrency)
+ * @param onResult Called on the calling thread with (job index, result), in
+ *        job order, as soon as a job and all jobs before it are done
+ *
+ * Workers claim jobs from a shared counter. Each worker keeps one engine
+ * instance per algorithm name; worlds come from one WorldCache shared by all
+ * workers. Jobs above the cached feasibility bound of their world are
+ * answered without a search. A job whose world or engine cannot be set up
+ * is reported as BatchStatus::Failed; the batch continues.
+ */
+void runBatch(const std::vector<BatchJob> &jobs, unsigned threadCount,
+              const std::function<void(size_t, const BatchResult &)> &onResult);
+
+/**
+ * @brief Prints one batch result line
+ * @param index Job index
+ * @param job Job the result belongs to
+ * @param result Job result
+ */
+void printBatchResult(size_t index, const BatchJob &job, const BatchResult &result);
+
+/**
+ * @brief Converts a batch result to a machine-readable record
+ * @param index Job index
+ * @param job Job the result belongs to
+ * @param result Job result
+ * @return Record with the search time as its only timing
+ */
+[[nodiscard]] QueryRecord makeBatchRecord(size_t index, const BatchJob &job, const BatchResult &result);
+
+#endif
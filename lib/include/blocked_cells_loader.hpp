@@ -0,0 +1,70 @@
+/**
+ * @file blocked_cells_loader.hpp
+ * @brief Parallel memory-mapped loader of blocked cell files
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef BLOCKED_CELLS_LOADER_H
+#define BLOCKED_CELLS_LOADER_H
+
+#include "matrix_utils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Blocks the cells listed in a blocked cells file
+ * @param filePath Path of the file (one row,col per line, # comments)
+ * @param matrixWorld World to block the cells in
+ * @param threadCount Number of parser threads (0 = hardware concurrency)
+ * @return Number of cell lines read (cells listed twice count twice)
+ * @throws std::runtime_error If the file cannot be opened or mapped
+ * @throws std::invalid_argument If a line is malformed or a cell lies
+ *         outside the world; the message names the line number
+ *
+ * The file is mmap()ed and split at newline boundaries into chunks that are
+ * parsed concurrently with std::from_chars. Cells go straight into a packed
+ * bitmap in the world's row layout, merged with one matrixBlankingMask()
+ * call - no coordinate list is built. Small files are parsed on the calling
+ * thread only.
+ */
+size_t loadBlockedCellsFile(const std::string &filePath, MatrixWorld &matrixWorld, unsigned threadCount = 0);
+
+/**
+ * @brief Blocks the cells listed in an in-memory blocked cells text
+ * @param text File contents
+ * @param matrixWorld World to block the cells in
+ * @param threadCount Number of parser threads (0 = hardware concurrency)
+ * @return Number of cell lines read
+ * @throws std::invalid_argument If a line is malformed or a cell lies outside the world
+ *
+ * Parsing backend of loadBlockedCellsFile().
+ */
+size_t loadBlockedCells(std::string_view text, MatrixWorld &matrixWorld, unsigned threadCount = 0);
+
+/**
+ * @brief Outcome of parseBlockedCellLine()
+ */
+enum class CellLine : uint8_t
+{
+    Skipped,  ///< Empty or comment line
+    Cell,     ///< row and col were parsed
+    Malformed ///< Not a row,col line
+};
+
+/**
+ * @brief Parses one line of a blocked cells text
+ * @param first First character of the line
+ * @param last End of the line (newline excluded, a trailing carriage return is ignored)
+ * @param row Parsed row (valid for CellLine::Cell)
+ * @param col Parsed column (valid for CellLine::Cell)
+ * @return Whether the line held a cell, was skipped or is malformed
+ *
+ * Blanks around the numbers are allowed; bounds are left to the caller.
+ */
+[[nodiscard]] CellLine parseBlockedCellLine(const char *first, const char *last, uint32_t &row, uint32_t &col);
+
+#endif
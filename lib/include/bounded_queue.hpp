@@ -0,0 +1,113 @@
+/**
+ * @file bounded_queue.hpp
+ * @brief Blocking fixed-capacity queue linking pipeline stages
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+/**
+ * @class BoundedQueue
+ * @brief First-in first-out queue of at most a fixed number of items
+ * @tparam Item Queued type, moved in and out
+ *
+ * push() blocks while the queue is full, so a fast producer cannot run
+ * ahead of a slow consumer by more than the capacity (backpressure). close()
+ * ends the stream: pending items can still be popped, further pushes are
+ * refused and waiting threads are woken. Either side may close, which is how
+ * a failing stage stops its neighbours.
+ */
+template <typename Item>
+class BoundedQueue
+{
+private:
+    std::mutex queueMutex;              ///< Guards items and closed
+    std::condition_variable notFull;    ///< Signalled when an item is popped or the queue closes
+    std::condition_variable notEmpty;   ///< Signalled when an item is pushed or the queue closes
+    std::deque<Item> items;             ///< Queued items, oldest first
+    size_t capacity;                    ///< Maximum number of queued items
+    bool closed = false;                ///< Whether close() was called
+
+public:
+    /**
+     * @brief Creates an empty open queue
+     * @param capacity Maximum number of queued items (at least 1)
+     */
+    explicit BoundedQueue(size_t capacity) : capacity(capacity == 0 ? 1 : capacity) {}
+
+    /**
+     * @brief Appends an item, waiting while the queue is full
+     * @param item Item to append
+     * @return false if the queue was closed (the item is dropped)
+     */
+    bool push(Item item)
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        notFull.wait(lock, [this] { return closed || items.size() < capacity; });
+        if (closed)
+        {
+            return false;
+        }
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Appends an item unless the queue is full or closed
+     * @param item Item to append
+     * @return Whether the item was queued
+     */
+    bool tryPush(Item item)
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (closed || items.size() >= capacity)
+        {
+            return false;
+        }
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Removes the oldest item, waiting while the queue is empty and open
+     * @param item Receives the removed item
+     * @return false once the queue is closed and drained
+     */
+    bool pop(Item &item)
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        notEmpty.wait(lock, [this] { return closed || !items.empty(); });
+        if (items.empty())
+        {
+            return false;
+        }
+        item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Ends the stream and wakes every waiting thread
+     */
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        closed = true;
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+};
+
+#endif
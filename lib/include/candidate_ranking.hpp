@@ -0,0 +1,380 @@
+/**
+ * @file candidate_ranking.hpp
+ * @brief Bucket-sorted ranking of starting point candidates
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef CANDIDATE_RANKING_H
+#define CANDIDATE_RANKING_H
+
+#include "matrix_utils.hpp"
+#include "start_scoring.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * @enum StartPruning
+ * @brief Candidates left out of a ranking as redundant
+ */
+enum class StartPruning : uint8_t
+{
+    None,    ///< Rank every free cell
+    Symmetry ///< Rank one representative per orbit of the world's symmetries
+};
+
+/**
+ * @class DegreeScores
+ * @brief Neighbour counts of a world's cells, scored band by band in row order
+ *
+ * The first pass of a ranking build, split out so a loader can score rows
+ * as soon as they and their neighbours are final (see loadWorldPipelined)
+ * and the ranking then skips its own scan (see CandidateRanking::getPrescored).
+ * Bands are appended in row order and must together cover every row exactly
+ * once; the rows being scored, plus the row below, must not change anymore.
+ */
+class DegreeScores
+{
+public:
+    /**
+     * @brief Prepares the scores of a world of the given dimensions, no row scored yet
+     * @param matrixWorld World to score
+     */
+    explicit DegreeScores(const MatrixWorld &matrixWorld);
+
+    /**
+     * @brief Scores the next band of rows, from getScoredRows() up to lastRow
+     * @param matrixWorld World to score (same dimensions as at construction)
+     * @param lastRow One past the last row of the band (at most getColSize())
+     * @throws std::invalid_argument If lastRow is past the last row or the dimensions differ
+     *
+     * Does nothing if lastRow is not past getScoredRows().
+     */
+    void scoreRows(const MatrixWorld &matrixWorld, uint16_t lastRow);
+
+    /** @brief Returns the number of rows scored so far, from row 0 */
+    [[nodiscard]] uint16_t getScoredRows() const { return scoredRows; }
+
+    /** @brief Checks whether every row is scored */
+    [[nodiscard]] bool isComplete() const { return scoredRows == rows; }
+
+private:
+    friend class CandidateRanking;
+
+    uint16_t rows;                                  ///< Matrix row count
+    uint16_t cols;                                  ///< Matrix column count
+    uint16_t scoredRows = 0;                        ///< Rows scored so far
+    std::vector<uint8_t> degrees;                   ///< Score byte per cell, MAX_SCORE + 1 if blocked
+    std::vector<uint16_t> bandFirstRow;             ///< First row of each band, then scoredRows
+    std::vector<std::vector<size_t>> bandCounts;    ///< Cells per score of each band
+};
+
+/**
+ * @class CandidateRanking
+ * @brief Free cells ordered by score, best first
+ *
+ * By default the score is the unblocked neighbour count (0-4); weighted
+ * criteria (see StartScoringWeights) widen it to 0-getMaxScore(). Scores are
+ * small integers either way, so the ranking is a counting sort into one
+ * bucket per score, stored back to back in one flat array of packed linear
+ * indices (row × cols + col).
+ * Building is O(N×M): scores come from a word-parallel scan of the packed
+ * rows, split into row bands over several threads on large worlds; reading
+ * the next candidate is O(1). Within a bucket cells keep row-major order,
+ * so the ranking is fully deterministic.
+ *
+ * A ranking is immutable; getShared() lets every query on the same world
+ * version reuse one instance, each query keeping its own cursor. After a few
+ * cells change, getPatched() derives the next version's ranking from the
+ * previous one without rescoring the world.
+ *
+ * With StartPruning::Symmetry, cells equivalent under a mirror or rotation
+ * of the world (see detectSymmetries) are ranked once: only the orbit member
+ * with the smallest index stays. The best cell of every bucket is such a
+ * representative, so the first candidate does not change.
+ */
+class CandidateRanking
+{
+public:
+    /// Highest possible neighbour count score (4-directional neighbours)
+    static constexpr uint8_t MAX_SCORE = 4;
+
+    /**
+     * @brief Ranks the free cells of the given world
+     * @param matrixWorld World to rank
+     * @param weights Scoring criteria weights (default: neighbour count only)
+     * @param pruning Redundant candidates to leave out (default: none)
+     */
+    explicit CandidateRanking(const MatrixWorld &matrixWorld,
+                              const StartScoringWeights &weights = {},
+                              StartPruning pruning = StartPruning::None);
+
+    /**
+     * @brief Ranks the free cells of a world whose neighbour counts are already scored
+     * @param matrixWorld World to rank, unchanged since its rows were scored
+     * @param scores Complete neighbour counts of the world
+     * @param weights Scoring criteria weights (default: neighbour count only)
+     * @param pruning Redundant candidates to leave out (default: none)
+     * @throws std::invalid_argument If the scores are incomplete or their dimensions differ
+     */
+    CandidateRanking(const MatrixWorld &matrixWorld,
+                     DegreeScores scores,
+                     const StartScoringWeights &weights = {},
+                     StartPruning pruning = StartPruning::None);
+
+    /**
+     * @brief Patches a neighbour-count ranking after some cells changed state
+     * @param previous Ranking of the world before the changes (default weights, no pruning)
+     * @param matrixWorld World after the changes
+     * @param changedCells Cells whose state changed since previous was built
+     * @throws std::invalid_argument If previous uses other weights or pruning, its
+     *         dimensions differ from the world's or a cell is out of bounds
+     *
+     * Rescores only the changed cells and their neighbours, then merges them
+     * into the previous buckets: O(changes) scoring plus a linear copy.
+     */
+    CandidateRanking(const CandidateRanking &previous,
+                     const MatrixWorld &matrixWorld,
+                     const std::vector<std::pair<uint16_t, uint16_t>> &changedCells);
+
+    /**
+     * @brief Returns the ranking of the given world, building it only once per version and options
+     * @param matrixWorld World to rank
+     * @param weights Scoring criteria weights (default: neighbour count only)
+     * @param pruning Redundant candidates to leave out (default: none)
+     * @return Shared read-only ranking
+     */
+    [[nodiscard]] static std::shared_ptr<const CandidateRanking> getShared(const MatrixWorld &matrixWorld,
+                                                                           const StartScoringWeights &weights = {},
+                                                                           StartPruning pruning = StartPruning::None);
+
+    /**
+     * @brief Returns the ranking of the given world, built from prescored neighbour counts
+     * @param matrixWorld World to rank, unchanged since its rows were scored
+     * @param scores Complete neighbour counts of the world
+     * @param weights Scoring criteria weights (default: neighbour count only)
+     * @param pruning Redundant candidates to leave out (default: none)
+     * @return Shared read-only ranking, also returned by later getShared() calls
+     * @throws std::invalid_argument If the scores are incomplete or their dimensions differ
+     *
+     * Seeds the cache of getShared(), so the first query on a pipelined load
+     * finds its ranking ready. A ranking already cached for this version is
+     * returned as is.
+     */
+    [[nodiscard]] static std::shared_ptr<const CandidateRanking> getPrescored(
+        const MatrixWorld &matrixWorld,
+        DegreeScores scores,
+        const StartScoringWeights &weights = {},
+        StartPruning pruning = StartPruning::None);
+
+    /**
+     * @brief Returns the ranking of a mutated world, patched from a previous one
+     * @param matrixWorld World after the changes
+     * @param previous Unpruned ranking of the world before the changes
+     * @param changedCells Cells whose state changed since previous was built
+     * @param pruning Redundant candidates to leave out (default: none)
+     * @return Shared read-only ranking, also returned by later getShared() calls
+     *
+     * Neighbour-count rankings are patched and, when pruning is requested,
+     * pruned with the new world's symmetries; weighted rankings are rebuilt.
+     */
+    [[nodiscard]] static std::shared_ptr<const CandidateRanking> getPatched(
+        const MatrixWorld &matrixWorld,
+        const CandidateRanking &previous,
+        const std::vector<std::pair<uint16_t, uint16_t>> &changedCells,
+        StartPruning pruning = StartPruning::None);
+
+    /** @brief Returns the number of ranked (free) cells */
+    [[nodiscard]] size_t size() const { return order.size(); }
+
+    /**
+     * @brief Returns the packed linear index of the candidate at a rank
+     * @param rank Position in the ranking (0 = best)
+     */
+    [[nodiscard]] uint32_t getIndex(size_t rank) const { return order[rank]; }
+
+    /**
+     * @brief Returns the (row, col) of the candidate at a rank
+     * @param rank Position in the ranking (0 = best)
+     */
+    [[nodiscard]] std::pair<uint16_t, uint16_t> getCell(size_t rank) const { return getCellAt(order[rank]); }
+
+    /**
+     * @brief Returns the first rank of the bucket holding the given score
+     * @param score Score (0-getMaxScore())
+     *
+     * Bucket of score s spans [getBucketStart(s), getBucketStart(s) + bucket size);
+     * higher scores come first, so getBucketStart(getMaxScore()) == 0.
+     */
+    [[nodiscard]] size_t getBucketStart(uint16_t score) const { return bucketStart[maxScore - score]; }
+
+    /** @brief Returns the highest score of the ranking's scoring weights */
+    [[nodiscard]] uint16_t getMaxScore() const { return maxScore; }
+
+    /** @brief Returns the scoring weights of the ranking */
+    [[nodiscard]] const StartScoringWeights &getWeights() const { return weights; }
+
+    /** @brief Returns the pruning applied to the ranking */
+    [[nodiscard]] StartPruning getPruning() const { return pruning; }
+
+    /** @brief Returns the version of the world the ranking was built from */
+    [[nodiscard]] uint64_t getWorldVersion() const { return worldVersion; }
+
+private:
+    /**
+     * @brief Bucket-sorts the scored cells, then applies the weights and pruning
+     * @param matrixWorld World to rank
+     * @param scores Complete neighbour counts of the world
+     */
+    void rankScores(const MatrixWorld &matrixWorld, DegreeScores &scores);
+
+    /**
+     * @brief Drops every candidate that is not the representative of its orbit
+     * @param matrixWorld World the ranking was built from
+     */
+    void pruneSymmetric(const MatrixWorld &matrixWorld);
+
+    /** @brief Decodes a packed linear index into (row, col) */
+    [[nodiscard]] std::pair<uint16_t, uint16_t> getCellAt(uint32_t index) const
+    {
+        return {static_cast<uint16_t>(index / cols), static_cast<uint16_t>(index % cols)};
+    }
+
+    uint16_t rows;                                  ///< Matrix row count
+    uint16_t cols;                                  ///< Matrix column count
+    uint64_t worldVersion;                          ///< Version of the source world
+    StartScoringWeights weights;                    ///< Scoring criteria weights
+    StartPruning pruning;                           ///< Redundant candidates left out
+    uint16_t maxScore;                              ///< Highest possible score
+    std::vector<uint32_t> order;                    ///< Packed linear indices, best first
+    std::vector<size_t> bucketStart;                ///< Bucket offsets, highest score first
+};
+
+/**
+ * @class CandidateRange
+ * @brief Lazy forward range over a slice of a ranking
+ *
+ * Iterating yields (row, col) pairs decoded on the fly from the packed
+ * indices - nothing is copied or allocated. The range shares ownership of
+ * the ranking, so it stays valid independently of any cache.
+ */
+class CandidateRange
+{
+public:
+    /**
+     * @class Iterator
+     * @brief Forward iterator over ranks of the slice
+     */
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<uint16_t, uint16_t>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        Iterator() = default;
+
+        /**
+         * @brief Creates an iterator at a rank
+         * @param ranking Ranking to read
+         * @param rank Current position
+         */
+        Iterator(const CandidateRanking *ranking, size_t rank) : ranking(ranking), rank(rank) {}
+
+        /** @brief Returns the (row, col) of the current candidate */
+        value_type operator*() const { return ranking->getCell(rank); }
+
+        /** @brief Advances to the next candidate */
+        Iterator &operator++()
+        {
+            ++rank;
+            return *this;
+        }
+
+        /** @brief Advances to the next candidate (postfix) */
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++rank;
+            return previous;
+        }
+
+        /** @brief Compares positions */
+        bool operator==(const Iterator &other) const { return rank == other.rank; }
+
+        /** @brief Compares positions */
+        bool operator!=(const Iterator &other) const { return rank != other.rank; }
+
+    private:
+        const CandidateRanking *ranking = nullptr; ///< Ranking being read
+        size_t rank = 0;                           ///< Current position
+    };
+
+    /**
+     * @brief Creates the range [first, last) of a ranking
+     * @param ranking Shared ranking
+     * @param first First rank of the slice
+     * @param last One past the last rank of the slice
+     */
+    CandidateRange(std::shared_ptr<const CandidateRanking> ranking, size_t first, size_t last)
+        : ranking(std::move(ranking)), first(first), last(last)
+    {
+    }
+
+    /** @brief Returns an iterator to the first candidate */
+    [[nodiscard]] Iterator begin() const { return {ranking.get(), first}; }
+
+    /** @brief Returns the past-the-end iterator */
+    [[nodiscard]] Iterator end() const { return {ranking.get(), last}; }
+
+    /** @brief Returns the number of candidates in the range */
+    [[nodiscard]] size_t size() const { return last - first; }
+
+    /** @brief Checks whether the range holds no candidate */
+    [[nodiscard]] bool empty() const { return first == last; }
+
+private:
+    std::shared_ptr<const CandidateRanking> ranking; ///< Ranking being read
+    size_t first;                                   ///< First rank
+    size_t last;                                    ///< One past the last rank
+};
+
+/**
+ * @class SharedCandidateCursor
+ * @brief Thread-safe cursor handing out every candidate of a ranking once
+ *
+ * Parallel workers call claim() until it returns nothing; a single relaxed
+ * fetch_add per claim keeps contention to one cache line.
+ */
+class SharedCandidateCursor
+{
+public:
+    /**
+     * @brief Creates a cursor over the first limit candidates of a ranking
+     * @param ranking Shared ranking
+     * @param limit Maximum number of candidates handed out (default: all)
+     */
+    explicit SharedCandidateCursor(std::shared_ptr<const CandidateRanking> ranking, size_t limit = SIZE_MAX);
+
+    /**
+     * @brief Claims the next candidate
+     * @return (row, col) of the claimed candidate, or std::nullopt when all are taken
+     */
+    [[nodiscard]] std::optional<std::pair<uint16_t, uint16_t>> claim();
+
+private:
+    std::shared_ptr<const CandidateRanking> ranking; ///< Ranking being read
+    size_t limit;                                   ///< Number of candidates to hand out
+    std::atomic<size_t> next{0};                    ///< Rank of the next unclaimed candidate
+};
+
+#endif
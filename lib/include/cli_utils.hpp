@@ -10,9 +10,14 @@
 #define CLI_UTILS_H
 
 #include "Ipath_algorithm.hpp"
+#include "result_output.hpp"
+#include "world_image_loader.hpp"
+#include "world_stream_loader.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <utility>
 
@@ -27,10 +32,22 @@
  * @note All coordinates are 0-indexed matrix positions
  */
 struct CLIParameters {
-    uint16_t rows, cols;                                    ///< Matrix dimensions
+    uint16_t rows = 0, cols = 0;                            ///< Matrix dimensions (taken from worldImage/mapFile if given)
     PathLength pathLength;                                  ///< Target path length
     MaxStartingPoints maxStartingPoints = {5};             ///< Max starting points to try
     std::vector<std::pair<uint16_t, uint16_t>> blockedCells; ///< Blocked cell coordinates
+    std::string blockedCellsFile;                           ///< Blocked cells file (empty if none), see loadBlockedCellsFile()
+    std::string worldImage;                                 ///< PBM/PGM world image (empty if none), see loadWorldImageFile()
+    double occupiedThreshold = DEFAULT_OCCUPIED_THRESHOLD;  ///< PGM occupancy above which a pixel is blocked
+    std::string mapFile;                                    ///< MovingAI .map world (empty if none), see loadMovingAiMapFile()
+    std::string scenarioFile;                               ///< MovingAI .scen queries to benchmark (empty if none)
+    std::optional<StreamFormat> stdinFormat;                ///< World stream read from stdin (none if unset)
+    std::string batchFile;                                  ///< Job file run in batch mode (empty if none), see runBatch()
+    std::string serveSocket;                                ///< Unix socket served as a daemon (empty if none), see PathService
+    uint16_t threads = 0;                                   ///< Batch or service worker threads (0 = hardware concurrency)
+    std::string algorithm = "dfs";                          ///< Registry name of the engine to run
+    OutputFormat outputFormat = OutputFormat::Text;         ///< Result format on stdout (json/csv suppress the echo)
+    PathEncoding pathEncoding = PathEncoding::Inline;       ///< Path encoding of JSON records
 };
 
 /**
@@ -41,9 +58,23 @@ struct CLIParameters {
  */
 CLIParameters CLIParser(size_t argc, std::vector<std::string> argv);
 
+/**
+ * @brief Parses one blocked cell token
+ * @param token Cell in format {row,col} or row,col
+ * @param tokenIndex Position of the token on the command line, reported in errors
+ * @return (row, col) of the cell
+ * @throws std::invalid_argument If the token is malformed or a coordinate exceeds 65535
+ */
+[[nodiscard]] std::pair<uint16_t, uint16_t> parseBlockedCell(std::string_view token, size_t tokenIndex);
+
 /**
  * @brief Prints help information for the CLI
  */
 void printHelp();
 
+/**
+ * @brief Prints the registered path finding engines
+ */
+void printAlgorithms();
+
 #endif
@@ -0,0 +1,71 @@
+/**
+ * @file corridor_algorithm.hpp
+ * @brief Long-path search on the corridor-contracted junction graph
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef CORRIDOR_ALGORITHM_H
+#define CORRIDOR_ALGORITHM_H
+
+#include "Ipath_algorithm.hpp"
+#include "corridor_graph.hpp"
+#include "matrix_utils.hpp"
+#include "path.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class CorridorAlgorithm
+ * @brief Exhaustive DFS over junctions instead of cells
+ *
+ * Contracts the world into a CorridorGraph and searches simple paths of the
+ * junction graph, so a corridor of any length costs a single step. Every
+ * simple path of the grid consists of a tail of some corridor, a chain of
+ * whole edges between distinct junctions and a head entering one more
+ * corridor. The search therefore starts either at a node or with a whole
+ * corridor leading to it, and may finish partway along any unused edge.
+ * Since any prefix of a simple path is a simple path, reaching or exceeding
+ * the target length and truncating is enough.
+ *
+ * The search is complete: an empty result proves that no path exists.
+ */
+class CorridorAlgorithm : public PathAlgorithm
+{
+private:
+    /**
+     * @brief Runs one DFS over the junction graph from a start configuration
+     * @param graph Contracted world
+     * @param rootNode Node the search starts at
+     * @param prefixEdge Edge whose cells precede the root, or no edge
+     * @param targetLength Target path length
+     * @return Path of targetLength cells, or empty path if none starts this way
+     */
+    [[nodiscard]] Path searchFrom(const CorridorGraph &graph,
+                                  uint32_t rootNode,
+                                  uint32_t prefixEdge,
+                                  uint32_t targetLength);
+
+public:
+    /**
+     * @brief Finds a viable path by searching the junction graph
+     * @param matrixWorld Reference to the matrix world
+     * @param pathLength Target path length wrapped in PathLength struct
+     * @param maxStartingPoints Unused - every start configuration is tried
+     * @return Path object containing the found path (empty if none exists)
+     * @throws std::invalid_argument If pathLength.value is zero or exceeds matrix size
+     */
+    [[nodiscard]] Path findViablePath(const MatrixWorld &matrixWorld,
+                                      PathLength pathLength,
+                                      MaxStartingPoints maxStartingPoints = {}) override;
+
+    /** @brief Returns the name of the algorithm */
+    [[nodiscard]] std::string getAlgorithmName() const override
+    {
+        return "Corridor Contraction (Junction Graph DFS)";
+    }
+};
+
+#endif
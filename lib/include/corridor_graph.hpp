@@ -0,0 +1,88 @@
+/**
+ * @file corridor_graph.hpp
+ * @brief Reduced graph of a world with degree-2 corridors contracted into edges
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef CORRIDOR_GRAPH_H
+#define CORRIDOR_GRAPH_H
+
+#include "matrix_utils.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct CorridorEdge
+ * @brief Maximal chain of degree-2 cells between two junction nodes
+ *
+ * Cells are stored as linear indices (row × cols + col), ordered from the
+ * cell next to node `from` to the cell next to node `to`. Adjacent junctions
+ * are joined by an edge without cells. A chain that returns to its own node
+ * is a self-loop (from == to).
+ */
+struct CorridorEdge
+{
+    uint32_t from = 0;          ///< First endpoint (node id)
+    uint32_t to = 0;            ///< Second endpoint (node id)
+    std::vector<uint32_t> cells; ///< Interior corridor cells, from → to order
+};
+
+/**
+ * @class CorridorGraph
+ * @brief Junction graph of the free cells of a MatrixWorld
+ *
+ * Nodes are the free cells whose degree is not 2 (dead ends, isolated cells
+ * and junctions); every maximal chain of degree-2 cells between them becomes
+ * one weighted edge. A component made of a pure cycle of degree-2 cells gets
+ * one of its cells promoted to a node, so every free cell is either a node or
+ * interior to exactly one edge.
+ *
+ * Built in O(N×M); corridor-heavy worlds shrink to a graph whose size scales
+ * with the junction count instead of the cell count.
+ */
+class CorridorGraph
+{
+private:
+    uint16_t cols;                                  ///< Matrix column count (for index decoding)
+    std::vector<uint32_t> nodeCells;                ///< Linear cell index of every node
+    std::vector<CorridorEdge> edges;                ///< All contracted edges
+    std::vector<std::vector<uint32_t>> incidence;   ///< Edge ids incident to every node
+
+public:
+    /**
+     * @brief Contracts the corridors of the given world
+     * @param matrixWorld World to contract
+     */
+    explicit CorridorGraph(const MatrixWorld &matrixWorld);
+
+    /** @brief Returns the number of junction nodes */
+    [[nodiscard]] size_t getNodeCount() const { return nodeCells.size(); }
+
+    /** @brief Returns the number of contracted edges */
+    [[nodiscard]] size_t getEdgeCount() const { return edges.size(); }
+
+    /** @brief Returns the matrix column count used by the linear indices */
+    [[nodiscard]] uint16_t getCols() const { return cols; }
+
+    /**
+     * @brief Returns the linear cell index of a node
+     * @param node Node id
+     */
+    [[nodiscard]] uint32_t getNodeCell(uint32_t node) const { return nodeCells.at(node); }
+
+    /**
+     * @brief Returns an edge
+     * @param edge Edge id
+     */
+    [[nodiscard]] const CorridorEdge &getEdge(uint32_t edge) const { return edges.at(edge); }
+
+    /**
+     * @brief Returns the ids of the edges incident to a node (self-loops listed once)
+     * @param node Node id
+     */
+    [[nodiscard]] const std::vector<uint32_t> &getIncidentEdges(uint32_t node) const { return incidence.at(node); }
+};
+
+#endif
@@ -0,0 +1,122 @@
+/**
+ * @file csr_graph.hpp
+ * @brief Compressed sparse row adjacency graph of the free cells of a world
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include "matrix_utils.hpp"
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * @enum CellOrdering
+ * @brief Numbering of the free cells as graph nodes
+ *
+ * Orderings that keep grid neighbours close in node numbering keep the
+ * per-node data of a traversal close in memory.
+ */
+enum class CellOrdering : uint8_t
+{
+    RowMajor,           ///< Scan order of the matrix (no renumbering)
+    BFS,                ///< Breadth-first order per component
+    Hilbert,            ///< Position along a Hilbert space-filling curve
+    ReverseCuthillMcKee ///< Bandwidth-reducing reverse Cuthill-McKee order
+};
+
+/**
+ * @class CsrGraph
+ * @brief Immutable 4-connected adjacency graph of free cells in CSR layout
+ *
+ * Node v has the neighbours adjacency[offsets[v] .. offsets[v + 1]), sorted by
+ * node id. Nodes map back to (row, col) and free cells map to their node.
+ * Blocked cells have no node.
+ *
+ * Building costs O(N×M) (plus a sort for Hilbert order). getShared() caches
+ * graphs by world version and ordering, so repeated queries on an unchanged
+ * world share one read-only instance.
+ */
+class CsrGraph
+{
+public:
+    /// Node id of blocked cells
+    static constexpr uint32_t NO_NODE = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief Builds the graph of the given world
+     * @param matrixWorld World to convert
+     * @param ordering Node numbering to use
+     */
+    explicit CsrGraph(const MatrixWorld &matrixWorld, CellOrdering ordering = CellOrdering::RowMajor);
+
+    /**
+     * @brief Returns the graph of the given world, building it only once per version
+     * @param matrixWorld World to convert
+     * @param ordering Node numbering to use
+     * @return Shared read-only graph
+     *
+     * Thread-safe. Keeps the most recently used graphs; a world mutated after
+     * the call gets a new graph on the next call.
+     */
+    [[nodiscard]] static std::shared_ptr<const CsrGraph> getShared(const MatrixWorld &matrixWorld,
+                                                                   CellOrdering ordering = CellOrdering::RowMajor);
+
+    /** @brief Returns the number of nodes (free cells) */
+    [[nodiscard]] uint32_t getNodeCount() const { return static_cast<uint32_t>(nodeCells.size()); }
+
+    /** @brief Returns the number of adjacency entries (twice the number of edges) */
+    [[nodiscard]] size_t getAdjacencySize() const { return adjacency.size(); }
+
+    /** @brief Returns the row offsets (node count + 1 entries) */
+    [[nodiscard]] const std::vector<uint32_t> &getOffsets() const { return offsets; }
+
+    /** @brief Returns the concatenated neighbour lists */
+    [[nodiscard]] const std::vector<uint32_t> &getAdjacency() const { return adjacency; }
+
+    /**
+     * @brief Returns the degree of a node
+     * @param node Node id
+     */
+    [[nodiscard]] uint32_t getDegree(uint32_t node) const { return offsets[node + 1] - offsets[node]; }
+
+    /**
+     * @brief Returns the node of a cell
+     * @param row Row coordinate
+     * @param col Column coordinate
+     * @return Node id, or NO_NODE if the cell is blocked
+     * @throws std::out_of_range If the coordinates are outside the world
+     */
+    [[nodiscard]] uint32_t getNode(uint16_t row, uint16_t col) const;
+
+    /**
+     * @brief Returns the cell of a node
+     * @param node Node id
+     * @return (row, col) of the node
+     * @throws std::out_of_range If the node does not exist
+     */
+    [[nodiscard]] std::pair<uint16_t, uint16_t> getCell(uint32_t node) const;
+
+    /** @brief Returns the version of the world the graph was built from */
+    [[nodiscard]] uint64_t getWorldVersion() const { return worldVersion; }
+
+    /** @brief Returns the node numbering of the graph */
+    [[nodiscard]] CellOrdering getOrdering() const { return ordering; }
+
+private:
+    uint16_t cols;                  ///< Matrix column count
+    uint64_t worldVersion;          ///< Version of the source world
+    CellOrdering ordering;          ///< Node numbering
+    std::vector<uint32_t> offsets;  ///< CSR row offsets
+    std::vector<uint32_t> adjacency; ///< CSR neighbour lists
+    std::vector<uint32_t> nodeCells; ///< Linear cell index of every node
+    std::vector<uint32_t> cellNodes; ///< Node of every linear cell index (NO_NODE if blocked)
+};
+
+#endif
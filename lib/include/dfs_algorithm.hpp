@@ -12,7 +12,9 @@
 #include "Ipath_algorithm.hpp"
 #include "matrix_utils.hpp"
 #include "path.hpp"
+#include "start_scoring.hpp"
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 /**
@@ -21,10 +23,14 @@
  * 
  * Implements DFS with backtracking to find paths of specified length in a matrix.
  * Uses smart starting point selection and integrates with existing components.
+ * Starting points are tried in the order of a CandidateRanking scored with
+ * the engine's StartScoringWeights.
  */
 class DFSAlgorithm : public PathAlgorithm
 {
 private:
+    StartScoringWeights startWeights; ///< Weights ranking the starting points
+
     /**
      * @brief Recursive DFS implementation with backtracking
      * @param matrixWorld Reference to the matrix world
@@ -39,6 +45,33 @@ private:
                       uint16_t targetLength);
 
 public:
+    /**
+     * @brief Constructs the engine
+     * @param startWeights Weights ranking the starting points (default: neighbour count)
+     */
+    explicit DFSAlgorithm(const StartScoringWeights &startWeights = {});
+
+    /** @brief Returns the weights ranking the starting points */
+    [[nodiscard]] const StartScoringWeights &getStartWeights() const
+    {
+        return startWeights;
+    }
+
+    /**
+     * @brief Runs the DFS from a single starting cell
+     * @param matrixWorld Reference to the matrix world
+     * @param start (row, col) of the first path cell (must be unblocked)
+     * @param pathLength Target path length
+     * @return Path of pathLength cells starting at start, or empty path if none
+     *         exists or the search was cancelled
+     *
+     * Performs no parameter validation; used by findViablePath() and by
+     * engines that distribute starting points over several workers.
+     */
+    [[nodiscard]] Path findPathFrom(const MatrixWorld &matrixWorld,
+                                    std::pair<uint16_t, uint16_t> start,
+                                    PathLength pathLength);
+
     /**
      * @brief Finds a viable path of specified length using DFS
      * @param matrixWorld Reference to the matrix world
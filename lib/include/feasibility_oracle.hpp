@@ -0,0 +1,50 @@
+/**
+ * @file feasibility_oracle.hpp
+ * @brief Linear-time necessary conditions for the existence of a path
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef FEASIBILITY_ORACLE_H
+#define FEASIBILITY_ORACLE_H
+
+#include "Ipath_algorithm.hpp"
+#include "matrix_utils.hpp"
+#include <cstdint>
+#include <string>
+
+/**
+ * @struct FeasibilityResult
+ * @brief Verdict of the feasibility oracle
+ *
+ * A feasible verdict only means that no cheap necessary condition is violated;
+ * the search may still come back empty. An infeasible verdict is a proof.
+ */
+struct FeasibilityResult
+{
+    bool isFeasible = true;  ///< False if the request provably has no solution
+    uint32_t upperBound = 0; ///< Upper bound on the longest simple path of the world
+    std::string reason;      ///< Human readable reason (empty when feasible)
+};
+
+/**
+ * @brief Checks cheap necessary conditions for a simple path of the given length
+ * @param matrixWorld World to analyze
+ * @param pathLength Requested path length
+ * @return FeasibilityResult with the verdict, the bound and the reason
+ *
+ * For every 4-connected component of free cells the longest simple path is
+ * bounded by:
+ * - Component size - a simple path never leaves its component
+ * - Parity balance - the grid is bipartite (checkerboard colouring), a path
+ *   alternates colours, so it holds at most 2×min(black, white) cells plus one
+ *   when the colours are unbalanced
+ * - Dead ends - a cell with a single free neighbour can only be an end of the
+ *   path, so all but two dead ends are unreachable for the path
+ *
+ * Complexity: O(N×M) time, one flood fill per component.
+ */
+[[nodiscard]] FeasibilityResult checkPathFeasibility(const MatrixWorld &matrixWorld, PathLength pathLength);
+
+#endif
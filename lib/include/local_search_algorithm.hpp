@@ -0,0 +1,86 @@
+/**
+ * @file local_search_algorithm.hpp
+ * @brief Local-search path extender based on detour insertion
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef LOCAL_SEARCH_ALGORITHM_H
+#define LOCAL_SEARCH_ALGORITHM_H
+
+#include "Ipath_algorithm.hpp"
+#include "matrix_utils.hpp"
+#include "path.hpp"
+#include <cstdint>
+#include <string>
+
+/**
+ * @class LocalSearchAlgorithm
+ * @brief Grows a cheap seed path to the requested length with local moves
+ *
+ * The path is kept as a doubly linked list over linear cell indices together
+ * with an on-path bitmap, so every move is O(1):
+ * - Detour insertion: a step a→b is replaced by the U-shaped a→a'→b'→b, where
+ *   a' and b' are the free, unvisited cells next to a and b on the same side
+ *   (+2 cells)
+ * - End extension: a free, unvisited neighbour is appended at the tail or
+ *   prepended at the head (+1 cell)
+ *
+ * Path steps are kept on a worklist and each is tried once: cells are only
+ * ever consumed, so a step that cannot take a detour never becomes able to.
+ * The whole extension is therefore O(N×M) regardless of the target length.
+ *
+ * The engine is incomplete - an empty result does not prove that no path exists.
+ */
+class LocalSearchAlgorithm : public PathAlgorithm
+{
+public:
+    /**
+     * @brief Extends a seed path to the requested length
+     * @param matrixWorld Reference to the matrix world
+     * @param seedPath Simple contiguous path of unblocked cells to start from
+     * @param pathLength Target path length
+     * @return Path of exactly pathLength cells, or an empty path if the local
+     *         moves got stuck before reaching the target
+     * @throws std::invalid_argument If the seed is empty or not a simple
+     *         contiguous path of unblocked cells
+     *
+     * Seeds longer than the target are simply truncated.
+     */
+    [[nodiscard]] Path extendPath(const MatrixWorld &matrixWorld, const Path &seedPath, PathLength pathLength);
+
+    /**
+     * @brief Builds a greedy walk from a starting cell
+     * @param matrixWorld Reference to the matrix world
+     * @param startRow Row of the first cell
+     * @param startCol Column of the first cell
+     * @param maxLength Maximum walk length
+     * @return Walk that always moves to the unvisited neighbour with the
+     *         fewest onward options (Warnsdorff's rule)
+     */
+    [[nodiscard]] static Path buildGreedySeed(const MatrixWorld &matrixWorld,
+                                              uint16_t startRow,
+                                              uint16_t startCol,
+                                              uint16_t maxLength);
+
+    /**
+     * @brief Finds a viable path by extending the tree diameter, then greedy seeds
+     * @param matrixWorld Reference to the matrix world
+     * @param pathLength Target path length wrapped in PathLength struct
+     * @param maxStartingPoints Number of greedy seeds (from the best ranked starting points) to try
+     * @return Path object containing the found path (empty if none found)
+     * @throws std::invalid_argument If pathLength.value is zero or exceeds matrix size
+     */
+    [[nodiscard]] Path findViablePath(const MatrixWorld &matrixWorld,
+                                      PathLength pathLength,
+                                      MaxStartingPoints maxStartingPoints = {}) override;
+
+    /** @brief Returns the name of the algorithm */
+    [[nodiscard]] std::string getAlgorithmName() const override
+    {
+        return "Local Search (Detour Insertion) Algorithm";
+    }
+};
+
+#endif
@@ -0,0 +1,51 @@
+/**
+ * @file mapped_file.hpp
+ * @brief Read-only memory mapping of input files
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file, unmapped on destruction
+ *
+ * Lets loaders parse input files in place, without copying them through
+ * stream buffers first.
+ */
+class MappedFile
+{
+public:
+    /**
+     * @brief Maps the file
+     * @param filePath Path of the file
+     * @throws std::runtime_error If the file cannot be opened or mapped
+     */
+    explicit MappedFile(const std::string &filePath);
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /** @brief Unmaps the file */
+    ~MappedFile();
+
+    /** @brief Returns the file contents (empty for an empty file) */
+    [[nodiscard]] std::string_view getText() const { return {data, data != nullptr ? size : 0}; }
+
+private:
+    /** @brief Closes the file descriptor if open */
+    void closeDescriptor();
+
+    int descriptor;             ///< Open file descriptor (-1 when closed)
+    const char *data = nullptr; ///< Mapped contents
+    size_t size = 0;            ///< File size in bytes
+};
+
+#endif
@@ -9,8 +9,10 @@
 #ifndef MATRIX_UTILS_H
 #define MATRIX_UTILS_H
 
-#include <vector>
+#include <cstddef>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 /**
  * @class MatrixWorld
@@ -25,16 +27,36 @@
  * - false = unblocked/passable cell
  * - true = blocked/impassable cell
  * 
+ * Storage is bit-packed: each row occupies getWordsPerRow() 64-bit words, bit
+ * (col % 64) of word (col / 64) holding the state of column col. Padding bits
+ * past the last column read as blocked, so ~word is the free-cell mask of a
+ * word without further masking. getRowWords() exposes a row for word-parallel
+ * scans.
+ * 
  * @note This class uses 4-directional neighbor analysis (up, down, left, right)
  */
 class MatrixWorld
 {
 private:
-    std::vector<bool> worldMatrix;    ///< Internal matrix storage (false=unblocked, true=blocked)
+    std::vector<uint64_t> worldMatrix; ///< Bit-packed row words (0=unblocked, 1=blocked)
     uint16_t rows;                    ///< Number of rows in the matrix
     uint16_t cols;                    ///< Number of columns in the matrix
+    size_t wordsPerRow;               ///< 64-bit words per row
     uint32_t noOfUnblockedCells;      ///< Counter for unblocked (passable) cells
     uint32_t noOfBlockedCells;        ///< Counter for blocked (impassable) cells
+    uint64_t version;                 ///< Content version, renewed on every mutation
+
+    /**
+     * @brief Assigns a new process-wide unique version to the world
+     *
+     * Called by every method that changes the matrix content.
+     */
+    void bumpVersion();
+
+    /**
+     * @brief Marks every cell unblocked and every padding bit blocked
+     */
+    void resetWords();
 
     /**
      * @brief Converts 2D coordinates to 1D array index
@@ -87,6 +109,30 @@ public:
      */
     bool matrixBlanking(std::vector<std::pair<uint16_t, uint16_t>> coordinates);
 
+    /**
+     * @brief Blocks every cell whose bit is set in a packed mask
+     * @param mask getColSize() × getWordsPerRow() words in the layout of getRowWords()
+     * @return true on success, false if the mask size does not match the matrix
+     * 
+     * ORs the mask into the matrix word by word; padding bits of the mask are
+     * ignored. Counters follow from popcounts of the newly blocked bits and
+     * the version changes once. Lets bulk loaders fill a plain bitmap
+     * concurrently instead of building a coordinate list.
+     */
+    bool matrixBlankingMask(const std::vector<uint64_t> &mask);
+
+    /**
+     * @brief Blocks every cell whose bit is set in a packed band of rows
+     * @param firstRow First row covered by words
+     * @param words rowCount × getWordsPerRow() words in the layout of getRowWords()
+     * @param rowCount Number of rows covered by words
+     * @return true on success, false if the band extends past the last row
+     * 
+     * Same as matrixBlankingMask() restricted to rows [firstRow, firstRow +
+     * rowCount), so streaming loaders can apply rows as they arrive.
+     */
+    bool matrixBlankingRows(uint16_t firstRow, const uint64_t *words, size_t rowCount);
+
     /**
      * @brief Checks if the matrix contains only unblocked cells
      * @return true if no cells are blocked, false otherwise
@@ -171,5 +217,34 @@ public:
      * and validation in path finding algorithms. Equivalent to rows × cols.
      */
     [[nodiscard]] size_t getTotalCells() const;
+
+    /**
+     * @brief Gets the content version of the world
+     * @return Version number identifying the current matrix content
+     *
+     * Versions are drawn from a process-wide counter, so two different
+     * worlds never share a version and every mutation (setCell, blanking,
+     * clearing, resizing) yields a new one. Copies keep the version of their
+     * source, as they hold the same content. Used as the key of derived
+     * structures cached across queries.
+     */
+    [[nodiscard]] uint64_t getVersion() const;
+
+    /**
+     * @brief Gets the number of 64-bit words storing one row
+     * @return (columns + 63) / 64
+     */
+    [[nodiscard]] size_t getWordsPerRow() const;
+
+    /**
+     * @brief Gets the packed words of a row
+     * @param row Row coordinate (0-based)
+     * @return Pointer to getWordsPerRow() words; a set bit marks a blocked cell
+     *         or padding past the last column
+     * @throws std::invalid_argument If row is out of bounds
+     *
+     * The pointer stays valid until the matrix is resized.
+     */
+    [[nodiscard]] const uint64_t *getRowWords(uint16_t row) const;
 };
 #endif
\ No newline at end of file
@@ -0,0 +1,132 @@
+/**
+ * @file moving_ai.hpp
+ * @brief MovingAI grid benchmark support: .map/.scen loaders and scenario runner
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef MOVING_AI_H
+#define MOVING_AI_H
+
+#include "Ipath_algorithm.hpp"
+#include "matrix_utils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @struct ScenarioEntry
+ * @brief One query of a MovingAI .scen file
+ *
+ * x is the column and y the row, as in the benchmark files.
+ */
+struct ScenarioEntry
+{
+    uint32_t bucket = 0;        ///< Difficulty bucket
+    std::string mapName;        ///< Map file the query was generated for
+    uint16_t mapWidth = 0;      ///< Map columns
+    uint16_t mapHeight = 0;     ///< Map rows
+    uint16_t startX = 0;        ///< Start column
+    uint16_t startY = 0;        ///< Start row
+    uint16_t goalX = 0;         ///< Goal column
+    uint16_t goalY = 0;         ///< Goal row
+    double optimalLength = 0.0; ///< Published optimal (octile) distance
+};
+
+/**
+ * @struct ScenarioReport
+ * @brief Throughput and latency of a scenario run
+ */
+struct ScenarioReport
+{
+    size_t queries = 0;            ///< Scenario entries run
+    size_t solved = 0;             ///< Queries answered with a valid path
+    size_t invalid = 0;            ///< Queries answered with a path that failed validation
+    double totalSeconds = 0.0;     ///< Sum of query latencies
+    double queriesPerSecond = 0.0; ///< queries / totalSeconds
+    double p50Micros = 0.0;        ///< Median query latency
+    double p90Micros = 0.0;        ///< 90th percentile query latency
+    double p99Micros = 0.0;        ///< 99th percentile query latency
+    double maxMicros = 0.0;        ///< Slowest query
+};
+
+/**
+ * @brief Decodes a MovingAI .map file into a world
+ * @param text File contents: "type", "height H", "width W", "map" header
+ *        lines followed by H rows of W terrain characters
+ * @return World of H rows and W columns
+ * @throws std::invalid_argument If the header or the grid is malformed; the
+ *         message names the line number
+ *
+ * Ground terrain '.', 'G' and swamp 'S' are free; out of bounds '@'/'O',
+ * trees 'T', water 'W' and any other character are blocked. The grid is
+ * packed into a bitmap and merged with one matrixBlankingMask() call.
+ */
+[[nodiscard]] MatrixWorld loadMovingAiMap(std::string_view text);
+
+/**
+ * @brief Loads a MovingAI .map file into a world
+ * @param filePath Path of the .map file
+ * @return Decoded world
+ * @throws std::runtime_error If the file cannot be opened or mapped
+ * @throws std::invalid_argument If the file is malformed (see loadMovingAiMap)
+ */
+[[nodiscard]] MatrixWorld loadMovingAiMapFile(const std::string &filePath);
+
+/**
+ * @brief Parses a MovingAI .scen file
+ * @param text File contents: optional "version" line, then one query per
+ *        line: bucket, map, width, height, start x/y, goal x/y, optimal length
+ * @return Queries in file order
+ * @throws std::invalid_argument If a line is malformed or a point lies
+ *         outside its map; the message names the line number
+ */
+[[nodiscard]] std::vector<ScenarioEntry> loadScenarios(std::string_view text);
+
+/**
+ * @brief Loads a MovingAI .scen file
+ * @param filePath Path of the .scen file
+ * @return Queries in file order
+ * @throws std::runtime_error If the file cannot be opened or mapped
+ * @throws std::invalid_argument If the file is malformed (see loadScenarios)
+ */
+[[nodiscard]] std::vector<ScenarioEntry> loadScenarioFile(const std::string &filePath);
+
+/**
+ * @brief Path length requested for a scenario query
+ * @param entry Scenario query
+ * @return floor(optimalLength) + 1, capped at 65535
+ *
+ * Engines search for a path of a given length rather than between two
+ * points, so the query's optimal cost is turned into a length: one cell per
+ * whole unit of the octile distance plus the start cell. Diagonal steps cost
+ * √2, so this is not the cell count of the optimal route, only a length that
+ * grows with the difficulty of the query.
+ */
+[[nodiscard]] PathLength scenarioPathLength(const ScenarioEntry &entry);
+
+/**
+ * @brief Runs every scenario query against an engine
+ * @param matrixWorld World decoded from the scenarios' map
+ * @param scenarios Queries to run
+ * @param algorithm Engine answering the queries
+ * @param maxStartingPoints Starting points passed to every query
+ * @return Throughput, latency percentiles (nearest rank) and validity counts
+ * @throws std::invalid_argument If a query was generated for a map of other dimensions
+ *
+ * Each query is timed around findViablePath() alone; results are checked
+ * with isViablePath() outside the timed region.
+ */
+[[nodiscard]] ScenarioReport runScenarios(const MatrixWorld &matrixWorld, const std::vector<ScenarioEntry> &scenarios,
+                                          PathAlgorithm &algorithm, MaxStartingPoints maxStartingPoints);
+
+/**
+ * @brief Prints a scenario report
+ * @param report Report to print
+ */
+void printScenarioReport(const ScenarioReport &report);
+
+#endif
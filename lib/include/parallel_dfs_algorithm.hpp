@@ -0,0 +1,76 @@
+/**
+ * @file parallel_dfs_algorithm.hpp
+ * @brief Multi-threaded DFS distributing starting points over workers
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef PARALLEL_DFS_ALGORITHM_H
+#define PARALLEL_DFS_ALGORITHM_H
+
+#include "Ipath_algorithm.hpp"
+#include "matrix_utils.hpp"
+#include "path.hpp"
+#include "start_scoring.hpp"
+#include <string>
+
+/**
+ * @class ParallelDFSAlgorithm
+ * @brief Exhaustive DFS with starting points claimed from a shared cursor
+ *
+ * Every worker thread owns a DFSAlgorithm instance and repeatedly claims the
+ * next best ranked starting point from a SharedCandidateCursor over the
+ * world's shared CandidateRanking, so no candidate is searched twice and no
+ * batches are materialised. The first path found cancels all other workers.
+ *
+ * The engine is complete: when every candidate has been searched without
+ * success, no path exists. On symmetric worlds only one starting point per
+ * symmetry orbit is a candidate, which keeps completeness.
+ */
+class ParallelDFSAlgorithm : public PathAlgorithm
+{
+private:
+    unsigned threadCount;             ///< Number of worker threads
+    StartScoringWeights startWeights; ///< Weights ranking the starting points
+
+public:
+    /**
+     * @brief Constructs the engine
+     * @param threadCount Number of worker threads (0 = hardware concurrency)
+     * @param startWeights Weights ranking the starting points (default: neighbour count)
+     */
+    explicit ParallelDFSAlgorithm(unsigned threadCount = 0, const StartScoringWeights &startWeights = {});
+
+    /**
+     * @brief Finds a viable path by searching starting points in parallel
+     * @param matrixWorld Reference to the matrix world (shared read-only by all threads)
+     * @param pathLength Target path length wrapped in PathLength struct
+     * @param maxStartingPoints Unused - every ranked candidate is searched
+     * @return Path object containing the found path (empty if none exists)
+     * @throws std::invalid_argument If pathLength.value is zero or exceeds matrix size
+     */
+    [[nodiscard]] Path findViablePath(const MatrixWorld &matrixWorld,
+                                      PathLength pathLength,
+                                      MaxStartingPoints maxStartingPoints = {}) override;
+
+    /** @brief Returns the name of the algorithm */
+    [[nodiscard]] std::string getAlgorithmName() const override
+    {
+        return "Parallel Depth-First Search (DFS) Algorithm";
+    }
+
+    /** @brief Returns the number of worker threads */
+    [[nodiscard]] unsigned getThreadCount() const
+    {
+        return threadCount;
+    }
+
+    /** @brief Returns the weights ranking the starting points */
+    [[nodiscard]] const StartScoringWeights &getStartWeights() const
+    {
+        return startWeights;
+    }
+};
+
+#endif
@@ -9,6 +9,7 @@
 #ifndef PATH_H
 #define PATH_H
 
+#include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <utility>
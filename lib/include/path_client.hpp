@@ -0,0 +1,106 @@
+/**
+ * @file path_client.hpp
+ * @brief Client library of the path service
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef PATH_CLIENT_H
+#define PATH_CLIENT_H
+
+#include "path_service.hpp"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class PathClient
+ * @brief Connection to a PathService with blocking and pipelined calls
+ *
+ * The blocking calls (loadWorld(), mutateCells(), queryPath(), cancel())
+ * send one request and wait for its response. submit() and receive() let
+ * callers keep several requests in flight, e.g. to cancel a running query;
+ * responses read while waiting for another id are kept for later. One
+ * client must not be used by several threads at once.
+ */
+class PathClient
+{
+    int fd = -1;                                   ///< Connected socket
+    uint32_t nextRequestId = 1;                    ///< Id of the next request
+    std::map<uint32_t, ServiceResponse> received;  ///< Responses read ahead, by request id
+
+public:
+    /**
+     * @brief Connects to a service
+     * @param socketPath Filesystem path the service listens on
+     * @throws std::runtime_error If the connection fails
+     */
+    explicit PathClient(const std::string &socketPath);
+
+    /**
+     * @brief Closes the connection; the service cancels the queries still in flight
+     */
+    ~PathClient();
+
+    PathClient(const PathClient &) = delete;
+    PathClient &operator=(const PathClient &) = delete;
+
+    /**
+     * @brief Sends a request without waiting for its response
+     * @param request Request to send; its id is assigned here
+     * @return Id of the request
+     * @throws std::runtime_error If the connection fails
+     */
+    uint32_t submit(ServiceRequest request);
+
+    /**
+     * @brief Waits for the response of a request
+     * @param requestId Id returned by submit()
+     * @return Response of that request
+     * @throws std::runtime_error If the connection fails or closes first
+     */
+    [[nodiscard]] ServiceResponse receive(uint32_t requestId);
+
+    /**
+     * @brief Loads (or replaces) a resident world
+     * @param name World name
+     * @param reference World reference, see loadWorldReference()
+     * @return Ok with the world version, or Error
+     */
+    ServiceResponse loadWorld(const std::string &name, const std::string &reference);
+
+    /**
+     * @brief Blocks or unblocks cells of a resident world
+     * @param name World name
+     * @param cells (row, col) cells
+     * @param blocked New state of the cells
+     * @return Ok with the new world version, or Error
+     */
+    ServiceResponse mutateCells(const std::string &name, std::vector<std::pair<uint16_t, uint16_t>> cells,
+                                bool blocked = true);
+
+    /**
+     * @brief Finds a path in a resident world
+     * @param name World name
+     * @param pathLength Requested path length
+     * @param algorithm Registry name of the engine
+     * @param maxStartingPoints Starting points limit
+     * @param deadlineMillis Time budget in milliseconds (0 = none)
+     * @return Query response
+     */
+    ServiceResponse queryPath(const std::string &name, PathLength pathLength, const std::string &algorithm = "dfs",
+                              MaxStartingPoints maxStartingPoints = {}, uint32_t deadlineMillis = 0);
+
+    /**
+     * @brief Cancels a query sent with submit()
+     * @param requestId Id of the query
+     * @return Ok if the query was still in flight, Error otherwise; the query
+     *         itself is answered with ResponseStatus::Cancelled
+     */
+    ServiceResponse cancel(uint32_t requestId);
+};
+
+#endif
@@ -9,9 +9,11 @@
 #ifndef PATH_FINDER_UTILS_H
 #define PATH_FINDER_UTILS_H
 
+#include "candidate_ranking.hpp"
 #include "matrix_utils.hpp"
+#include <cstddef>
 #include <cstdint>
-#include <queue>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -20,66 +22,97 @@
  * @brief Utilities for path finding algorithms with smart starting point selection
  * 
  * This class provides functionality for selecting optimal starting points for DFS
- * path finding algorithms. It uses a stateful priority queue approach to efficiently
- * identify and return the best candidates based on unblocked neighbor counts.
+ * path finding algorithms. It walks a CandidateRanking of the world with a cursor
+ * to return the best candidates based on unblocked neighbor counts, or on a
+ * weighted combination of criteria given as StartScoringWeights.
  * 
- * The class maintains an internal priority queue that is populated once and then
- * consumed in batches, allowing for efficient multi-call scenarios where different
- * sets of starting points need to be tried sequentially.
+ * The ranking is obtained once (shared with every other query on the same world
+ * version) and then consumed in batches, allowing for efficient multi-call
+ * scenarios where different sets of starting points need to be tried sequentially.
  * 
- * @note The priority queue is automatically populated on first call and tracks
- * exhaustion state to prevent unnecessary operations.
+ * @note The ranking is automatically obtained on first call and the instance
+ * tracks exhaustion state to prevent unnecessary operations.
  */
 class PathFinderUtils
 {
 private:
-    std::priority_queue<std::pair<uint32_t, std::pair<std::uint16_t, uint16_t>>>
-        priorityQueue;        ///< Priority queue storing (score, coordinates) pairs
-    bool isExhausted = false; ///< Flag indicating if all candidates have been consumed
+    StartScoringWeights weights;                    ///< Scoring policy of the ranking
+    StartPruning pruning = StartPruning::None;      ///< Redundant candidates left out of the ranking
+    std::shared_ptr<const CandidateRanking> ranking; ///< Shared ranking of the world (null until first call)
+    size_t cursor = 0;                              ///< Rank of the next candidate to return
+    bool isExhausted = false;                       ///< Flag indicating if all candidates have been consumed
 
 public:
     /**
      * @brief Constructs a new PathFinderUtils instance
      * 
-     * Initializes an empty priority queue and sets exhaustion flag to false.
-     * The priority queue will be populated on the first call to findStartingPointCandidates.
+     * Starts without a ranking and sets exhaustion flag to false.
+     * The ranking will be obtained on the first call to findStartingPointCandidates.
      */
     PathFinderUtils();
 
+    /**
+     * @brief Constructs a new PathFinderUtils instance with a scoring policy
+     * @param weights Weights of the criteria ranking the candidates
+     * @param pruning Redundant candidates to skip (default: none)
+     *
+     * Weighted criteria such as component size or local free area tell a cell
+     * in a small closet apart from one in an open hall, which plain neighbour
+     * counts cannot. StartPruning::Symmetry returns one cell per orbit of a
+     * mirror- or rotation-symmetric world.
+     */
+    explicit PathFinderUtils(const StartScoringWeights &weights, StartPruning pruning = StartPruning::None);
+
     /**
      * @brief Finds the best starting point candidates for path finding
      * @param matrixWorld Reference to the MatrixWorld to analyze
-     * @param numberOfCandidates Number of candidates to return (1-255)
+     * @param numberOfCandidates Number of candidates to return (1-65535)
      * @return Vector of (row, col) coordinates sorted by score (best first)
      * @throws std::invalid_argument If numberOfCandidates is zero or matrix is empty
      * @throws std::length_error If numberOfCandidates exceeds matrixWorld.getTotalCells()
      * @throws std::runtime_error If all candidates have been exhausted
      * 
-     * On first call, populates the internal priority queue by scoring all unblocked
-     * cells based on their unblocked neighbor count. Subsequent calls consume from
-     * the existing queue until exhausted.
+     * On first call, obtains the shared ranking of all unblocked cells based on
+     * their unblocked neighbor count. Subsequent calls continue from the cursor
+     * until exhausted. Cells with equal scores are returned in row-major order.
      * 
      * If fewer candidates are available than requested, returns all remaining
-     * candidates and marks the queue as exhausted.
+     * candidates and marks the ranking as exhausted.
      * 
-     * Scoring algorithm:
+     * Scoring algorithm (default weights):
      * - Each unblocked cell is scored by counting its unblocked neighbors (0-4)
      * - Higher scores indicate better starting points for path finding
      * - Only 4-directional neighbors are considered (up, down, left, right)
+     * Other weights add their criteria to the score (see StartScoringWeights).
      */
     [[nodiscard]] std::vector<std::pair<std::uint16_t, uint16_t>> findStartingPointCandidates(
         const MatrixWorld &matrixWorld,
-        uint8_t numberOfCandidates);
+        uint16_t numberOfCandidates);
+
+    /**
+     * @brief Lazily returns the next batch of starting point candidates
+     * @param matrixWorld Reference to the MatrixWorld to analyze
+     * @param numberOfCandidates Number of candidates to return (1-65535)
+     * @return Range over the next candidates, best first
+     * @throws std::invalid_argument If numberOfCandidates is zero or matrix is empty
+     * @throws std::length_error If numberOfCandidates exceeds matrixWorld.getTotalCells()
+     * @throws std::runtime_error If all candidates have been exhausted
+     *
+     * Same validation, cursor and exhaustion behaviour as
+     * findStartingPointCandidates(), but the batch is a view over the shared
+     * ranking - no vector is allocated.
+     */
+    [[nodiscard]] CandidateRange nextCandidates(const MatrixWorld &matrixWorld, uint16_t numberOfCandidates);
 
     /**
      * @brief Checks if all starting point candidates have been exhausted
      * @return true if no more candidates are available, false otherwise
      * 
-     * This method allows callers to determine when the priority queue has been
+     * This method allows callers to determine when the ranking has been
      * completely consumed. Useful for implementing retry loops that continue
      * until all possible starting points have been attempted.
      * 
-     * @note Returns false initially and after queue population, true only after
+     * @note Returns false initially and after ranking, true only after
      * all candidates have been retrieved via findStartingPointCandidates()
      */
     [[nodiscard]] bool getIsExhausted() const
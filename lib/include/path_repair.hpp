@@ -0,0 +1,84 @@
+/**
+ * @file path_repair.hpp
+ * @brief Local repair of a previously found path after world mutations
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef PATH_REPAIR_H
+#define PATH_REPAIR_H
+
+#include "Ipath_algorithm.hpp"
+#include "matrix_utils.hpp"
+#include "path.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @struct RepairLimits
+ * @brief Budget of the bounded searches performed during a repair
+ */
+struct RepairLimits
+{
+    uint32_t maxExpansions = 20000; ///< Cells expanded over all bridge and extension searches
+    uint16_t searchRadius = 8;      ///< Bridge searches stay within this margin around the gap
+};
+
+/**
+ * @class PathRepair
+ * @brief Repairs a path whose cells were partially blocked by world mutations
+ *
+ * Instead of a full new findViablePath(), the repair keeps every still valid
+ * segment of the previous path, reconnects consecutive segments with bounded
+ * breadth-first searches around each gap, and finally re-extends or trims the
+ * result to the required length with a bounded depth-first search.
+ *
+ * Bookkeeping is done with hash sets over the path cells, so the cost depends
+ * on the path length, the number of changed cells and the search budget, but
+ * not on the size of the world.
+ *
+ * Example usage:
+ * @code
+ * world.setCell(3, 4, true);
+ * PathRepair repair;
+ * Path fixed = repair.repairPath(world, oldPath, {{3, 4}}, {120});
+ * if (fixed.isEmpty()) { fixed = dfs.findViablePath(world, {120}); } // budget exceeded
+ * @endcode
+ */
+class PathRepair
+{
+private:
+    uint32_t lastExpansions = 0; ///< Cells expanded by the last repair
+
+public:
+    /**
+     * @brief Repairs a previous path after the given cells changed state
+     * @param matrixWorld World after the mutations
+     * @param previousPath Path that was valid before the mutations
+     * @param changedCells Cells whose state changed (blocked or unblocked); cells
+     *        outside the matrix are ignored
+     * @param pathLength Required path length of the repaired path
+     * @param limits Search budget
+     * @return Repaired path of exactly pathLength cells, or an empty path if the
+     *         repair did not succeed within the budget
+     * @throws std::invalid_argument If pathLength.value is zero or exceeds matrix size
+     */
+    [[nodiscard]] Path repairPath(const MatrixWorld &matrixWorld,
+                                  const Path &previousPath,
+                                  const std::vector<std::pair<uint16_t, uint16_t>> &changedCells,
+                                  PathLength pathLength,
+                                  RepairLimits limits = {});
+
+    /**
+     * @brief Gets the number of cells expanded by the last repair
+     * @return Expansion count, useful to compare against a full search
+     */
+    [[nodiscard]] uint32_t getLastExpansions() const
+    {
+        return lastExpansions;
+    }
+};
+
+#endif
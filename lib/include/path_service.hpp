@@ -0,0 +1,270 @@
+/**
+ * @file path_service.hpp
+ * @brief Long-running path service over a Unix domain socket
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef PATH_SERVICE_H
+#define PATH_SERVICE_H
+
+#include "Ipath_algorithm.hpp"
+#include "batch_runner.hpp"
+#include "path.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// Largest accepted frame payload, in bytes
+constexpr uint32_t MAX_FRAME_BYTES = uint32_t{16} << 20;
+
+/**
+ * @brief Kind of a service request
+ *
+ * Wire format of every frame: a little-endian uint32 payload length, then the
+ * payload. Request payload: uint8 type, uint32 request id, then
+ * - LoadWorld: string name, string reference (see loadWorldReference())
+ * - MutateCells: string name, uint8 blocked, uint32 count, count × (uint16 row, uint16 col)
+ * - QueryPath: string name, uint16 path length, string algorithm, uint16 max
+ *   starting points, uint32 deadline in milliseconds (0 = none)
+ * - Cancel: uint32 id of the request to cancel
+ *
+ * Strings are a uint16 length followed by the bytes; integers are little-endian.
+ */
+enum class RequestType : uint8_t
+{
+    LoadWorld = 1,   ///< Load (or replace) a named resident world
+    MutateCells = 2, ///< Block or unblock cells of a resident world
+    QueryPath = 3,   ///< Find a path in a resident world
+    Cancel = 4       ///< Cancel a queued or running query of the same connection
+};
+
+/**
+ * @brief Outcome of a service request
+ */
+enum class ResponseStatus : uint8_t
+{
+    Ok,         ///< Load, mutation or cancellation done
+    Found,      ///< A path was found
+    NotFound,   ///< The engine gave up without a path
+    Infeasible, ///< The feasibility bound proves no path exists
+    Cancelled,  ///< The query was cancelled by a Cancel request or a closed connection
+    TimedOut,   ///< The query deadline passed first
+    Error       ///< Malformed request, unknown world or engine, failed load
+};
+
+/**
+ * @struct ServiceRequest
+ * @brief Decoded request; fields not used by its type are ignored
+ */
+struct ServiceRequest
+{
+    RequestType type = RequestType::QueryPath;               ///< Request kind
+    uint32_t requestId = 0;                                  ///< Caller-chosen id, echoed in the response
+    std::string world;                                       ///< Resident world name
+    std::string reference;                                   ///< LoadWorld: world reference
+    bool blocked = true;                                     ///< MutateCells: new state of the cells
+    std::vector<std::pair<uint16_t, uint16_t>> cells;        ///< MutateCells: (row, col) cells
+    PathLength pathLength{0};                                ///< QueryPath: requested length
+    std::string algorithm = "dfs";                           ///< QueryPath: registry name of the engine
+    MaxStartingPoints maxStartingPoints;                     ///< QueryPath: starting points limit
+    uint32_t deadlineMillis = 0;                             ///< QueryPath: time budget from receipt (0 = none)
+    uint32_t targetId = 0;                                   ///< Cancel: id of the query to cancel
+};
+
+/**
+ * @struct ServiceResponse
+ * @brief Decoded response
+ *
+ * Payload: uint32 request id, uint8 status, uint32 search microseconds,
+ * uint64 world version, string message, uint32 count, count × (uint16 row,
+ * uint16 col) path cells.
+ */
+struct ServiceResponse
+{
+    uint32_t requestId = 0;                       ///< Id of the answered request
+    ResponseStatus status = ResponseStatus::Error; ///< Outcome
+    uint32_t micros = 0;                          ///< QueryPath: search time
+    uint64_t worldVersion = 0;                    ///< Version of the world the request saw
+    std::string message;                          ///< Reason of failures and infeasible queries
+    Path path;                                    ///< Found path (empty otherwise)
+};
+
+/**
+ * @brief Encodes a request as a complete frame
+ * @param request Request to encode
+ * @return Length prefix and payload
+ * @throws std::invalid_argument If a string or the cell list does not fit its length field
+ */
+[[nodiscard]] std::string encodeRequest(const ServiceRequest &request);
+
+/**
+ * @brief Decodes a request payload
+ * @param payload Frame payload (without the length prefix)
+ * @return Decoded request
+ * @throws std::invalid_argument If the payload is truncated, has trailing bytes or an unknown type
+ */
+[[nodiscard]] ServiceRequest decodeRequest(std::string_view payload);
+
+/**
+ * @brief Encodes a response as a complete frame
+ * @param response Response to encode
+ * @return Length prefix and payload
+ */
+[[nodiscard]] std::string encodeResponse(const ServiceResponse &response);
+
+/**
+ * @brief Decodes a response payload
+ * @param payload Frame payload (without the length prefix)
+ * @return Decoded response
+ * @throws std::invalid_argument If the payload is truncated, has trailing bytes or an unknown status
+ */
+[[nodiscard]] ServiceResponse decodeResponse(std::string_view payload);
+
+/**
+ * @brief Reads one frame
+ * @param fd Connected socket
+ * @param payload Receives the payload
+ * @return false on end of stream before the first byte of a frame
+ * @throws std::runtime_error If reading fails or the stream ends inside a frame
+ * @throws std::invalid_argument If the length exceeds MAX_FRAME_BYTES
+ */
+bool readFrame(int fd, std::string &payload);
+
+/**
+ * @brief Writes one complete frame
+ * @param fd Connected socket
+ * @param frame Encoded frame
+ * @throws std::runtime_error If writing fails (including a closed peer, no SIGPIPE is raised)
+ */
+void writeFrame(int fd, std::string_view frame);
+
+/**
+ * @brief Gets the wire name of a response status
+ * @param status Response status
+ * @return Lower case name ("found", "timed_out", ...)
+ */
+[[nodiscard]] const char *responseStatusName(ResponseStatus status);
+
+/**
+ * @class PathService
+ * @brief Daemon keeping named worlds resident and answering requests from a worker pool
+ *
+ * Each connection gets a reader thread that decodes frames; Cancel requests
+ * are handled by the reader at once, all others are queued for the workers.
+ * Responses carry the request id and may arrive out of order.
+ *
+ * Resident worlds are immutable snapshots (CachedWorld): a mutation copies
+ * the world, applies the cells and publishes the copy, so queries never wait
+ * for mutations and running queries keep the snapshot they started with.
+ * Untouched snapshots keep their version, so the shared version-keyed
+ * indexes (candidate rankings, CSR graphs) are reused across queries. A
+ * mutated snapshot patches its candidate rankings from the previous one.
+ *
+ * Every query gets a cancellation flag attached to its engine. A deadline
+ * thread raises the flags of queries whose deadline passed; Cancel requests
+ * and closed connections raise them too. A query cancelled before a worker
+ * picks it up is answered without running.
+ */
+class PathService
+{
+    struct Connection;
+    struct ActiveQuery;
+    struct Task;
+
+    /// Pending deadlines, earliest first
+    using DeadlineQueue = std::multimap<std::chrono::steady_clock::time_point, std::weak_ptr<ActiveQuery>>;
+
+    /**
+     * @struct ResidentWorld
+     * @brief Named world: published snapshot plus a lock serialising its mutations
+     */
+    struct ResidentWorld
+    {
+        std::mutex writeMutex;                      ///< Held while a mutation builds the next snapshot
+        std::shared_ptr<const CachedWorld> snapshot; ///< Current snapshot, guarded by PathService::stateMutex
+    };
+
+    std::string socketPath;          ///< Filesystem path of the listening socket
+    unsigned threadCount;            ///< Worker threads
+    int listenFd = -1;               ///< Listening socket (-1 if stopped)
+    bool running = false;            ///< Between start() and stop()
+
+    std::mutex stateMutex;                                                ///< Guards everything below
+    std::condition_variable taskReady;                                    ///< Signals queued tasks and stop
+    std::condition_variable deadlineChanged;                              ///< Signals new deadlines and stop
+    std::deque<Task> tasks;                                               ///< Queued requests
+    std::map<std::string, std::shared_ptr<ResidentWorld>> worlds;         ///< Resident worlds by name
+    std::map<std::pair<const Connection *, uint32_t>, std::shared_ptr<ActiveQuery>> activeQueries; ///< Queued and running queries
+    DeadlineQueue deadlines;                                              ///< Deadlines of queued and running queries
+    std::vector<std::shared_ptr<Connection>> connections;                 ///< Open connections
+    bool stopping = false;                                                ///< Set by stop()
+
+    std::thread acceptThread;          ///< Accepts connections
+    std::thread deadlineThread;        ///< Raises the flags of overdue queries
+    std::vector<std::thread> workers;  ///< Worker pool
+
+    void acceptLoop();
+    void readLoop(const std::shared_ptr<Connection> &connection);
+    void deadlineLoop();
+    void workLoop();
+    void respond(Connection &connection, const ServiceResponse &response);
+    [[nodiscard]] ServiceResponse cancel(const Connection &connection, const ServiceRequest &request);
+    [[nodiscard]] ServiceResponse loadWorld(const ServiceRequest &request);
+    [[nodiscard]] ServiceResponse mutateCells(const ServiceRequest &request);
+    [[nodiscard]] ServiceResponse queryPath(const ServiceRequest &request, ActiveQuery &query,
+                                            std::map<std::string, std::unique_ptr<PathAlgorithm>> &engines);
+    [[nodiscard]] std::shared_ptr<ResidentWorld> findWorld(const std::string &name);
+
+public:
+    /**
+     * @brief Creates a stopped service
+     * @param socketPath Filesystem path to listen on (replaced if it exists)
+     * @param threadCount Worker threads (0 = hardware concurrency)
+     */
+    explicit PathService(std::string socketPath, unsigned threadCount = 0);
+
+    /**
+     * @brief Stops the service if running
+     */
+    ~PathService();
+
+    PathService(const PathService &) = delete;
+    PathService &operator=(const PathService &) = delete;
+
+    /**
+     * @brief Binds the socket and starts the accept, deadline and worker threads
+     * @throws std::runtime_error If the socket cannot be created, bound or listened on
+     */
+    void start();
+
+    /**
+     * @brief Closes the socket and every connection, cancels the queries and joins all threads
+     *
+     * Queued requests are dropped without a response. Safe to call twice.
+     */
+    void stop();
+
+    /**
+     * @brief Gets the number of resident worlds
+     */
+    [[nodiscard]] size_t getWorldCount();
+
+    /**
+     * @brief Gets the number of deadlines of queued and running queries
+     */
+    [[nodiscard]] size_t getPendingDeadlineCount();
+};
+
+#endif
@@ -0,0 +1,28 @@
+/**
+ * @file path_validation.hpp
+ * @brief Validation of path finding results against a world
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef PATH_VALIDATION_H
+#define PATH_VALIDATION_H
+
+#include "Ipath_algorithm.hpp"
+#include "matrix_utils.hpp"
+#include "path.hpp"
+
+/**
+ * @brief Checks that a path is a valid answer to a path finding query
+ * @param matrixWorld World the path was searched in
+ * @param path Candidate result
+ * @param pathLength Requested path length
+ * @return true if the path has the requested length, is contiguous, stays on
+ *         unblocked cells inside the matrix and never visits a cell twice
+ *
+ * Complexity: O(L) time plus O(N×M) bits for the visited set.
+ */
+[[nodiscard]] bool isViablePath(const MatrixWorld &matrixWorld, const Path &path, PathLength pathLength);
+
+#endif
@@ -9,48 +9,216 @@
 #ifndef PERFORMANCE_MEASURE_HPP
 #define PERFORMANCE_MEASURE_HPP
 
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <linux/perf_event.h>
+#include <optional>
+#include <ostream>
 #include <sys/syscall.h>
 #include <unistd.h>
 
 /**
  * @class PerformanceMeasure
- * @brief A utility class for measuring code execution time and CPU cycles.
+ * @brief A utility class for measuring code execution time and CPU counters.
  * * This class uses high-resolution clocks and the Linux perf_event_open
  * syscall to provide precise measurements of a code block's performance.
+ * The counters (see Counter) are opened as one perf event group, so they
+ * are scheduled on the PMU together and read atomically with a single
+ * PERF_FORMAT_GROUP read. Counters the CPU or kernel does not support are
+ * left out of the group and reported as unavailable. Only the calling
+ * thread is counted.
+ *
+ * Measuring never terminates the process. When perf events are not
+ * permitted, measurement degrades tier by tier (see Tier): user-space-only
+ * counters, then the thread CPU clock and the time stamp counter, then wall
+ * time alone. The tier in use is part of every report.
  * It is designed to be used with a PerformanceMeasureGuard for RAII-style
  * measurement.
  */
 class PerformanceMeasure
 {
+public:
+    /**
+     * @enum Counter
+     * @brief The events counted by the perf event group, in opening order.
+     */
+    enum class Counter : uint8_t
+    {
+        Cycles,          ///< CPU cycles
+        Instructions,    ///< Retired instructions
+        CacheReferences, ///< Last level cache accesses
+        CacheMisses,     ///< Last level cache misses
+        BranchMisses,    ///< Mispredicted branches
+        L1dReadMisses,   ///< L1 data cache read misses
+        TaskClock,       ///< CPU time of the thread, in nanoseconds
+        PageFaults       ///< Page faults
+    };
+
+    /**
+     * @brief The number of counters in the group.
+     */
+    static constexpr size_t COUNTER_COUNT = 8;
+
+    /**
+     * @enum Tier
+     * @brief The measurement methods, most detailed first.
+     */
+    enum class Tier : uint8_t
+    {
+        PerfCounters,      ///< perf event group counting user and kernel space
+        UserSpaceCounters, ///< perf event group with exclude_kernel and exclude_hv (perf_event_paranoid 2)
+        ThreadClock,       ///< CLOCK_THREAD_CPUTIME_ID as task clock plus time stamp counter ticks, no perf events
+        WallTime           ///< Wall time only
+    };
+
+    /**
+     * @brief Returns the report name of a tier.
+     * @param tier Measurement tier.
+     * @return Human readable name.
+     */
+    [[nodiscard]] static const char *tierName(Tier tier);
+
+    /**
+     * @struct Measures
+     * @brief A struct to hold the measured time, counter values and derived metrics.
+     */
+    struct Measures
+    {
+        /**
+         * @brief The elapsed time (microseconds when printed, milliseconds when saved).
+         */
+        uint64_t timeCount;
+
+        /**
+         * @brief The number of CPU cycles (0 if not counted).
+         */
+        uint64_t cycleCount;
+
+        /**
+         * @brief The value of every counter, scaled if the group was multiplexed.
+         */
+        std::array<uint64_t, COUNTER_COUNT> counters;
+
+        /**
+         * @brief Whether each counter was counted.
+         */
+        std::array<bool, COUNTER_COUNT> counted;
+
+        /**
+         * @brief The share of the measurement the group was on the PMU (1 if never multiplexed).
+         */
+        double runningShare;
+
+        /**
+         * @brief The time stamp counter ticks (Tier::ThreadClock on x86 only).
+         */
+        std::optional<uint64_t> tscTicks;
+
+        /**
+         * @brief The tier the measurement ran at.
+         */
+        Tier tier;
+
+        /**
+         * @brief The errno that made measurement fall below Tier::PerfCounters (0 if it did not).
+         */
+        int fallbackError;
+
+        /**
+         * @brief Returns the value of a counter.
+         * @param counter Counter to read.
+         * @return The value, or std::nullopt if the counter was not counted.
+         */
+        [[nodiscard]] std::optional<uint64_t> get(Counter counter) const;
+
+        /**
+         * @brief Returns instructions per cycle.
+         * @return IPC, or std::nullopt if either counter is missing or zero cycles were counted.
+         */
+        [[nodiscard]] std::optional<double> getInstructionsPerCycle() const;
+
+        /**
+         * @brief Returns the share of cache references that missed.
+         * @return Miss rate in [0, 1], or std::nullopt if unavailable.
+         */
+        [[nodiscard]] std::optional<double> getCacheMissRate() const;
+
+        /**
+         * @brief Returns the branch misses per thousand instructions.
+         * @return MPKI, or std::nullopt if unavailable.
+         */
+        [[nodiscard]] std::optional<double> getBranchMissesPerKiloInstruction() const;
+
+        /**
+         * @brief Returns the L1 data cache read misses per thousand instructions.
+         * @return MPKI, or std::nullopt if unavailable.
+         */
+        [[nodiscard]] std::optional<double> getL1dMissesPerKiloInstruction() const;
+    };
+
 private:
     /**
      * @brief The start time point for the measurement.
      */
     std::chrono::time_point<std::chrono::high_resolution_clock> startTime;
-    
+
     /**
      * @brief The end time point for the measurement.
      */
     std::chrono::time_point<std::chrono::high_resolution_clock> stopTime;
-    
+
     /**
-     * @brief The number of CPU cycles counted during the measurement.
+     * @brief The file descriptor of each counter (-1 if it could not be opened).
      */
-    uint64_t cycleCount;
-    
+    std::array<int32_t, COUNTER_COUNT> counterFileDescs;
+
     /**
-     * @brief The configuration for the perf event cycle counter.
+     * @brief The kernel id of each opened counter, matched against the group read.
      */
-    perf_event_attr cycleCounterS = {};
-    
+    std::array<uint64_t, COUNTER_COUNT> counterIds = {};
+
+    /**
+     * @brief The counter values of the last measurement.
+     */
+    Measures lastMeasures = {};
+
     /**
-     * @brief The file descriptor for the perf event counter.
+     * @brief The file descriptor of the perf event group leader (-1 if none).
      */
     int32_t perfFileDesc;
-    
+
+    /**
+     * @brief The tier of the running or last measurement.
+     */
+    Tier activeTier = Tier::WallTime;
+
+    /**
+     * @brief The most detailed tier this instance may use.
+     */
+    Tier tierLimit = Tier::PerfCounters;
+
+    /**
+     * @brief The errno of the perf tier failure behind the active tier (0 if none).
+     */
+    int activeFallbackError = 0;
+
+    /**
+     * @brief Whether measureStart() and measureStop() announce themselves on stdout.
+     */
+    bool progressMessages = true;
+
+    /**
+     * @brief The thread CPU time at the start (Tier::ThreadClock), in nanoseconds.
+     */
+    uint64_t startThreadNanos = 0;
+
+    /**
+     * @brief The time stamp counter at the start (Tier::ThreadClock).
+     */
+    uint64_t startTicks = 0;
+
     /**
      * @brief A helper function to open a perf event.
      * @param attr Pointer to a perf_event_attr structure.
@@ -67,57 +235,100 @@ private:
         return syscall(__NR_perf_event_open, attr, pid, cpu, group_fd, flags);
     }
 
-public:
     /**
-     * @struct Measures
-     * @brief A struct to hold the measured time and cycle counts.
+     * @brief Closes every counter of the group.
      */
-    struct Measures
-    {
-        /**
-         * @brief The elapsed time in microseconds.
-         */
-        uint64_t timeCount;
-        
-        /**
-         * @brief The number of CPU cycles.
-         */
-        uint64_t cycleCount;
-    };
-    
+    void closeCounters();
+
+    /**
+     * @brief Opens the counters the machine supports as one group.
+     * @param userSpaceOnly Whether to exclude kernel and hypervisor counting.
+     * @return 0 if at least one counter opened, else the errno of the first failure.
+     */
+    int openCounterGroup(bool userSpaceOnly);
+
+public:
     /**
      * @brief Constructs a new PerformanceMeasure object.
      *
-     * Initializes the perf event attributes and opens the perf event file
-     * descriptor to prepare for cycle counting.
+     * No counter is open until measureStart().
      */
     PerformanceMeasure();
 
+    /**
+     * @brief Closes any counter left open.
+     */
+    ~PerformanceMeasure();
+
+    /**
+     * @brief Copies only the last measures; counters are never shared.
+     * @param other Instance to copy.
+     */
+    PerformanceMeasure(const PerformanceMeasure &other);
+
+    /**
+     * @brief Copies only the last measures; counters are never shared.
+     * @param other Instance to copy.
+     * @return A reference to this instance.
+     */
+    PerformanceMeasure &operator=(const PerformanceMeasure &other);
+
+    /**
+     * @brief Limits the tiers this instance may use.
+     * @param tier The most detailed tier allowed (default: Tier::PerfCounters).
+     *
+     * Lets a process opt out of perf events, or tests exercise lower tiers.
+     */
+    void setTierLimit(Tier tier);
+
+    /**
+     * @brief Enables or disables the start and stop messages on stdout.
+     * @param enabled false for callers whose stdout carries structured output.
+     */
+    void setProgressMessages(bool enabled);
+
+    /**
+     * @brief Returns the tier of the running or last measurement.
+     * @return Measurement tier (Tier::WallTime before the first measurement).
+     */
+    [[nodiscard]] Tier getTier() const;
+
     /**
      * @brief Starts the performance measurement.
      *
-     * Resets the cycle counter and records the current time.
+     * Selects the most detailed working tier, opens and enables the counter
+     * group or samples the clocks, and records the current time. Never fails.
      */
     void measureStart();
-    
+
     /**
      * @brief Stops the performance measurement.
      *
-     * Records the stop time and reads the final cycle count from the
-     * perf event counter.
+     * Records the stop time, reads every counter of the group at once (or
+     * the clocks of the lower tiers) and closes the group.
      */
     void measureStop();
-    
+
     /**
-     * @brief Prints the measured time and cycle counts to the console.
+     * @brief Prints the measured time, counters and derived metrics to the console.
      */
     void printMeasurements();
-    
+
+    /**
+     * @brief Writes a measure summary: time, counters and derived metrics.
+     * @param stream Output stream.
+     * @param measures Measures with timeCount in microseconds.
+     *
+     * Counters that were not counted are shown as "n/a", and so are the
+     * metrics derived from them.
+     */
+    static void printMeasures(std::ostream &stream, const Measures &measures);
+
     /**
-     * @brief Saves the measured time and cycle counts to a Measures struct.
-     * @return A Measures struct containing the final time and cycle counts.
+     * @brief Saves the measured time and counters to a Measures struct.
+     * @return A Measures struct containing the final time (in milliseconds) and counters.
      */
     Measures saveMeasures();
 };
 
-#endif // PERFORMANCE_MEASURE_HPP
\ No newline at end of file
+#endif // PERFORMANCE_MEASURE_HPP
@@ -0,0 +1,79 @@
+/**
+ * @file portfolio_algorithm.hpp
+ * @brief Portfolio of path finding engines raced concurrently
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef PORTFOLIO_ALGORITHM_H
+#define PORTFOLIO_ALGORITHM_H
+
+#include "Ipath_algorithm.hpp"
+#include "matrix_utils.hpp"
+#include "path.hpp"
+#include <string>
+#include <vector>
+
+/**
+ * @class PortfolioAlgorithm
+ * @brief Runs several registered engines on separate threads, first valid result wins
+ *
+ * Every engine gets its own instance and thread and searches the same const
+ * MatrixWorld. The first result that passes isViablePath() is returned and
+ * all other engines are cancelled through a shared cancellation flag. An empty
+ * result from a complete engine also ends the race, since it proves that no
+ * path exists. The winning engine is recorded in the AlgorithmRegistry so the
+ * automatic selection can learn which engines win on which kind of world.
+ *
+ * Example usage:
+ * @code
+ * PortfolioAlgorithm portfolio({"dfs", "auto"});
+ * Path result = portfolio.findViablePath(world, {12}, {5});
+ * std::cout << portfolio.getLastWinner() << std::endl;
+ * @endcode
+ */
+class PortfolioAlgorithm : public PathAlgorithm
+{
+private:
+    std::vector<std::string> engineNames; ///< Engines to race (empty = all applicable engines)
+    std::string lastWinner;               ///< Engine that produced the last result
+
+public:
+    /**
+     * @brief Constructs a portfolio racing the given engines
+     * @param engineNames Registry names of the engines to race; when empty, all
+     *        engines applicable to the query (per AlgorithmRegistry::selectEngines) are raced
+     * @throws std::invalid_argument If "portfolio" itself is listed
+     */
+    explicit PortfolioAlgorithm(std::vector<std::string> engineNames = {});
+
+    /**
+     * @brief Races the engines and returns the first valid path
+     * @param matrixWorld Reference to the matrix world (shared read-only by all threads)
+     * @param pathLength Target path length wrapped in PathLength struct
+     * @param maxStartingPoints Maximum starting points forwarded to the engines
+     * @return Path object containing the found path (empty if none found)
+     * @throws std::invalid_argument If pathLength.value is zero or exceeds matrix size
+     */
+    [[nodiscard]] Path findViablePath(const MatrixWorld &matrixWorld,
+                                      PathLength pathLength,
+                                      MaxStartingPoints maxStartingPoints = {}) override;
+
+    /** @brief Returns the name of the algorithm */
+    [[nodiscard]] std::string getAlgorithmName() const override
+    {
+        return "Concurrent Engine Portfolio";
+    }
+
+    /**
+     * @brief Gets the engine that won the last race
+     * @return Registry name of the winner, empty if no engine produced a result
+     */
+    [[nodiscard]] const std::string &getLastWinner() const
+    {
+        return lastWinner;
+    }
+};
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ * @file result_output.hpp
+ * @brief Machine-readable query results: JSON lines and CSV
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef RESULT_OUTPUT_H
+#define RESULT_OUTPUT_H
+
+#include "Ipath_algorithm.hpp"
+#include "path.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Format of the query results on standard output
+ */
+enum class OutputFormat : uint8_t
+{
+    Text, ///< Human-oriented text with the parameter echo
+    Json, ///< One JSON object per query and line, no echo
+    Csv   ///< A header line, then one row per query, no echo
+};
+
+/**
+ * @brief Encoding of the path in JSON records
+ */
+enum class PathEncoding : uint8_t
+{
+    Inline, ///< "path":[[row,col],...]
+    Compact ///< "path":{"start":[row,col],"moves":"RRDL..."}, one letter per step
+};
+
+/**
+ * @struct PhaseTimings
+ * @brief Wall time of the phases of one query, in microseconds
+ *
+ * Phases a mode does not run (e.g. world loading in batch mode, where worlds
+ * are shared) stay zero.
+ */
+struct PhaseTimings
+{
+    double loadMicros = 0.0;        ///< World creation and blocked cells
+    double feasibilityMicros = 0.0; ///< checkPathFeasibility()
+    double searchMicros = 0.0;      ///< findViablePath()
+    double totalMicros = 0.0;       ///< Whole query, output excluded
+};
+
+/**
+ * @struct QueryRecord
+ * @brief Everything reported for one query
+ */
+struct QueryRecord
+{
+    std::optional<size_t> job;   ///< Job index in batch mode
+    std::string status;          ///< "found", "not_found", "infeasible" or "failed"
+    std::string algorithm;       ///< Registry name of the engine
+    std::string world;           ///< World reference or file (empty for --rows/--cols worlds)
+    uint16_t rows = 0;           ///< World rows
+    uint16_t cols = 0;           ///< World columns
+    size_t blockedCells = 0;     ///< Blocked cells of the world
+    PathLength pathLength{0};    ///< Requested length
+    Path path;                   ///< Found path (empty otherwise)
+    std::string reason;          ///< Why the query was infeasible or failed
+    PhaseTimings timings;        ///< Phase timings
+
+    /// Counters of the search with --enableMeasurement (std::nullopt otherwise)
+    std::optional<PerformanceMeasure::Measures> counters;
+};
+
+/**
+ * @brief Parses an output format name
+ * @param name "text", "json" or "csv"
+ * @return Matching format
+ * @throws std::invalid_argument If the name is unknown
+ */
+[[nodiscard]] OutputFormat parseOutputFormat(std::string_view name);
+
+/**
+ * @brief Parses a path encoding name
+ * @param name "inline" or "compact"
+ * @return Matching encoding
+ * @throws std::invalid_argument If the name is unknown
+ */
+[[nodiscard]] PathEncoding parsePathEncoding(std::string_view name);
+
+/**
+ * @brief Encodes a path as one move letter per step
+ * @param path Contiguous path
+ * @return 'U', 'D', 'L' or 'R' for each step after the first cell ('?' for a non-adjacent step)
+ */
+[[nodiscard]] std::string encodeMoves(const Path &path);
+
+/**
+ * @brief Appends a record as one JSON object and a newline
+ * @param output Buffer to append to
+ * @param record Query record
+ * @param encoding Path encoding
+ */
+void appendJsonRecord(std::string &output, const QueryRecord &record, PathEncoding encoding);
+
+/**
+ * @brief Appends the CSV header line
+ * @param output Buffer to append to
+ */
+void appendCsvHeader(std::string &output);
+
+/**
+ * @brief Appends a record as one CSV row; the path is always compact (start, moves)
+ * @param output Buffer to append to
+ * @param record Query record
+ */
+void appendCsvRecord(std::string &output, const QueryRecord &record);
+
+/**
+ * @brief Writes a record in the given format with a single stream write
+ * @param stream Output stream
+ * @param record Query record
+ * @param format OutputFormat::Json or OutputFormat::Csv (Text writes nothing)
+ * @param encoding Path encoding of JSON records
+ */
+void writeRecord(std::ostream &stream, const QueryRecord &record, OutputFormat format, PathEncoding encoding);
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file start_scoring.hpp
+ * @brief Weighted multi-criteria scoring of starting point candidates
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef START_SCORING_H
+#define START_SCORING_H
+
+#include "matrix_utils.hpp"
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * @struct StartScoringWeights
+ * @brief Weights of the criteria combined into a starting point score
+ *
+ * Every criterion is quantized to a level in [0, FEATURE_LEVELS] - the same
+ * range as the neighbour count - and the score of a free cell is the weighted
+ * sum of its levels. Criteria with weight zero are not computed at all.
+ *
+ * The default weights rank by neighbour count alone.
+ */
+struct StartScoringWeights
+{
+    /// Highest level of a single criterion
+    static constexpr uint16_t FEATURE_LEVELS = 4;
+
+    /// Radius of the square window measured by the local free-area criterion
+    static constexpr uint16_t LOCAL_AREA_RADIUS = 2;
+
+    uint8_t degree = 1;          ///< Unblocked neighbour count (0-4)
+    uint8_t componentSize = 0;   ///< Size of the cell's component relative to the largest one
+    uint8_t localArea = 0;       ///< Free share of the (2r+1)² window around the cell
+    uint8_t deadEndDistance = 0; ///< Steps to the nearest dead end (degree 0-1), capped
+    uint8_t endpoint = 0;        ///< Full level for degree-1 cells, natural path ends
+
+    /**
+     * @brief Weights favouring open, well-connected areas
+     * @return Preset combining degree, component size and local free area
+     */
+    [[nodiscard]] static constexpr StartScoringWeights openArea() { return {2, 2, 1, 1, 0}; }
+
+    /**
+     * @brief Weights favouring dead ends as path endpoints
+     * @return Preset ranking degree-1 cells of large components first
+     */
+    [[nodiscard]] static constexpr StartScoringWeights endpoints() { return {0, 2, 0, 0, 2}; }
+
+    /** @brief Returns the highest score reachable with these weights */
+    [[nodiscard]] constexpr uint16_t getMaxScore() const
+    {
+        return static_cast<uint16_t>(FEATURE_LEVELS * (degree + componentSize + localArea + deadEndDistance + endpoint));
+    }
+
+    /** @brief Checks whether the score is the plain neighbour count */
+    [[nodiscard]] constexpr bool isDegreeOnly() const
+    {
+        return degree == 1 && componentSize == 0 && localArea == 0 && deadEndDistance == 0 && endpoint == 0;
+    }
+
+    /** @brief Compares all weights */
+    constexpr bool operator==(const StartScoringWeights &other) const
+    {
+        return degree == other.degree && componentSize == other.componentSize && localArea == other.localArea &&
+               deadEndDistance == other.deadEndDistance && endpoint == other.endpoint;
+    }
+};
+
+/// Score of blocked cells in computeStartScores()
+constexpr uint16_t NO_START_SCORE = std::numeric_limits<uint16_t>::max();
+
+/**
+ * @brief Computes the weighted score of every cell
+ * @param matrixWorld World to score
+ * @param degrees Neighbour count per cell in row-major order; values above
+ *        FEATURE_LEVELS mark blocked cells
+ * @param weights Criteria weights
+ * @return Score per cell in row-major order, NO_START_SCORE for blocked cells
+ *
+ * Each enabled criterion costs one linear pass (component labelling,
+ * summed-area table, multi-source BFS) over the matrix.
+ */
+[[nodiscard]] std::vector<uint16_t> computeStartScores(const MatrixWorld &matrixWorld,
+                                                       const std::vector<uint8_t> &degrees,
+                                                       const StartScoringWeights &weights);
+
+#endif
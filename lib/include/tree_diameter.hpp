@@ -0,0 +1,64 @@
+/**
+ * @file tree_diameter.hpp
+ * @brief Guaranteed simple path from the diameter of a spanning tree
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef TREE_DIAMETER_H
+#define TREE_DIAMETER_H
+
+#include "Ipath_algorithm.hpp"
+#include "matrix_utils.hpp"
+#include "path.hpp"
+#include <string>
+
+/**
+ * @class TreeDiameterAlgorithm
+ * @brief O(N×M) lower bound on the longest simple path of a world
+ *
+ * Builds a depth-first spanning tree of every connected component and takes
+ * the diameter of each tree with two breadth-first passes restricted to tree
+ * edges. A tree diameter is a simple path of the grid, so the longest one is
+ * a path that exists for sure. On open areas the depth-first tree snakes
+ * through the rows and its diameter covers most of the component.
+ * The passes run on the world's shared CsrGraph (CsrGraph::getShared()).
+ *
+ * Used as a preprocessing stage: requests that fit within the diameter are
+ * answered immediately, longer ones use the diameter as the seed of the
+ * local search (see LocalSearchAlgorithm).
+ */
+class TreeDiameterAlgorithm : public PathAlgorithm
+{
+public:
+    /**
+     * @brief Computes the longest spanning tree diameter over all components
+     * @param matrixWorld Reference to the matrix world
+     * @return Diameter path (empty if the matrix has no free cell)
+     *
+     * Complexity: O(N×M) time and memory.
+     */
+    [[nodiscard]] static Path computeDiameterPath(const MatrixWorld &matrixWorld);
+
+    /**
+     * @brief Answers the request from the tree diameter
+     * @param matrixWorld Reference to the matrix world
+     * @param pathLength Target path length wrapped in PathLength struct
+     * @param maxStartingPoints Unused - the diameter does not depend on starting points
+     * @return Prefix of the diameter path of the requested length, or an empty
+     *         path if the diameter is shorter than the request
+     * @throws std::invalid_argument If pathLength.value is zero or exceeds matrix size
+     */
+    [[nodiscard]] Path findViablePath(const MatrixWorld &matrixWorld,
+                                      PathLength pathLength,
+                                      MaxStartingPoints maxStartingPoints = {}) override;
+
+    /** @brief Returns the name of the algorithm */
+    [[nodiscard]] std::string getAlgorithmName() const override
+    {
+        return "Spanning Tree Diameter";
+    }
+};
+
+#endif
@@ -0,0 +1,93 @@
+/**
+ * @file versioned_cache.hpp
+ * @brief Small thread-safe cache of structures derived from a world version
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef VERSIONED_CACHE_H
+#define VERSIONED_CACHE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class VersionedCache
+ * @brief Most-recently-used list of read-only values keyed by world version
+ * @tparam Value Cached type, shared as std::shared_ptr<const Value>
+ * @tparam Key Additional build parameter distinguishing values of one version
+ *
+ * Values are built outside the lock, so concurrent callers may occasionally
+ * build the same value twice; only the first one stored is kept and returned
+ * to everyone. Since MatrixWorld versions are unique per content, stale
+ * entries are never returned - they simply age out.
+ */
+template <typename Value, typename Key = uint8_t>
+class VersionedCache
+{
+private:
+    struct Entry
+    {
+        uint64_t version;
+        Key key;
+        std::shared_ptr<const Value> value;
+    };
+
+    std::mutex cacheMutex;      ///< Guards entries
+    std::vector<Entry> entries; ///< Least recently used first
+    size_t capacity;            ///< Maximum number of entries
+
+public:
+    /**
+     * @brief Creates an empty cache
+     * @param capacity Maximum number of values kept
+     */
+    explicit VersionedCache(size_t capacity) : capacity(capacity) {}
+
+    /**
+     * @brief Returns the cached value or builds and stores a new one
+     * @param version World version the value derives from
+     * @param key Additional build parameter
+     * @param build Callable returning std::shared_ptr<const Value>
+     * @return Shared read-only value
+     */
+    template <typename Builder>
+    std::shared_ptr<const Value> getOrBuild(uint64_t version, const Key &key, Builder build)
+    {
+        auto matches = [&](const Entry &entry) { return entry.version == version && entry.key == key; };
+
+        {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            auto entry = std::find_if(entries.begin(), entries.end(), matches);
+            if (entry != entries.end())
+            {
+                Entry found = *entry;
+                entries.erase(entry);
+                entries.push_back(found);
+                return found.value;
+            }
+        }
+
+        std::shared_ptr<const Value> value = build();
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto entry = std::find_if(entries.begin(), entries.end(), matches);
+        if (entry != entries.end())
+        {
+            return entry->value; // Built concurrently by another caller
+        }
+        if (entries.size() >= capacity)
+        {
+            entries.erase(entries.begin());
+        }
+        entries.push_back({version, key, value});
+        return value;
+    }
+};
+
+#endif
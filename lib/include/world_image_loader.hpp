@@ -0,0 +1,119 @@
+/**
+ * @file world_image_loader.hpp
+ * @brief MatrixWorld loaders for binary PBM and PGM occupancy images
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef WORLD_IMAGE_LOADER_H
+#define WORLD_IMAGE_LOADER_H
+
+#include "matrix_utils.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/// Default occupancy above which a PGM pixel is blocked
+constexpr double DEFAULT_OCCUPIED_THRESHOLD = 0.5;
+
+/**
+ * @brief Decodes a binary PBM (P4) or PGM (P5) image into a world
+ * @param image Image file contents
+ * @param occupiedThreshold PGM only: a pixel is blocked when its occupancy
+ *        (maxval - value) / maxval is above this value (0-1)
+ * @return World with one row per image line and one column per pixel
+ * @throws std::invalid_argument If the data is not a supported image, is
+ *         truncated, or its width or height is zero or above 65535
+ *
+ * Occupancy images are dark where space is occupied: PBM black pixels (bit 1)
+ * and dark PGM pixels become blocked cells. PBM rows are packed straight into
+ * the world's row words (bit order reversed per byte); 8-bit PGM rows are
+ * thresholded 16 pixels at a time with SSE2 where available.
+ */
+[[nodiscard]] MatrixWorld loadWorldImage(std::string_view image,
+                                         double occupiedThreshold = DEFAULT_OCCUPIED_THRESHOLD);
+
+/**
+ * @brief Loads a binary PBM (P4) or PGM (P5) image file into a world
+ * @param filePath Path of the image file
+ * @param occupiedThreshold PGM only: occupancy above which a pixel is blocked
+ * @return Decoded world
+ * @throws std::runtime_error If the file cannot be opened or mapped
+ * @throws std::invalid_argument If the file is not a supported image (see loadWorldImage)
+ */
+[[nodiscard]] MatrixWorld loadWorldImageFile(const std::string &filePath,
+                                             double occupiedThreshold = DEFAULT_OCCUPIED_THRESHOLD);
+
+/**
+ * @struct ImageHeader
+ * @brief Parsed header of a binary PBM or PGM image
+ */
+struct ImageHeader
+{
+    char format = 0;       ///< '4' for PBM, '5' for PGM
+    uint16_t width = 0;    ///< Pixels per row
+    uint16_t height = 0;   ///< Rows
+    uint32_t maxValue = 1; ///< Largest grey value (PGM)
+    size_t dataOffset = 0; ///< Offset of the raster from the start of the image
+
+    /**
+     * @brief Bytes of one raster row
+     */
+    [[nodiscard]] size_t getRowBytes() const
+    {
+        if (format == '4')
+        {
+            return (static_cast<size_t>(width) + 7) / 8;
+        }
+        return static_cast<size_t>(width) * (maxValue > 255 ? 2 : 1);
+    }
+};
+
+/**
+ * @brief Parses the header of a binary PBM (P4) or PGM (P5) image
+ * @param image Image contents, or any prefix of them holding the whole header
+ * @return Parsed header
+ * @throws std::invalid_argument If the header is malformed, unsupported or
+ *         incomplete (a prefix ending inside the header is rejected, never
+ *         misread)
+ */
+[[nodiscard]] ImageHeader parseImageHeader(std::string_view image);
+
+/**
+ * @brief Grey value below which a PGM pixel is blocked
+ * @param header Image header
+ * @param occupiedThreshold Occupancy above which a pixel is blocked (0-1)
+ * @return ceil(maxval × (1 - occupiedThreshold)); unused for PBM
+ * @throws std::invalid_argument If the threshold is not between 0 and 1
+ */
+[[nodiscard]] uint32_t occupancyCutoff(const ImageHeader &header, double occupiedThreshold);
+
+/**
+ * @brief Decodes one raster row into world row words
+ * @param header Image header
+ * @param row header.getRowBytes() bytes of the row
+ * @param cutoff Result of occupancyCutoff() (PGM only)
+ * @param words Output, (width + 63) / 64 words; bits past width are undefined
+ */
+void packImageRow(const ImageHeader &header, const uint8_t *row, uint32_t cutoff, uint64_t *words);
+
+/**
+ * @brief Packs one PBM row into world row words
+ * @param bytes (cols + 7) / 8 bytes, most significant bit first, 1 = black
+ * @param cols Pixels in the row
+ * @param words Output, (cols + 63) / 64 words; bit (col % 64) of word
+ *        (col / 64) is set for black pixels, bits past cols are undefined
+ */
+void packPbmRow(const uint8_t *bytes, uint16_t cols, uint64_t *words);
+
+/**
+ * @brief Thresholds one 8-bit PGM row into world row words
+ * @param pixels cols grey values
+ * @param cols Pixels in the row
+ * @param cutoff Pixels with a value below cutoff are set (0-256)
+ * @param words Output, (cols + 63) / 64 words; bits past cols are zero
+ */
+void packPgmRow(const uint8_t *pixels, uint16_t cols, uint16_t cutoff, uint64_t *words);
+
+#endif
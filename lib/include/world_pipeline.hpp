@@ -0,0 +1,73 @@
+/**
+ * @file world_pipeline.hpp
+ * @brief Pipelined world loading: reading, parsing, building and scoring overlap
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef WORLD_PIPELINE_H
+#define WORLD_PIPELINE_H
+
+#include "candidate_ranking.hpp"
+#include "matrix_utils.hpp"
+#include "start_scoring.hpp"
+#include "world_stream_loader.hpp"
+#include <cstddef>
+#include <memory>
+
+/**
+ * @struct PipelineOptions
+ * @brief Tuning of loadWorldPipelined()
+ */
+struct PipelineOptions
+{
+    size_t chunkBytes = size_t{256} << 10;          ///< Largest chunk handed from the reader to the parser
+    size_t queueDepth = 8;                          ///< Capacity of each queue between stages
+    StartScoringWeights weights;                    ///< Weights of the ranking seeded at the end
+    StartPruning pruning = StartPruning::Symmetry;  ///< Pruning of the ranking seeded at the end (as the DFS engines)
+};
+
+/**
+ * @struct PipelineResult
+ * @brief Outcome of loadWorldPipelined()
+ */
+struct PipelineResult
+{
+    size_t items = 0;                                 ///< Cell lines (Cells) or rows (Rows) read
+    size_t chunks = 0;                                ///< Chunks read from the input
+    std::shared_ptr<const CandidateRanking> ranking;  ///< Ranking built from the overlapped scores (null if abandoned)
+};
+
+/**
+ * @brief Blocks the cells of a cells or rows stream with the stages of the load overlapped
+ * @param inputFd Readable file descriptor (pipe, socket or file), not closed
+ * @param matrixWorld World to block the cells in
+ * @param format StreamFormat::Cells or StreamFormat::Rows
+ * @param options Chunk size, queue depth and the ranking to seed
+ * @return Items and chunks read, and the seeded ranking
+ * @throws std::runtime_error If reading fails
+ * @throws std::invalid_argument If the format is Image, a line is malformed
+ *         or outside the world (the message names the line number), the
+ *         stream ends inside a row, or it holds more rows than the world
+ *
+ * Four stages run at once, linked by BoundedQueue:
+ * 1. A reader thread read()s chunks of the input
+ * 2. A parser thread turns them into batches of cells or packed rows
+ * 3. The calling thread merges each batch into the world (matrixBlankingRows())
+ * 4. A scorer thread computes the neighbour counts (DegreeScores) of every
+ *    row whose own cells and those of the row below are final
+ *
+ * A row is final once the input has moved past it: always for rows streams,
+ * and for cells streams sorted by row. When a cell arrives for a row already
+ * declared final, the overlapped scores are abandoned and the ranking is
+ * built by the first query as usual. Otherwise the scores are complete when
+ * the input ends, and the ranking for options.weights and options.pruning is
+ * seeded into the cache of CandidateRanking::getShared(), so the first search
+ * starts without scanning the world. Cells applied before an error stay
+ * blocked; the error is reported once the pending read() returns.
+ */
+PipelineResult loadWorldPipelined(int inputFd, MatrixWorld &matrixWorld, StreamFormat format,
+                                  const PipelineOptions &options = {});
+
+#endif
@@ -0,0 +1,56 @@
+/**
+ * @file world_statistics.hpp
+ * @brief Cheap structural statistics of a MatrixWorld
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef WORLD_STATISTICS_H
+#define WORLD_STATISTICS_H
+
+#include "matrix_utils.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct WorldStatistics
+ * @brief Summary of the free-cell structure of a world
+ *
+ * Collected in a single linear pass over the matrix (plus one flood fill per
+ * connected component). Used by the automatic engine selection to decide which
+ * path finding algorithm is the cheapest one likely to succeed.
+ *
+ * @note Degree is the number of unblocked 4-directional neighbours of a free cell
+ */
+struct WorldStatistics
+{
+    uint32_t freeCells = 0;            ///< Number of unblocked cells
+    uint32_t blockedCells = 0;         ///< Number of blocked cells
+    double blockedRatio = 0.0;         ///< blockedCells / freeCells (0 when either count is zero)
+    uint32_t componentCount = 0;       ///< Number of 4-connected components of free cells
+    uint32_t largestComponentSize = 0; ///< Cell count of the largest component
+    uint32_t deadEndCells = 0;         ///< Free cells with degree 0 or 1
+    uint32_t corridorCells = 0;        ///< Free cells with degree exactly 2
+    uint32_t junctionCells = 0;        ///< Free cells with degree 3 or 4
+};
+
+/**
+ * @brief Computes structural statistics of the given world
+ * @param matrixWorld World to analyze
+ * @return Filled WorldStatistics structure
+ *
+ * Complexity: O(N×M) time, O(N×M) bits of scratch memory for the flood fill.
+ */
+[[nodiscard]] WorldStatistics computeWorldStatistics(const MatrixWorld &matrixWorld);
+
+/**
+ * @brief Counts the blocked cells of the given world exactly
+ * @param matrixWorld World to count
+ * @return Blocked cells (not truncated to 16 bits like getNoOfBlockedCells())
+ *
+ * Complexity: one popcount per row word, padding bits subtracted per row.
+ */
+[[nodiscard]] size_t countBlockedCells(const MatrixWorld &matrixWorld);
+
+#endif
@@ -0,0 +1,68 @@
+/**
+ * @file world_stream_loader.hpp
+ * @brief Incremental world loading from pipes and standard input
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef WORLD_STREAM_LOADER_H
+#define WORLD_STREAM_LOADER_H
+
+#include "matrix_utils.hpp"
+#include "world_image_loader.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief Encoding of a world stream
+ */
+enum class StreamFormat : uint8_t
+{
+    Cells, ///< Blocked cells text, one row,col per line (# comments)
+    Rows,  ///< Packed rows: getWordsPerRow() little-endian 64-bit words per row, row 0 first
+    Image  ///< Binary PBM (P4) or PGM (P5) image
+};
+
+/**
+ * @brief Parses a stream format name
+ * @param name "cells", "rows" or "image"
+ * @return Matching format
+ * @throws std::invalid_argument If the name is unknown
+ */
+[[nodiscard]] StreamFormat parseStreamFormat(std::string_view name);
+
+/**
+ * @brief Blocks the cells of a cells or rows stream as they arrive
+ * @param inputFd Readable file descriptor (pipe, socket or file), not closed
+ * @param matrixWorld World to block the cells in
+ * @param format StreamFormat::Cells or StreamFormat::Rows
+ * @return Cell lines (Cells) or rows (Rows) read
+ * @throws std::runtime_error If reading fails
+ * @throws std::invalid_argument If the format is Image, a line is malformed
+ *         or outside the world (the message names the line number), the
+ *         stream ends inside a row, or it holds more rows than the world
+ *
+ * Reads through a buffer and applies whatever complete lines or rows each
+ * read() returned before waiting for more, so the world is built while the
+ * producer is still writing. Each batch is merged with matrixBlankingRows()
+ * over the band of rows it touched. Cells applied before an error stay
+ * blocked.
+ */
+size_t streamBlockedCells(int inputFd, MatrixWorld &matrixWorld, StreamFormat format);
+
+/**
+ * @brief Decodes a PBM or PGM image stream as it arrives
+ * @param inputFd Readable file descriptor (pipe, socket or file), not closed
+ * @param occupiedThreshold PGM only: occupancy above which a pixel is blocked
+ * @return Decoded world
+ * @throws std::runtime_error If reading fails
+ * @throws std::invalid_argument If the stream is not a supported image or is truncated
+ *
+ * The header is parsed as soon as it is complete; raster rows are then
+ * decoded and applied band by band as they arrive (see loadWorldImage()).
+ */
+[[nodiscard]] MatrixWorld streamWorldImage(int inputFd, double occupiedThreshold = DEFAULT_OCCUPIED_THRESHOLD);
+
+#endif
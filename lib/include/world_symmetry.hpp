@@ -0,0 +1,91 @@
+/**
+ * @file world_symmetry.hpp
+ * @brief Detection of mirror and rotation symmetries of a world
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#ifndef WORLD_SYMMETRY_H
+#define WORLD_SYMMETRY_H
+
+#include "matrix_utils.hpp"
+#include "path.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @enum CellTransform
+ * @brief Non-identity symmetry of the square (dihedral group D4)
+ *
+ * Rotations by 90/270 degrees and both diagonal mirrors only exist for
+ * square worlds.
+ */
+enum class CellTransform : uint8_t
+{
+    MirrorRows,   ///< (r, c) -> (rows - 1 - r, c)
+    MirrorCols,   ///< (r, c) -> (r, cols - 1 - c)
+    Rotate180,    ///< (r, c) -> (rows - 1 - r, cols - 1 - c)
+    Rotate90,     ///< (r, c) -> (c, n - 1 - r), clockwise
+    Rotate270,    ///< (r, c) -> (n - 1 - c, r)
+    Transpose,    ///< (r, c) -> (c, r)
+    AntiTranspose ///< (r, c) -> (n - 1 - c, n - 1 - r)
+};
+
+/**
+ * @brief Finds every transform that maps the world onto itself
+ * @param matrixWorld World to analyze
+ * @return Symmetries of the world (empty for an asymmetric world)
+ *
+ * Compares packed row words: rows against mirrored rows, bit-reversed rows
+ * and, for square worlds, rows of the transposed matrix. An asymmetric world
+ * usually fails on the first compared row. The symmetries of a world form a
+ * group, so the result is closed under composition.
+ *
+ * Complexity: O(N×M / 64) words per transform, plus one O(N×M) transpose
+ * for square worlds.
+ */
+[[nodiscard]] std::vector<CellTransform> detectSymmetries(const MatrixWorld &matrixWorld);
+
+/**
+ * @brief Applies a transform to a cell
+ * @param transform Transform to apply
+ * @param cell (row, col) of the cell
+ * @param rows Matrix row count
+ * @param cols Matrix column count
+ * @return (row, col) of the image cell
+ */
+[[nodiscard]] std::pair<uint16_t, uint16_t> applyTransform(CellTransform transform,
+                                                           std::pair<uint16_t, uint16_t> cell,
+                                                           uint16_t rows,
+                                                           uint16_t cols);
+
+/**
+ * @brief Applies a transform to every cell of a path
+ * @param transform Symmetry of the world
+ * @param path Path in the world
+ * @param rows Matrix row count
+ * @param cols Matrix column count
+ * @return Image path; valid in the world whenever path is, since transform
+ *         is one of its symmetries
+ */
+[[nodiscard]] Path transformPath(CellTransform transform, const Path &path, uint16_t rows, uint16_t cols);
+
+/**
+ * @brief Checks whether a cell represents its orbit under the given symmetries
+ * @param cell (row, col) of the cell
+ * @param symmetries Symmetry group of the world (see detectSymmetries)
+ * @param rows Matrix row count
+ * @param cols Matrix column count
+ * @return true if no image of the cell has a smaller row-major index
+ *
+ * A path from any cell of the orbit maps to a path from the representative,
+ * so searching from representatives only loses no solution.
+ */
+[[nodiscard]] bool isOrbitRepresentative(std::pair<uint16_t, uint16_t> cell,
+                                         const std::vector<CellTransform> &symmetries,
+                                         uint16_t rows,
+                                         uint16_t cols);
+
+#endif
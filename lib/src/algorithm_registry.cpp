@@ -0,0 +1,274 @@
+/**
+ * @file algorithm_registry.cpp
+ * @brief Implementation of the path finding algorithm registry
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "algorithm_registry.hpp"
+#include "auto_algorithm.hpp"
+#include "corridor_algorithm.hpp"
+#include "dfs_algorithm.hpp"
+#include "local_search_algorithm.hpp"
+#include "parallel_dfs_algorithm.hpp"
+#include "portfolio_algorithm.hpp"
+#include "tree_diameter.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @brief Registers the built-in engines
+ *
+ * - "diameter": prefix of the spanning tree diameter, linear time, incomplete
+ * - "localsearch": greedy seed grown by detour insertion, linear time, incomplete
+ * - "corridor": exhaustive DFS over junctions, applicable to corridor-heavy worlds
+ * - "dfs-parallel": exhaustive DFS with starting points spread over threads (multi-core only)
+ * - "dfs": exhaustive DFS with backtracking, always applicable, most expensive
+ * - "dfs-openarea", "dfs-endpoints": DFS with a StartScoringWeights preset
+ *   ranking the starts (chosen explicitly, never auto-selected)
+ * - "auto": selects one of the above from world statistics (never auto-selected)
+ * - "portfolio": races the applicable engines concurrently (never auto-selected)
+ */
+AlgorithmRegistry::AlgorithmRegistry()
+{
+    registerAlgorithm({"diameter",
+                       "Prefix of the spanning tree diameter, a path that exists for sure (fast, incomplete)",
+                       5,
+                       false,
+                       [](const WorldStatistics &, PathLength) { return true; },
+                       [] { return std::make_unique<TreeDiameterAlgorithm>(); }});
+
+    registerAlgorithm({"localsearch",
+                       "Greedy seed path lengthened by detour insertion (fast, incomplete)",
+                       10,
+                       false,
+                       [](const WorldStatistics &, PathLength) { return true; },
+                       [] { return std::make_unique<LocalSearchAlgorithm>(); }});
+
+    registerAlgorithm({"corridor",
+                       "Exhaustive search on the junction graph with corridors contracted into edges",
+                       50,
+                       true,
+                       [](const WorldStatistics &stats, PathLength) { return stats.corridorCells * 2 >= stats.freeCells; },
+                       [] { return std::make_unique<CorridorAlgorithm>(); }});
+
+    registerAlgorithm({"dfs-parallel",
+                       "Depth-first search with ranked starting points claimed by worker threads",
+                       90,
+                       true,
+                       [](const WorldStatistics &, PathLength) { return std::thread::hardware_concurrency() > 1; },
+                       [] { return std::make_unique<ParallelDFSAlgorithm>(); }});
+
+    registerAlgorithm({"dfs",
+                       "Depth-first search with backtracking over ranked starting points",
+                       100,
+                       true,
+                       [](const WorldStatistics &, PathLength) { return true; },
+                       [] { return std::make_unique<DFSAlgorithm>(); }});
+
+    registerAlgorithm({"dfs-openarea",
+                       "Depth-first search starting in open, well-connected areas first",
+                       100,
+                       true,
+                       nullptr,
+                       [] { return std::make_unique<DFSAlgorithm>(StartScoringWeights::openArea()); }});
+
+    registerAlgorithm({"dfs-endpoints",
+                       "Depth-first search starting at dead ends of large components first",
+                       100,
+                       true,
+                       nullptr,
+                       [] { return std::make_unique<DFSAlgorithm>(StartScoringWeights::endpoints()); }});
+
+    registerAlgorithm({"auto",
+                       "Picks the cheapest engine likely to succeed from world statistics",
+                       0,
+                       false,
+                       nullptr,
+                       [] { return std::make_unique<AutoSelectAlgorithm>(); }});
+
+    registerAlgorithm({"portfolio",
+                       "Races the applicable engines on separate threads, first valid path wins",
+                       0,
+                       false,
+                       nullptr,
+                       [] { return std::make_unique<PortfolioAlgorithm>(); }});
+}
+
+/**
+ * @brief Gets the process-wide registry instance
+ *
+ * Function-local static guarantees thread-safe lazy construction.
+ *
+ * @return Reference to the singleton registry
+ */
+AlgorithmRegistry &AlgorithmRegistry::instance()
+{
+    static AlgorithmRegistry registry;
+    return registry;
+}
+
+/**
+ * @brief Registers a new engine or replaces an existing one with the same name
+ * @param descriptor Engine registration record
+ * @throws std::invalid_argument If the name is empty or the factory is missing
+ */
+void AlgorithmRegistry::registerAlgorithm(AlgorithmDescriptor descriptor)
+{
+    if (descriptor.name.empty())
+    {
+        throw std::invalid_argument("Algorithm name must not be empty");
+    }
+
+    if (!descriptor.factory)
+    {
+        throw std::invalid_argument("Algorithm factory must be provided: " + descriptor.name);
+    }
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    auto existing = std::find_if(descriptors.begin(), descriptors.end(),
+                                 [&descriptor](const AlgorithmDescriptor &entry) { return entry.name == descriptor.name; });
+    if (existing != descriptors.end())
+    {
+        *existing = std::move(descriptor);
+    }
+    else
+    {
+        descriptors.push_back(std::move(descriptor));
+    }
+}
+
+/**
+ * @brief Creates an engine instance by name
+ * @param name Short engine identifier
+ * @return Newly created engine
+ * @throws std::invalid_argument If no engine with this name is registered
+ */
+std::unique_ptr<PathAlgorithm> AlgorithmRegistry::create(const std::string &name) const
+{
+    std::function<std::unique_ptr<PathAlgorithm>()> factory;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        auto entry = std::find_if(descriptors.begin(), descriptors.end(),
+                                  [&name](const AlgorithmDescriptor &descriptor) { return descriptor.name == name; });
+        if (entry == descriptors.end())
+        {
+            throw std::invalid_argument("Unknown algorithm: " + name);
+        }
+        factory = entry->factory;
+    }
+    // Construct outside the lock - meta engines may query the registry themselves
+    return factory();
+}
+
+/**
+ * @brief Checks whether an engine with the given name is registered
+ * @param name Short engine identifier
+ * @return true if registered, false otherwise
+ */
+bool AlgorithmRegistry::contains(const std::string &name) const
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    return std::any_of(descriptors.begin(), descriptors.end(),
+                       [&name](const AlgorithmDescriptor &descriptor) { return descriptor.name == name; });
+}
+
+/**
+ * @brief Gets a snapshot of all registration records
+ * @return Copy of the descriptors in registration order
+ */
+std::vector<AlgorithmDescriptor> AlgorithmRegistry::getDescriptors() const
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    return descriptors;
+}
+
+/**
+ * @brief Ranks the engines applicable to a query, cheapest first
+ *
+ * Filters out engines without an applicability predicate (meta engines) and
+ * engines whose predicate rejects the query, then stable-sorts by recorded
+ * wins on the same density class and by costRank.
+ *
+ * @param stats Statistics of the world to be searched
+ * @param pathLength Requested path length
+ * @return Applicable descriptors, most frequent winners and cheapest first
+ */
+std::vector<AlgorithmDescriptor> AlgorithmRegistry::selectEngines(const WorldStatistics &stats,
+                                                                  PathLength pathLength) const
+{
+    std::vector<AlgorithmDescriptor> selected;
+    std::map<std::string, uint32_t> wins;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (const auto &descriptor : descriptors)
+        {
+            if (descriptor.isApplicable && descriptor.isApplicable(stats, pathLength))
+            {
+                selected.push_back(descriptor);
+            }
+        }
+        wins = winCounts[densityClass(stats)];
+    }
+
+    std::stable_sort(selected.begin(), selected.end(),
+                     [&wins](const AlgorithmDescriptor &lhs, const AlgorithmDescriptor &rhs) {
+                         uint32_t lhsWins = wins.count(lhs.name) != 0 ? wins.at(lhs.name) : 0;
+                         uint32_t rhsWins = wins.count(rhs.name) != 0 ? wins.at(rhs.name) : 0;
+                         if (lhsWins != rhsWins)
+                         {
+                             return lhsWins > rhsWins;
+                         }
+                         return lhs.costRank < rhs.costRank;
+                     });
+    return selected;
+}
+
+/**
+ * @brief Buckets a world into a coarse density class
+ *
+ * Thresholds follow the blocked-to-free ratio: below 0.1 the world is open,
+ * below 0.5 mixed, otherwise cluttered.
+ *
+ * @param stats World statistics
+ * @return Density class index (0-2)
+ */
+size_t AlgorithmRegistry::densityClass(const WorldStatistics &stats)
+{
+    if (stats.blockedRatio < 0.1)
+    {
+        return 0;
+    }
+    if (stats.blockedRatio < 0.5)
+    {
+        return 1;
+    }
+    return 2;
+}
+
+/**
+ * @brief Records that an engine won a race on a world
+ * @param name Registry name of the winning engine
+ * @param stats Statistics of the world the race ran on
+ */
+void AlgorithmRegistry::recordWin(const std::string &name, const WorldStatistics &stats)
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    winCounts[densityClass(stats)][name]++;
+}
+
+/**
+ * @brief Gets the number of recorded wins of an engine on similar worlds
+ * @param name Registry name of the engine
+ * @param stats Statistics selecting the density class
+ * @return Number of recorded wins
+ */
+uint32_t AlgorithmRegistry::getWinCount(const std::string &name, const WorldStatistics &stats) const
+{
+    std::lock_guard<std::mutex> lock(registryMutex);
+    const auto &classWins = winCounts[densityClass(stats)];
+    auto entry = classWins.find(name);
+    return entry != classWins.end() ? entry->second : 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file auto_algorithm.cpp
+ * @brief Implementation of automatic engine selection
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "auto_algorithm.hpp"
+#include "algorithm_registry.hpp"
+#include "feasibility_oracle.hpp"
+#include "world_statistics.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Finds a viable path using the cheapest engine likely to succeed
+ *
+ * 1. Validates input parameters the same way the DFS engine does
+ * 2. Rejects provably infeasible requests (no engine can succeed)
+ * 3. Collects world statistics in one linear pass
+ * 4. Runs the applicable engines in ascending cost order
+ *
+ * @param matrixWorld Reference to the matrix world
+ * @param pathLength Target path length
+ * @param maxStartingPoints Maximum starting points forwarded to the engines
+ * @return Path object containing the found path (empty if none found)
+ * @throws std::invalid_argument If pathLength is zero or exceeds matrix size
+ */
+Path AutoSelectAlgorithm::findViablePath(const MatrixWorld &matrixWorld,
+                                         PathLength pathLength,
+                                         MaxStartingPoints maxStartingPoints)
+{
+    if (pathLength.value == 0)
+    {
+        throw std::invalid_argument("Path length must be greater than zero");
+    }
+
+    if (pathLength.value > matrixWorld.getTotalCells())
+    {
+        throw std::invalid_argument("Path length exceeds matrix size");
+    }
+
+    lastSelectedEngine.clear();
+    if (!checkPathFeasibility(matrixWorld, pathLength).isFeasible)
+    {
+        return {};
+    }
+
+    WorldStatistics stats = computeWorldStatistics(matrixWorld);
+
+    for (const auto &descriptor : AlgorithmRegistry::instance().selectEngines(stats, pathLength))
+    {
+        lastSelectedEngine = descriptor.name;
+        std::unique_ptr<PathAlgorithm> engine = descriptor.factory();
+        engine->setCancellationFlag(cancellationFlag);
+        Path path = engine->findViablePath(matrixWorld, pathLength, maxStartingPoints);
+        if (!path.isEmpty() || descriptor.isComplete || isCancelled())
+        {
+            return path;
+        }
+    }
+
+    return {};
+}
@@ -0,0 +1,406 @@
+/**
+ * @file batch_runner.cpp
+ * @brief Implementation of the batch query mode
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "batch_runner.hpp"
+#include "algorithm_registry.hpp"
+#include "feasibility_oracle.hpp"
+#include "mapped_file.hpp"
+#include "moving_ai.hpp"
+#include "performance_guard.hpp"
+#include "world_image_loader.hpp"
+#include "world_statistics.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+/**
+ * @brief Gets the output name of a batch status
+ */
+const char *batchStatusName(BatchStatus status)
+{
+    static constexpr const char *STATUS_NAMES[] = {"found", "not_found", "infeasible", "failed"};
+    return STATUS_NAMES[static_cast<size_t>(status)];
+}
+
+/**
+ * @brief Whether a reference ends with the given extension
+ */
+bool hasExtension(const std::string &reference, std::string_view extension)
+{
+    return reference.size() > extension.size() &&
+           reference.compare(reference.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+/**
+ * @brief Parses an "RxC" world reference
+ * @return true if the reference has that form (dimensions unchecked)
+ */
+bool parseDimensions(const std::string &reference, uint32_t &rows, uint32_t &cols)
+{
+    const char *last = reference.data() + reference.size();
+    auto parsedRows = std::from_chars(reference.data(), last, rows);
+    if (parsedRows.ec != std::errc{} || parsedRows.ptr == last || *parsedRows.ptr != 'x')
+    {
+        return false;
+    }
+    auto parsedCols = std::from_chars(parsedRows.ptr + 1, last, cols);
+    return parsedCols.ec == std::errc{} && parsedCols.ptr == last;
+}
+
+/**
+ * @brief Parses a whole field as a number of 0-65535
+ * @return false if the field is not such a number
+ */
+bool parseNumber(const std::string &field, uint16_t &value)
+{
+    auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+    return error == std::errc{} && end == field.data() + field.size();
+}
+
+/**
+ * @brief Runs one job
+ * @param job Job to run
+ * @param worlds Shared world cache
+ * @param engines Engines of the calling worker, by algorithm name
+ * @return Job result
+ */
+BatchResult runJob(const BatchJob &job, WorldCache &worlds,
+                   std::unordered_map<std::string, std::unique_ptr<PathAlgorithm>> &engines)
+{
+    BatchResult result;
+    std::shared_ptr<const CachedWorld> cached;
+    try
+    {
+        cached = worlds.get(job.world);
+        result.rows = cached->world.getColSize();
+        result.cols = cached->world.getRowSize();
+        result.blockedCells = cached->blockedCells;
+        auto engine = engines.find(job.algorithm);
+        if (engine == engines.end())
+        {
+            engine = engines.emplace(job.algorithm, AlgorithmRegistry::instance().create(job.algorithm)).first;
+        }
+
+        if (job.pathLength.value > cached->feasibilityBound)
+        {
+            result.status = BatchStatus::Infeasible;
+            result.message = "Path length " + std::to_string(job.pathLength.value) +
+                             " exceeds the feasibility bound (" + std::to_string(cached->feasibilityBound) + ")";
+            return result;
+        }
+
+        // --enableMeasurement counts the calling worker's search, without stdout messages
+        PathAlgorithm &algorithm = *engine->second;
+        const bool measure = PerformanceMeasureGuard::isMeasurementEnabled;
+        if (measure)
+        {
+            algorithm.setProgressMessages(false);
+            algorithm.measureStart();
+        }
+        auto start = std::chrono::steady_clock::now();
+        result.path = algorithm.findViablePath(cached->world, job.pathLength, job.maxStartingPoints);
+        auto stop = std::chrono::steady_clock::now();
+        if (measure)
+        {
+            algorithm.measureStop();
+            result.counters = algorithm.saveMeasures();
+        }
+        result.micros = std::chrono::duration<double, std::micro>(stop - start).count();
+        result.status = result.path.isEmpty() ? BatchStatus::NotFound : BatchStatus::Found;
+    }
+    catch (const std::exception &e)
+    {
+        result.status = BatchStatus::Failed;
+        result.message = e.what();
+    }
+    return result;
+}
+} // namespace
+
+/**
+ * @brief Builds the world a job refers to
+ * @param reference "RxC", a ".map" file or a ".pbm"/".pgm" image
+ * @return Decoded world
+ * @throws std::runtime_error If a file cannot be opened or mapped
+ * @throws std::invalid_argument If the reference is not recognised or the file is malformed
+ */
+MatrixWorld loadWorldReference(const std::string &reference)
+{
+    uint32_t rows = 0;
+    uint32_t cols = 0;
+    if (parseDimensions(reference, rows, cols))
+    {
+        if (rows == 0 || cols == 0 || rows > UINT16_MAX || cols > UINT16_MAX)
+        {
+            throw std::invalid_argument("World dimensions must be 1-65535: " + reference);
+        }
+        return MatrixWorld(static_cast<uint16_t>(rows), static_cast<uint16_t>(cols));
+    }
+    if (hasExtension(reference, ".map"))
+    {
+        return loadMovingAiMapFile(reference);
+    }
+    if (hasExtension(reference, ".pbm") || hasExtension(reference, ".pgm"))
+    {
+        return loadWorldImageFile(reference);
+    }
+    throw std::invalid_argument("Unknown world reference '" + reference + "' (expected RxC, .map, .pbm or .pgm)");
+}
+
+/**
+ * @brief Wraps a world with its per-world indexes
+ * @param world World to share
+ * @return Cached world, feasibility bound and blocked cells computed once
+ */
+std::shared_ptr<CachedWorld> makeCachedWorld(MatrixWorld world)
+{
+    auto cached = std::make_shared<CachedWorld>(CachedWorld{std::move(world), 0, 0, nullptr});
+    cached->feasibilityBound = checkPathFeasibility(cached->world, {0}).upperBound;
+    cached->blockedCells = countBlockedCells(cached->world);
+    return cached;
+}
+
+/**
+ * @brief Returns the cached world, loading it on first use
+ *
+ * The caller inserting a reference becomes its loader and publishes the
+ * world (or the load error) through a shared future.
+ *
+ * @param reference World reference
+ * @return Shared world
+ */
+std::shared_ptr<const CachedWorld> WorldCache::get(const std::string &reference)
+{
+    std::promise<std::shared_ptr<const CachedWorld>> promise;
+    std::shared_future<std::shared_ptr<const CachedWorld>> future;
+    bool loader = false;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto entry = worlds.find(reference);
+        if (entry == worlds.end())
+        {
+            entry = worlds.emplace(reference, promise.get_future().share()).first;
+            loader = true;
+        }
+        future = entry->second;
+    }
+
+    if (loader)
+    {
+        try
+        {
+            promise.set_value(makeCachedWorld(loadWorldReference(reference)));
+        }
+        catch (...)
+        {
+            promise.set_exception(std::current_exception());
+        }
+    }
+    return future.get();
+}
+
+/**
+ * @brief Gets the number of references seen so far
+ * @return Cached (or failed) references
+ */
+size_t WorldCache::size()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return worlds.size();
+}
+
+/**
+ * @brief Parses a job file
+ * @param text File contents
+ * @param defaultAlgorithm Engine of jobs without an ALGORITHM field
+ * @param defaultMaxStartingPoints Limit of jobs without a MAX_STARTING_POINTS field
+ * @return Jobs in file order
+ * @throws std::invalid_argument If a line is malformed
+ */
+std::vector<BatchJob> loadBatchJobs(std::string_view text, const std::string &defaultAlgorithm,
+                                    MaxStartingPoints defaultMaxStartingPoints)
+{
+    std::vector<BatchJob> jobs;
+    std::istringstream lines{std::string(text)};
+    std::string line;
+    for (size_t lineNumber = 1; std::getline(lines, line); lineNumber++)
+    {
+        std::istringstream fieldStream(line);
+        std::vector<std::string> fields;
+        for (std::string field; fieldStream >> field && field[0] != '#';)
+        {
+            fields.push_back(std::move(field));
+        }
+        if (fields.empty())
+        {
+            continue;
+        }
+
+        BatchJob job;
+        job.world = fields[0];
+        job.algorithm = fields.size() > 2 ? fields[2] : defaultAlgorithm;
+        job.maxStartingPoints = defaultMaxStartingPoints;
+        job.lineNumber = lineNumber;
+        if (fields.size() < 2 || fields.size() > 4 || !parseNumber(fields[1], job.pathLength.value) ||
+            (fields.size() == 4 && !parseNumber(fields[3], job.maxStartingPoints.value)))
+        {
+            throw std::invalid_argument("Invalid job at line " + std::to_string(lineNumber) +
+                                        " (expected WORLD PATH_LENGTH [ALGORITHM [MAX_STARTING_POINTS]])");
+        }
+        jobs.push_back(std::move(job));
+    }
+    return jobs;
+}
+
+/**
+ * @brief Loads a job file
+ * @param filePath Path of the job file
+ * @param defaultAlgorithm Engine of jobs without an ALGORITHM field
+ * @param defaultMaxStartingPoints Limit of jobs without a MAX_STARTING_POINTS field
+ * @return Jobs in file order
+ * @throws std::runtime_error If the file cannot be opened or mapped
+ * @throws std::invalid_argument If a line is malformed
+ */
+std::vector<BatchJob> loadBatchJobFile(const std::string &filePath, const std::string &defaultAlgorithm,
+                                       MaxStartingPoints defaultMaxStartingPoints)
+{
+    MappedFile file(filePath);
+    return loadBatchJobs(file.getText(), defaultAlgorithm, defaultMaxStartingPoints);
+}
+
+/**
+ * @brief Runs jobs on a thread pool and reports results in submission order
+ *
+ * 1. Starts min(threadCount, jobs) workers claiming job indices from an
+ *    atomic counter
+ * 2. Workers store each result in its slot and signal the calling thread
+ * 3. The calling thread hands out results in job order as the next slot
+ *    fills, then releases the slot
+ *
+ * @param jobs Jobs to run
+ * @param threadCount Worker threads (0 = hardware concurrency)
+ * @param onResult Result callback, called in job order on the calling thread
+ */
+void runBatch(const std::vector<BatchJob> &jobs, unsigned threadCount,
+              const std::function<void(size_t, const BatchResult &)> &onResult)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1U, std::thread::hardware_concurrency());
+    }
+    const size_t workerCount = std::min<size_t>(threadCount, jobs.size());
+
+    WorldCache worlds;
+    std::atomic<size_t> nextJob{0};
+    std::vector<std::optional<BatchResult>> results(jobs.size());
+    std::mutex resultsMutex;
+    std::condition_variable resultReady;
+
+    auto work = [&]() {
+        std::unordered_map<std::string, std::unique_ptr<PathAlgorithm>> engines;
+        for (size_t index = nextJob.fetch_add(1); index < jobs.size(); index = nextJob.fetch_add(1))
+        {
+            BatchResult result = runJob(jobs[index], worlds, engines);
+            std::lock_guard<std::mutex> lock(resultsMutex);
+            results[index] = std::move(result);
+            resultReady.notify_one();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+    for (size_t worker = 0; worker < workerCount; worker++)
+    {
+        workers.emplace_back(work);
+    }
+
+    for (size_t index = 0; index < jobs.size(); index++)
+    {
+        BatchResult result;
+        {
+            std::unique_lock<std::mutex> lock(resultsMutex);
+            resultReady.wait(lock, [&]() { return results[index].has_value(); });
+            result = std::move(*results[index]);
+            results[index].reset();
+        }
+        onResult(index, result);
+    }
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Prints one batch result line
+ *
+ * Format: "job INDEX WORLD PATH_LENGTH ALGORITHM STATUS MICROS" followed by
+ * the path cells (found) or the reason (infeasible, failed).
+ *
+ * @param index Job index
+ * @param job Job the result belongs to
+ * @param result Job result
+ */
+void printBatchResult(size_t index, const BatchJob &job, const BatchResult &result)
+{
+    std::cout << "job " << index << " " << job.world << " " << job.pathLength.value << " " << job.algorithm << " "
+              << batchStatusName(result.status) << " " << result.micros;
+    if (result.status == BatchStatus::Found)
+    {
+        for (const auto &[row, col] : result.path)
+        {
+            std::cout << " " << row << "," << col;
+        }
+    }
+    else if (!result.message.empty())
+    {
+        std::cout << " " << result.message;
+    }
+    std::cout << "\n";
+}
+
+/**
+ * @brief Converts a batch result to a machine-readable record
+ *
+ * Worlds are shared by all jobs, so load and feasibility times are not
+ * attributed to a job; the search time is also the total.
+ *
+ * @param index Job index
+ * @param job Job the result belongs to
+ * @param result Job result
+ * @return Record of the job
+ */
+QueryRecord makeBatchRecord(size_t index, const BatchJob &job, const BatchResult &result)
+{
+    QueryRecord record;
+    record.job = index;
+    record.status = batchStatusName(result.status);
+    record.algorithm = job.algorithm;
+    record.world = job.world;
+    record.rows = result.rows;
+    record.cols = result.cols;
+    record.blockedCells = result.blockedCells;
+    record.pathLength = job.pathLength;
+    record.path = result.path;
+    record.reason = result.message;
+    record.timings.searchMicros = result.micros;
+    record.timings.totalMicros = result.micros;
+    record.counters = result.counters;
+    return record;
+}
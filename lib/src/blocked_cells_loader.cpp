@@ -0,0 +1,221 @@
+/**
+ * @file blocked_cells_loader.cpp
+ * @brief Implementation of the parallel blocked cells file loader
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "blocked_cells_loader.hpp"
+#include "mapped_file.hpp"
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/// Files smaller than this per thread are not split further
+constexpr size_t MIN_CHUNK_BYTES = size_t{1} << 20;
+
+/**
+ * @struct ChunkResult
+ * @brief Outcome of parsing one chunk
+ */
+struct ChunkResult
+{
+    size_t lines = 0;              ///< Cell lines read
+    size_t errorOffset = SIZE_MAX; ///< Offset of the first bad line (SIZE_MAX if none)
+    bool outOfBounds = false;      ///< Bad line was well-formed but outside the world
+};
+
+/**
+ * @brief Skips spaces and tabs
+ */
+const char *skipBlanks(const char *current, const char *last)
+{
+    while (current != last && (*current == ' ' || *current == '\t'))
+    {
+        current++;
+    }
+    return current;
+}
+
+/**
+ * @brief Parses the lines of [first, last) into the mask
+ *
+ * Parsing stops at the first malformed or out of bounds line.
+ *
+ * @param text Whole text (for error offsets)
+ * @param first First character of the chunk (start of a line)
+ * @param last End of the chunk (after a newline or end of text)
+ * @param matrixWorld World giving the dimensions and mask layout
+ * @param mask Packed bitmap receiving the cells
+ * @param concurrent Whether other chunks write into the mask at the same time
+ * @param result Chunk outcome
+ */
+void parseChunk(const char *text, const char *first, const char *last, const MatrixWorld &matrixWorld,
+                std::vector<uint64_t> &mask, bool concurrent, ChunkResult &result)
+{
+    const uint16_t rows = matrixWorld.getColSize();
+    const uint16_t cols = matrixWorld.getRowSize();
+    const size_t words = matrixWorld.getWordsPerRow();
+
+    for (const char *line = first; line < last;)
+    {
+        const auto *newline = static_cast<const char *>(std::memchr(line, '\n', static_cast<size_t>(last - line)));
+        const char *lineEnd = newline != nullptr ? newline : last;
+        const char *next = newline != nullptr ? newline + 1 : last;
+
+        uint32_t row = 0;
+        uint32_t col = 0;
+        const CellLine parsed = parseBlockedCellLine(line, lineEnd, row, col);
+        if (parsed == CellLine::Skipped)
+        {
+            line = next;
+            continue;
+        }
+        if (parsed == CellLine::Malformed || row >= rows || col >= cols)
+        {
+            result.errorOffset = static_cast<size_t>(line - text);
+            result.outOfBounds = parsed == CellLine::Cell;
+            return;
+        }
+
+        uint64_t &word = mask[(row * words) + (col / 64)];
+        const uint64_t bit = uint64_t{1} << (col % 64);
+        if (concurrent)
+        {
+            std::atomic_ref<uint64_t>(word).fetch_or(bit, std::memory_order_relaxed);
+        }
+        else
+        {
+            word |= bit;
+        }
+        result.lines++;
+        line = next;
+    }
+}
+} // namespace
+
+/**
+ * @brief Parses one line of a blocked cells text
+ *
+ * Each line is "row,col" with optional blanks around the numbers and an
+ * optional trailing carriage return; empty lines and lines starting with #
+ * are skipped.
+ *
+ * @param first First character of the line
+ * @param last End of the line
+ * @param row Parsed row
+ * @param col Parsed column
+ * @return Whether the line held a cell, was skipped or is malformed
+ */
+CellLine parseBlockedCellLine(const char *first, const char *last, uint32_t &row, uint32_t &col)
+{
+    const char *end = last != first && last[-1] == '\r' ? last - 1 : last;
+    const char *current = skipBlanks(first, end);
+    if (current == end || *current == '#')
+    {
+        return CellLine::Skipped;
+    }
+
+    auto parsedRow = std::from_chars(current, end, row);
+    current = skipBlanks(parsedRow.ptr, end);
+    if (parsedRow.ec != std::errc{} || current == end || *current != ',')
+    {
+        return CellLine::Malformed;
+    }
+    auto parsedCol = std::from_chars(skipBlanks(current + 1, end), end, col);
+    if (parsedCol.ec != std::errc{} || skipBlanks(parsedCol.ptr, end) != end)
+    {
+        return CellLine::Malformed;
+    }
+    return CellLine::Cell;
+}
+
+/**
+ * @brief Blocks the cells listed in an in-memory blocked cells text
+ *
+ * 1. Splits the text into one chunk per thread, each boundary moved forward
+ *    past the next newline so no line is split
+ * 2. Parses the chunks concurrently into a shared packed bitmap (atomic OR
+ *    only when several threads run)
+ * 3. Reports the earliest bad line, or merges the bitmap into the world
+ *
+ * @param text File contents
+ * @param matrixWorld World to block the cells in
+ * @param threadCount Number of parser threads (0 = hardware concurrency)
+ * @return Number of cell lines read
+ * @throws std::invalid_argument If a line is malformed or a cell lies outside the world
+ */
+size_t loadBlockedCells(std::string_view text, MatrixWorld &matrixWorld, unsigned threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1U, std::thread::hardware_concurrency());
+    }
+    const size_t chunkCount = std::clamp<size_t>(text.size() / MIN_CHUNK_BYTES, 1, threadCount);
+
+    std::vector<size_t> bounds(chunkCount + 1, text.size());
+    bounds[0] = 0;
+    for (size_t chunk = 1; chunk < chunkCount; chunk++)
+    {
+        size_t newline = text.find('\n', std::max(bounds[chunk - 1], (text.size() * chunk) / chunkCount));
+        bounds[chunk] = newline == std::string_view::npos ? text.size() : newline + 1;
+    }
+
+    std::vector<uint64_t> mask(matrixWorld.getColSize() * matrixWorld.getWordsPerRow(), 0);
+    std::vector<ChunkResult> results(chunkCount);
+    auto parse = [&](size_t chunk) {
+        parseChunk(text.data(), text.data() + bounds[chunk], text.data() + bounds[chunk + 1], matrixWorld, mask,
+                   chunkCount > 1, results[chunk]);
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(chunkCount - 1);
+    for (size_t chunk = 1; chunk < chunkCount; chunk++)
+    {
+        workers.emplace_back(parse, chunk);
+    }
+    parse(0);
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    size_t lines = 0;
+    for (const ChunkResult &result : results)
+    {
+        if (result.errorOffset != SIZE_MAX)
+        {
+            const auto lineNumber = 1 + std::count(text.begin(), text.begin() + result.errorOffset, '\n');
+            throw std::invalid_argument(std::string(result.outOfBounds ? "Blocked cell outside the matrix"
+                                                                       : "Invalid blocked cell format") +
+                                        " at line " + std::to_string(lineNumber));
+        }
+        lines += result.lines;
+    }
+
+    matrixWorld.matrixBlankingMask(mask);
+    return lines;
+}
+
+/**
+ * @brief Blocks the cells listed in a blocked cells file
+ * @param filePath Path of the file
+ * @param matrixWorld World to block the cells in
+ * @param threadCount Number of parser threads (0 = hardware concurrency)
+ * @return Number of cell lines read
+ * @throws std::runtime_error If the file cannot be opened or mapped
+ * @throws std::invalid_argument If a line is malformed or a cell lies outside the world
+ */
+size_t loadBlockedCellsFile(const std::string &filePath, MatrixWorld &matrixWorld, unsigned threadCount)
+{
+    MappedFile file(filePath);
+    return loadBlockedCells(file.getText(), matrixWorld, threadCount);
+}
@@ -0,0 +1,596 @@
+/**
+ * @file candidate_ranking.cpp
+ * @brief Implementation of the bucket-sorted candidate ranking
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "candidate_ranking.hpp"
+#include "versioned_cache.hpp"
+#include "world_symmetry.hpp"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <thread>
+
+/// Number of rankings kept by getShared()
+static constexpr size_t SHARED_RANKING_CAPACITY = 8;
+
+/// Worlds with fewer cells are scored on the calling thread only
+static constexpr size_t PARALLEL_SCORING_MIN_CELLS = size_t{1} << 16;
+
+/// Minimum number of rows given to one scoring thread
+static constexpr uint16_t MIN_ROWS_PER_BAND = 32;
+
+/// Score byte of blocked cells
+static constexpr uint8_t BLOCKED_SCORE = CandidateRanking::MAX_SCORE + 1;
+
+/**
+ * @brief Scores the free cells of a band of rows word-parallel
+ *
+ * For every 64-bit word the free masks of the cell and of its four
+ * neighbours are formed with shifts, then added bit-sliced: bit i of
+ * (sum0, sum1, sum2) is the neighbour count of column 64 × word + i. Blocked
+ * cells and padding bits drop out through the free mask of the centre word.
+ *
+ * @param matrixWorld World to score
+ * @param firstRow First row of the band
+ * @param lastRow One past the last row of the band
+ * @param scores Score byte per cell, written for the band's free cells
+ * @param counts Number of band cells per score, accumulated
+ */
+static void scoreRowBand(const MatrixWorld &matrixWorld, uint16_t firstRow, uint16_t lastRow,
+                         std::vector<uint8_t> &scores, std::vector<size_t> &counts)
+{
+    const uint16_t rows = matrixWorld.getColSize();
+    const size_t cols = matrixWorld.getRowSize();
+    const size_t words = matrixWorld.getWordsPerRow();
+
+    for (uint16_t row = firstRow; row < lastRow; row++)
+    {
+        const uint64_t *current = matrixWorld.getRowWords(row);
+        const uint64_t *above = row > 0 ? matrixWorld.getRowWords(row - 1) : nullptr;
+        const uint64_t *below = row + 1 < rows ? matrixWorld.getRowWords(row + 1) : nullptr;
+
+        for (size_t word = 0; word < words; word++)
+        {
+            const uint64_t free = ~current[word];
+            if (free == 0)
+            {
+                continue;
+            }
+            const uint64_t previous = word > 0 ? ~current[word - 1] : 0;
+            const uint64_t next = word + 1 < words ? ~current[word + 1] : 0;
+
+            const uint64_t up = above != nullptr ? ~above[word] : 0;
+            const uint64_t down = below != nullptr ? ~below[word] : 0;
+            const uint64_t left = (free << 1) | (previous >> 63);
+            const uint64_t right = (free >> 1) | (next << 63);
+
+            // Bit-sliced sum of four one-bit masks
+            const uint64_t upDown = up ^ down;
+            const uint64_t leftRight = left ^ right;
+            const uint64_t carryUpDown = up & down;
+            const uint64_t carryLeftRight = left & right;
+            const uint64_t carryHalves = upDown & leftRight;
+            const uint64_t sum0 = upDown ^ leftRight;
+            const uint64_t sum1 = carryUpDown ^ carryLeftRight ^ carryHalves;
+            const uint64_t sum2 = (carryUpDown & carryLeftRight) | (carryUpDown & carryHalves) |
+                                  (carryLeftRight & carryHalves);
+
+            const size_t rowBase = (row * cols) + (word * 64);
+            for (uint64_t pending = free; pending != 0; pending &= pending - 1)
+            {
+                const int bit = std::countr_zero(pending);
+                auto score = static_cast<uint8_t>(((sum0 >> bit) & 1U) | (((sum1 >> bit) & 1U) << 1) |
+                                                  (((sum2 >> bit) & 1U) << 2));
+                scores[rowBase + bit] = score;
+                counts[score]++;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Runs a task once per band, bands after the first on their own threads
+ * @param bandCount Number of bands
+ * @param task Callable taking the band number
+ */
+template <typename Task> static void forEachBand(size_t bandCount, const Task &task)
+{
+    std::vector<std::thread> workers;
+    workers.reserve(bandCount - 1);
+    for (size_t band = 1; band < bandCount; band++)
+    {
+        workers.emplace_back([&task, band] { task(band); });
+    }
+    task(0);
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Prepares the scores of a world, no row scored yet
+ * @param matrixWorld World to score
+ */
+DegreeScores::DegreeScores(const MatrixWorld &matrixWorld)
+    : rows(matrixWorld.getColSize()), cols(matrixWorld.getRowSize()),
+      degrees(matrixWorld.getTotalCells(), BLOCKED_SCORE), bandFirstRow{0}
+{
+}
+
+/**
+ * @brief Scores the rows from getScoredRows() up to lastRow as one band
+ * @param matrixWorld World to score
+ * @param lastRow One past the last row of the band
+ * @throws std::invalid_argument If lastRow is past the last row or the dimensions differ
+ */
+void DegreeScores::scoreRows(const MatrixWorld &matrixWorld, uint16_t lastRow)
+{
+    if (matrixWorld.getColSize() != rows || matrixWorld.getRowSize() != cols)
+    {
+        throw std::invalid_argument("Scores and world dimensions differ.");
+    }
+    if (lastRow > rows)
+    {
+        throw std::invalid_argument("Scored band extends past the last row.");
+    }
+    if (lastRow <= scoredRows)
+    {
+        return;
+    }
+    std::vector<size_t> counts(CandidateRanking::MAX_SCORE + 1, 0);
+    scoreRowBand(matrixWorld, scoredRows, lastRow, degrees, counts);
+    bandCounts.push_back(std::move(counts));
+    bandFirstRow.push_back(lastRow);
+    scoredRows = lastRow;
+}
+
+/**
+ * @brief Ranks the free cells of the given world
+ *
+ * Counting sort over bands of consecutive rows:
+ * 1. Every band scores its free cells word-parallel (see scoreRowBand) and
+ *    counts its cells per score; weighted scoring then rescores the cells
+ *    (see computeStartScores) and recounts them per band
+ * 2. The counts are merged into bucket offsets, highest score first, and
+ *    each band gets its own write offset inside every bucket
+ * 3. Every band scatters its cells into its slices in row-major order
+ *
+ * Bands are taken in row order, so the result is identical to a single
+ * row-major pass. Large worlds run the bands on separate threads; scores are
+ * kept in a byte (two for weighted scores) per cell between the passes.
+ * Symmetry pruning finally drops non-representative cells in place, which
+ * keeps every bucket in order.
+ *
+ * @param matrixWorld World to rank
+ * @param weights Scoring criteria weights
+ * @param pruning Redundant candidates to leave out
+ */
+CandidateRanking::CandidateRanking(const MatrixWorld &matrixWorld,
+                                   const StartScoringWeights &weights,
+                                   StartPruning pruning)
+    : rows(matrixWorld.getColSize()), cols(matrixWorld.getRowSize()), worldVersion(matrixWorld.getVersion()),
+      weights(weights), pruning(pruning), maxScore(weights.getMaxScore())
+{
+    size_t bandCount = 1;
+    if (matrixWorld.getTotalCells() >= PARALLEL_SCORING_MIN_CELLS)
+    {
+        bandCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, std::max(1, rows / MIN_ROWS_PER_BAND));
+    }
+
+    // Step 1: the bands are laid out up front, then scored concurrently
+    DegreeScores scores(matrixWorld);
+    scores.bandFirstRow.resize(bandCount + 1);
+    for (size_t band = 0; band <= bandCount; band++)
+    {
+        scores.bandFirstRow[band] = static_cast<uint16_t>((rows * band) / bandCount);
+    }
+    scores.bandCounts.assign(bandCount, std::vector<size_t>(MAX_SCORE + 1, 0));
+    forEachBand(bandCount, [&](size_t band) {
+        scoreRowBand(matrixWorld, scores.bandFirstRow[band], scores.bandFirstRow[band + 1], scores.degrees,
+                     scores.bandCounts[band]);
+    });
+    scores.scoredRows = rows;
+
+    rankScores(matrixWorld, scores);
+}
+
+/**
+ * @brief Ranks the free cells of a world whose neighbour counts are already scored
+ *
+ * Runs steps 2 and 3 of the regular build (and the weights and pruning) on
+ * the given scores. A loader scores in many small bands; consecutive bands
+ * are merged into as many groups as the regular build would use threads.
+ *
+ * @param matrixWorld World to rank
+ * @param scores Complete neighbour counts of the world
+ * @param weights Scoring criteria weights
+ * @param pruning Redundant candidates to leave out
+ * @throws std::invalid_argument If the scores are incomplete or their dimensions differ
+ */
+CandidateRanking::CandidateRanking(const MatrixWorld &matrixWorld,
+                                   DegreeScores scores,
+                                   const StartScoringWeights &weights,
+                                   StartPruning pruning)
+    : rows(matrixWorld.getColSize()), cols(matrixWorld.getRowSize()), worldVersion(matrixWorld.getVersion()),
+      weights(weights), pruning(pruning), maxScore(weights.getMaxScore())
+{
+    if (scores.rows != rows || scores.cols != cols)
+    {
+        throw std::invalid_argument("Scores and world dimensions differ.");
+    }
+    if (!scores.isComplete())
+    {
+        throw std::invalid_argument("Scores do not cover every row of the world.");
+    }
+
+    const size_t bandCount = scores.bandCounts.size();
+    size_t groupCount = 1;
+    if (matrixWorld.getTotalCells() >= PARALLEL_SCORING_MIN_CELLS)
+    {
+        groupCount = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, bandCount);
+    }
+    if (groupCount < bandCount)
+    {
+        std::vector<uint16_t> groupFirstRow(groupCount + 1);
+        std::vector<std::vector<size_t>> groupCounts(groupCount, std::vector<size_t>(MAX_SCORE + 1, 0));
+        for (size_t group = 0; group < groupCount; group++)
+        {
+            const size_t firstBand = (bandCount * group) / groupCount;
+            const size_t lastBand = (bandCount * (group + 1)) / groupCount;
+            groupFirstRow[group] = scores.bandFirstRow[firstBand];
+            for (size_t band = firstBand; band < lastBand; band++)
+            {
+                for (size_t score = 0; score <= MAX_SCORE; score++)
+                {
+                    groupCounts[group][score] += scores.bandCounts[band][score];
+                }
+            }
+        }
+        groupFirstRow[groupCount] = rows;
+        scores.bandFirstRow = std::move(groupFirstRow);
+        scores.bandCounts = std::move(groupCounts);
+    }
+
+    rankScores(matrixWorld, scores);
+}
+
+/**
+ * @brief Bucket-sorts the scored cells, then applies the weights and pruning
+ *
+ * Steps 2 and 3 of the build, one thread per band of the scores.
+ *
+ * @param matrixWorld World to rank
+ * @param scores Complete neighbour counts of the world
+ */
+void CandidateRanking::rankScores(const MatrixWorld &matrixWorld, DegreeScores &scores)
+{
+    const size_t bandCount = scores.bandCounts.size();
+    const std::vector<uint16_t> &bandFirstRow = scores.bandFirstRow;
+    std::vector<std::vector<size_t>> &bandCounts = scores.bandCounts;
+
+    // Steps 2 and 3 for either score type
+    auto rank = [&](const auto &cellScores, auto blocked) {
+        // Bucket of score s starts at bucketStart[maxScore - s]
+        bucketStart.assign(static_cast<size_t>(maxScore) + 2, 0);
+        for (size_t bucket = 0; bucket <= maxScore; bucket++)
+        {
+            size_t bucketSize = 0;
+            for (const auto &counts : bandCounts)
+            {
+                bucketSize += counts[maxScore - bucket];
+            }
+            bucketStart[bucket + 1] = bucketStart[bucket] + bucketSize;
+        }
+
+        // Each band writes after the cells of the earlier bands in every bucket
+        std::vector<std::vector<size_t>> bandNext(bandCount, std::vector<size_t>(maxScore + 1));
+        for (size_t score = 0; score <= maxScore; score++)
+        {
+            size_t next = bucketStart[maxScore - score];
+            for (size_t band = 0; band < bandCount; band++)
+            {
+                bandNext[band][score] = next;
+                next += bandCounts[band][score];
+            }
+        }
+
+        order.resize(bucketStart[maxScore + 1]);
+        forEachBand(bandCount, [&](size_t band) {
+            auto &next = bandNext[band];
+            const auto last = static_cast<uint32_t>(bandFirstRow[band + 1]) * cols;
+            for (auto cell = static_cast<uint32_t>(bandFirstRow[band]) * cols; cell < last; cell++)
+            {
+                if (cellScores[cell] != blocked)
+                {
+                    order[next[cellScores[cell]]++] = cell;
+                }
+            }
+        });
+    };
+
+    if (weights.isDegreeOnly())
+    {
+        rank(scores.degrees, BLOCKED_SCORE);
+    }
+    else
+    {
+        std::vector<uint16_t> weighted = computeStartScores(matrixWorld, scores.degrees, weights);
+        forEachBand(bandCount, [&](size_t band) {
+            auto &counts = bandCounts[band];
+            counts.assign(maxScore + 1, 0);
+            const auto last = static_cast<uint32_t>(bandFirstRow[band + 1]) * cols;
+            for (auto cell = static_cast<uint32_t>(bandFirstRow[band]) * cols; cell < last; cell++)
+            {
+                if (weighted[cell] != NO_START_SCORE)
+                {
+                    counts[weighted[cell]]++;
+                }
+            }
+        });
+        rank(weighted, NO_START_SCORE);
+    }
+
+    if (pruning == StartPruning::Symmetry)
+    {
+        pruneSymmetric(matrixWorld);
+    }
+}
+
+/**
+ * @brief Keeps one representative per orbit of the world's symmetries
+ * @param matrixWorld World the ranking was built from
+ *
+ * Filters the ranked order in place, so every kept cell stays in its bucket
+ * and in the same relative order as in the unpruned ranking.
+ */
+void CandidateRanking::pruneSymmetric(const MatrixWorld &matrixWorld)
+{
+    pruning = StartPruning::Symmetry;
+    const std::vector<CellTransform> symmetries = detectSymmetries(matrixWorld);
+    if (symmetries.empty())
+    {
+        return;
+    }
+
+    size_t kept = 0;
+    size_t rank = 0;
+    for (size_t bucket = 0; bucket <= maxScore; bucket++)
+    {
+        for (; rank < bucketStart[bucket + 1]; rank++)
+        {
+            if (isOrbitRepresentative(getCellAt(order[rank]), symmetries, rows, cols))
+            {
+                order[kept++] = order[rank];
+            }
+        }
+        bucketStart[bucket + 1] = kept;
+    }
+    order.resize(kept);
+    order.shrink_to_fit();
+}
+
+/**
+ * @brief Patches a neighbour-count ranking after some cells changed state
+ *
+ * Only the changed cells and their neighbours can change score. Their new
+ * scores are computed directly; every bucket is then rebuilt by merging the
+ * previous bucket, minus those cells, with the cells that now score into it.
+ * Both lists are sorted by index, so the row-major order within buckets is
+ * kept and no cell of the world is rescored.
+ *
+ * @param previous Ranking of the world before the changes
+ * @param matrixWorld World after the changes
+ * @param changedCells Cells whose state changed since previous was built
+ * @throws std::invalid_argument If previous does not use the default weights
+ *         or was built for a world of other dimensions
+ */
+CandidateRanking::CandidateRanking(const CandidateRanking &previous, const MatrixWorld &matrixWorld,
+                                   const std::vector<std::pair<uint16_t, uint16_t>> &changedCells)
+    : rows(previous.rows), cols(previous.cols), worldVersion(matrixWorld.getVersion()), weights(previous.weights),
+      pruning(previous.pruning), maxScore(previous.maxScore)
+{
+    if (!weights.isDegreeOnly() || pruning != StartPruning::None)
+    {
+        throw std::invalid_argument("Only unpruned neighbour-count rankings can be patched.");
+    }
+    if (rows != matrixWorld.getColSize() || cols != matrixWorld.getRowSize())
+    {
+        throw std::invalid_argument("Ranking and world dimensions differ.");
+    }
+
+    // Changed cells and their neighbours, sorted by index
+    std::vector<uint32_t> affected;
+    affected.reserve(changedCells.size() * 5);
+    for (auto [row, col] : changedCells)
+    {
+        if (row >= rows || col >= cols)
+        {
+            throw std::invalid_argument("Changed cell is out of bounds of the matrix.");
+        }
+        const uint32_t cell = (static_cast<uint32_t>(row) * cols) + col;
+        affected.push_back(cell);
+        if (row > 0)
+        {
+            affected.push_back(cell - cols);
+        }
+        if (row + 1 < rows)
+        {
+            affected.push_back(cell + cols);
+        }
+        if (col > 0)
+        {
+            affected.push_back(cell - 1);
+        }
+        if (col + 1 < cols)
+        {
+            affected.push_back(cell + 1);
+        }
+    }
+    std::sort(affected.begin(), affected.end());
+    affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+
+    std::vector<std::vector<uint32_t>> moved(MAX_SCORE + 1);
+    for (uint32_t cell : affected)
+    {
+        auto row = static_cast<uint16_t>(cell / cols);
+        auto col = static_cast<uint16_t>(cell % cols);
+        if (matrixWorld.isUnblocked(row, col))
+        {
+            moved[matrixWorld.countUnblockedNeighbors(row, col)].push_back(cell);
+        }
+    }
+
+    bucketStart.assign(static_cast<size_t>(MAX_SCORE) + 2, 0);
+    order.reserve(matrixWorld.getNoOfUnblockedCells());
+    for (uint8_t bucket = 0; bucket <= MAX_SCORE; bucket++)
+    {
+        const std::vector<uint32_t> &incoming = moved[MAX_SCORE - bucket];
+        auto skip = affected.begin();
+        auto in = incoming.begin();
+        for (size_t rank = previous.bucketStart[bucket]; rank < previous.bucketStart[bucket + 1]; rank++)
+        {
+            const uint32_t cell = previous.order[rank];
+            while (in != incoming.end() && *in < cell)
+            {
+                order.push_back(*in++);
+            }
+            skip = std::lower_bound(skip, affected.end(), cell);
+            if (skip == affected.end() || *skip != cell)
+            {
+                order.push_back(cell);
+            }
+        }
+        order.insert(order.end(), in, incoming.end());
+        bucketStart[bucket + 1] = order.size();
+    }
+}
+
+/**
+ * @struct RankingOptions
+ * @brief Build parameters distinguishing the shared rankings of one world version
+ */
+struct RankingOptions
+{
+    StartScoringWeights weights; ///< Scoring criteria weights
+    StartPruning pruning;        ///< Redundant candidates left out
+
+    bool operator==(const RankingOptions &other) const = default;
+};
+
+/**
+ * @brief Cache of the rankings handed out by getShared() and getPatched()
+ * @return Process-wide cache keyed by world version and options
+ */
+static VersionedCache<CandidateRanking, RankingOptions> &sharedRankings()
+{
+    static VersionedCache<CandidateRanking, RankingOptions> cache(SHARED_RANKING_CAPACITY);
+    return cache;
+}
+
+/**
+ * @brief Returns the ranking of the given world, building it only once per version
+ * @param matrixWorld World to rank
+ * @param weights Scoring criteria weights
+ * @param pruning Redundant candidates to leave out
+ * @return Shared read-only ranking
+ */
+std::shared_ptr<const CandidateRanking> CandidateRanking::getShared(const MatrixWorld &matrixWorld,
+                                                                    const StartScoringWeights &weights,
+                                                                    StartPruning pruning)
+{
+    return sharedRankings().getOrBuild(matrixWorld.getVersion(), {weights, pruning}, [&] {
+        return std::make_shared<const CandidateRanking>(matrixWorld, weights, pruning);
+    });
+}
+
+/**
+ * @brief Returns the ranking of the given world, built from prescored neighbour counts
+ * @param matrixWorld World to rank
+ * @param scores Complete neighbour counts of the world
+ * @param weights Scoring criteria weights
+ * @param pruning Redundant candidates to leave out
+ * @return Shared read-only ranking of the current world version
+ * @throws std::invalid_argument If the scores are incomplete or their dimensions differ
+ */
+std::shared_ptr<const CandidateRanking> CandidateRanking::getPrescored(const MatrixWorld &matrixWorld,
+                                                                       DegreeScores scores,
+                                                                       const StartScoringWeights &weights,
+                                                                       StartPruning pruning)
+{
+    return sharedRankings().getOrBuild(matrixWorld.getVersion(), {weights, pruning}, [&] {
+        return std::make_shared<const CandidateRanking>(matrixWorld, std::move(scores), weights, pruning);
+    });
+}
+
+/**
+ * @brief Returns the ranking of a mutated world, patched from a previous one
+ *
+ * Weighted rankings have non-local criteria (component size, dead-end
+ * distance) and are rebuilt instead. Pruned rankings depend on the symmetries
+ * of the whole world, so the unpruned order is patched and cached first and
+ * the new world's symmetries are then filtered out of it, which yields the
+ * same order as ranking the world from scratch.
+ *
+ * @param matrixWorld World after the changes
+ * @param previous Unpruned ranking of the world before the changes
+ * @param changedCells Cells whose state changed since previous was built
+ * @param pruning Redundant candidates to leave out of the returned ranking
+ * @return Shared read-only ranking of the current world version
+ */
+std::shared_ptr<const CandidateRanking> CandidateRanking::getPatched(
+    const MatrixWorld &matrixWorld,
+    const CandidateRanking &previous,
+    const std::vector<std::pair<uint16_t, uint16_t>> &changedCells,
+    StartPruning pruning)
+{
+    if (!previous.weights.isDegreeOnly() || previous.pruning != StartPruning::None)
+    {
+        return getShared(matrixWorld, previous.weights, pruning);
+    }
+
+    auto patched = sharedRankings().getOrBuild(matrixWorld.getVersion(), {previous.weights, StartPruning::None}, [&] {
+        return std::make_shared<const CandidateRanking>(previous, matrixWorld, changedCells);
+    });
+    if (pruning == StartPruning::None)
+    {
+        return patched;
+    }
+    return sharedRankings().getOrBuild(matrixWorld.getVersion(), {previous.weights, pruning}, [&] {
+        auto pruned = std::make_shared<CandidateRanking>(*patched);
+        pruned->pruneSymmetric(matrixWorld);
+        return std::shared_ptr<const CandidateRanking>(std::move(pruned));
+    });
+}
+
+/**
+ * @brief Creates a cursor over the first limit candidates of a ranking
+ * @param ranking Shared ranking
+ * @param limit Maximum number of candidates handed out
+ */
+SharedCandidateCursor::SharedCandidateCursor(std::shared_ptr<const CandidateRanking> ranking, size_t limit)
+    : ranking(std::move(ranking)), limit(std::min(limit, this->ranking->size()))
+{
+}
+
+/**
+ * @brief Claims the next candidate
+ *
+ * The counter may run past the limit when many workers claim at once; such
+ * claims simply report exhaustion.
+ *
+ * @return (row, col) of the claimed candidate, or std::nullopt when all are taken
+ */
+std::optional<std::pair<uint16_t, uint16_t>> SharedCandidateCursor::claim()
+{
+    size_t rank = next.fetch_add(1, std::memory_order_relaxed);
+    if (rank >= limit)
+    {
+        return std::nullopt;
+    }
+    return ranking->getCell(rank);
+}
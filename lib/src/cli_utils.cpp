@@ -7,15 +7,15 @@
  */
 
 #include "cli_utils.hpp"
+#include "algorithm_registry.hpp"
 #include "performance_guard.hpp"
+#include <charconv>
 #include <cstddef>
 #include <cstdio>
 #include <iostream>
-#include <regex>
+#include <limits>
 #include <stdexcept>
 #include <string> 
-#include <fstream>
-#include <sstream>
 
 /**
  * @brief Prints comprehensive help information for the CLI application
@@ -29,25 +29,63 @@ void printHelp() {
 
 USAGE:
     pathFinder --rows R --cols C --pathLength N [OPTIONS]
+    pathFinder --worldImage FILE --pathLength N [OPTIONS]
+    pathFinder --map FILE --scenario FILE [OPTIONS]
+    producer | pathFinder --stdin image --pathLength N [OPTIONS]
+    pathFinder --batch FILE [--threads N] [OPTIONS]
+    pathFinder --serve SOCKET [--threads N]
 
 REQUIRED:
     --rows R                Number of matrix rows (e.g., --rows 5)
     --cols C                Number of matrix columns (e.g., --cols 5)
+                            (not needed with --worldImage, --map or --stdin image)
     --pathLength N          Target path length (e.g., --pathLength 12)
 
 OPTIONAL:
     --maxStartingPoints N   Maximum starting points to try (default: 5)
     --blockedCells COORDS   Blocked cell coordinates (e.g., --blockedCells {1,0} {2,1})
     --blockedCellsFile FILE Path to file containing blocked cell coordinates
-    --enableMeasurement     Enable performance measurements (wall time and cycles) [*sudo required]
+    --worldImage FILE       Binary PBM (P4) or PGM (P5) occupancy image; dark pixels are blocked
+    --occupiedThreshold T   PGM occupancy (0-1) above which a pixel is blocked (default: 0.5)
+    --map FILE              MovingAI .map world ('.', 'G', 'S' are free, other terrain is blocked)
+    --scenario FILE         Run every query of a MovingAI .scen file and report throughput and
+                            latency percentiles (path length per query: optimal length + 1)
+    --stdin FORMAT          Read the world from standard input as it arrives:
+                              cells - row,col lines blocked in the --rows x --cols world
+                              rows  - packed rows, (cols + 63) / 64 little-endian 64-bit
+                                      words per row, bit c % 64 of word c / 64 = column c
+                              image - binary PBM/PGM image (as --worldImage)
+    --batch FILE            Run every job of a job file on a thread pool, results in job order
+    --serve SOCKET          Run as a daemon on a Unix domain socket, keeping named worlds resident
+                            (see PATH SERVICE below; stop with SIGINT or SIGTERM)
+    --threads N             Batch or service worker threads (default: 0 = one per hardware thread)
+    --algorithm NAME        Path finding engine to run (default: dfs, "auto" selects one)
+    --output FORMAT         Result format (default: text):
+                              text - parameter echo, then the path or a hint
+                              json - one JSON object per query and line, nothing else
+                              csv  - a header line, then one row per query, nothing else
+    --pathEncoding ENC      Path in JSON records: inline ([[row,col],...], default) or
+                            compact (start cell and one U/D/L/R letter per step)
+    --listAlgorithms        List the available path finding engines
+    --enableMeasurement     Measure the search: wall time, perf counter group (cycles, instructions,
+                            cache/branch/L1D misses, task clock, page faults), IPC and miss rates
+                            (added to json/csv records); without perf permissions falls back to user-space
+                            counters, thread CPU time + TSC, then wall time
     --help, -h              Show this help message
 
 EXAMPLES:
     pathFinder --rows 5 --cols 5 --pathLength 6
     pathFinder --rows 8 --cols 8 --pathLength 12 --blockedCells {1,0} {2,0} {1,1}
     pathFinder --rows 10 --cols 10 --pathLength 15 --maxStartingPoints 10
-    sudo pathFinder --rows 10 --cols 10 --pathLength 15 --maxStartingPoints 10 --enableMeasurement
+    pathFinder --rows 10 --cols 10 --pathLength 15 --maxStartingPoints 10 --enableMeasurement
     pathFinder --rows 100 --cols 100 --pathLength 50 --blockedCellsFile blocked_cells.txt
+    pathFinder --rows 100 --cols 100 --pathLength 50 --algorithm auto
+    pathFinder --worldImage map.pgm --occupiedThreshold 0.65 --pathLength 200
+    pathFinder --map arena.map --scenario arena.map.scen --algorithm auto
+    ./obstacles | pathFinder --rows 500 --cols 500 --pathLength 100 --stdin cells
+    pathFinder --batch jobs.txt --threads 8 --algorithm auto
+    pathFinder --batch jobs.txt --output json --pathEncoding compact
+    pathFinder --serve /tmp/pathFinder.sock --threads 8
 
 BLOCKED CELLS FILE FORMAT:
     Each line should contain: row,col
@@ -58,94 +96,174 @@ BLOCKED CELLS FILE FORMAT:
         1,0
         2,2
 
+BATCH JOB FILE FORMAT:
+    One job per line: WORLD PATH_LENGTH [ALGORITHM [MAX_STARTING_POINTS]]
+    WORLD is RxC (open world, e.g. 100x80), a MovingAI .map or a .pbm/.pgm image;
+    each world is loaded once and shared by all its jobs. Missing fields take
+    the --algorithm and --maxStartingPoints values. # starts a comment.
+    Output, one line per job: job INDEX WORLD PATH_LENGTH ALGORITHM STATUS MICROS
+    followed by the path cells (found) or the reason (infeasible, failed).
+    With --output json or csv, one record per job in job order instead.
+
+OUTPUT RECORDS (--output json|csv):
+    status (found, not_found, infeasible, failed), algorithm, world, rows, cols,
+    blocked_cells, path_length (requested), length (found), timings in
+    microseconds (load, feasibility, search, total), path and reason.
+    CSV rows always use the compact path (start_row, start_col, moves).
+
+PATH SERVICE:
+    Length-prefixed binary requests (see path_service.hpp, client in path_client.hpp):
+    load world, mutate cells, query path (with an optional deadline) and cancel.
+    Worlds are named and stay resident; queries run concurrently on the workers.
+    pathLoadGen --socket PATH drives a running service and reports latencies.
+
 NOTES:
     - Matrix cells are 0-indexed
     - Path finds contiguous route through unblocked cells (value 0)
     - Blocked cells have value 1 and cannot be traversed
-    - Algorithm uses DFS with smart starting point selection
+    - Default algorithm uses DFS with smart starting point selection
     - Higher maxStartingPoints increases search thoroughness but takes longer
 )" << std::endl;
 }
 
+/**
+ * @brief Prints the registered path finding engines
+ *
+ * Lists every engine known to the AlgorithmRegistry with its description,
+ * in registration order. Called when user specifies --listAlgorithms.
+ */
+void printAlgorithms() {
+    std::cout << "Available algorithms:" << std::endl;
+    for (const auto &descriptor : AlgorithmRegistry::instance().getDescriptors()) {
+        std::cout << "    " << descriptor.name << " - " << descriptor.description << std::endl;
+    }
+}
+
+/**
+ * @brief Parses an unsigned decimal number at the start of a character range
+ * @tparam Number Unsigned target type bounding the accepted range
+ * @param first Start of the range
+ * @param last End of the range
+ * @param value Parsed number (unchanged on failure)
+ * @return Pointer past the parsed digits, or nullptr if there are no digits
+ *         or the number does not fit into Number
+ */
+template <typename Number>
+static const char *parseUnsigned(const char *first, const char *last, Number &value)
+{
+    uint64_t wide = 0;
+    auto [end, error] = std::from_chars(first, last, wide);
+    if (error != std::errc{} || wide > std::numeric_limits<Number>::max())
+    {
+        return nullptr;
+    }
+    value = static_cast<Number>(wide);
+    return end;
+}
+
+/**
+ * @brief Parses a numeric flag value that must fit into Number
+ * @tparam Number Unsigned target type
+ * @param token Flag value
+ * @param tokenIndex Position of the value on the command line
+ * @param flag Flag name, reported in errors
+ * @return Parsed value
+ * @throws std::invalid_argument If the token is not a number in range
+ */
+template <typename Number>
+static Number parseNumberArgument(std::string_view token, size_t tokenIndex, const char *flag)
+{
+    Number value{};
+    const char *end = parseUnsigned(token.data(), token.data() + token.size(), value);
+    if (end == nullptr || end != token.data() + token.size())
+    {
+        throw std::invalid_argument("Invalid value for " + std::string(flag) + " at token " +
+                                    std::to_string(tokenIndex) + ": '" + std::string(token) + "' (expected 0-" +
+                                    std::to_string(std::numeric_limits<Number>::max()) + ")");
+    }
+    return value;
+}
+
+/**
+ * @brief Parses a fraction flag value in [0, 1]
+ * @param token Flag value
+ * @param tokenIndex Position of the value on the command line
+ * @param flag Flag name, reported in errors
+ * @return Parsed value
+ * @throws std::invalid_argument If the token is not a number between 0 and 1
+ */
+static double parseFractionArgument(std::string_view token, size_t tokenIndex, const char *flag)
+{
+    double value = 0.0;
+    auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+    if (error != std::errc{} || end != token.data() + token.size() || !(value >= 0.0 && value <= 1.0))
+    {
+        throw std::invalid_argument("Invalid value for " + std::string(flag) + " at token " +
+                                    std::to_string(tokenIndex) + ": '" + std::string(token) + "' (expected 0-1)");
+    }
+    return value;
+}
+
+/**
+ * @brief Parses one blocked cell token in place
+ * 
+ * Hand-written scanner over the token characters: optional opening brace,
+ * row digits, comma, column digits, closing brace if opened. No copies, no
+ * regex, no allocation on success.
+ */
+std::pair<uint16_t, uint16_t> parseBlockedCell(std::string_view token, size_t tokenIndex)
+{
+    const char *current = token.data();
+    const char *last = token.data() + token.size();
+    bool braced = current != last && *current == '{';
+    if (braced)
+    {
+        current++;
+        last--; // Closing brace checked below
+    }
+
+    uint16_t row = 0;
+    uint16_t col = 0;
+    if ((!braced || *last == '}') && (current = parseUnsigned(current, last, row)) != nullptr && current != last &&
+        *current == ',' && (current = parseUnsigned(current + 1, last, col)) != nullptr && current == last)
+    {
+        return {row, col};
+    }
+
+    throw std::invalid_argument("Invalid blocked cell at token " + std::to_string(tokenIndex) + ": '" +
+                                std::string(token) + "' (expected {row,col} with values 0-65535)");
+}
+
 /**
  * @brief Extracts blocked cell coordinates from command line arguments
  * @param index Reference to current argument index (modified during parsing)
  * @param argc Total number of command line arguments
  * @param argv Vector of command line argument strings
  * @param params Reference to CLIParameters structure to populate
+ * @throws std::invalid_argument If a token is not a valid cell (see parseBlockedCell)
  * 
  * Parses blocked cell coordinates in format {row,col} or row,col.
- * Handles shell brace expansion by automatically adding braces when missing.
  * Continues parsing until next flag (starting with '-') or end of arguments.
+ * The tokens are counted first so the cell vector is allocated only once.
  * 
  * Supported formats:
  * - {0,1} - Standard format with braces
- * - 0,1   - Shell-expanded format (braces added automatically)
+ * - 0,1   - Shell-expanded format
  */
 static void extractBlockedCells(size_t &index, size_t argc, const std::vector<std::string> &argv, CLIParameters &params)
 {
-    while (index + 1 < argc && argv[index + 1][0] != '-')
+    size_t last = index + 1;
+    while (last < argc && argv[last][0] != '-')
     {
-        std::string cellStr = argv[++index];
-        // Handle shell brace expansion: "0,0" instead of "{0,0}"
-        if (cellStr.find(',') != std::string::npos && cellStr[0] != '{')
-        {
-            cellStr.insert(cellStr.begin(), '{');
-            cellStr += "}"; // Add missing braces
-        }
-        std::regex cellPattern(R"(\{(\d+),(\d+)\})");
-        std::smatch match;
-        if (std::regex_match(cellStr, match, cellPattern))
-        {
-            uint16_t row = static_cast<uint16_t>(std::stoi(match[1]));
-            uint16_t col = static_cast<uint16_t>(std::stoi(match[2]));
-            params.blockedCells.emplace_back(row, col);
-        }
-        else
-        {
-            std::cerr << "Invalid blocked cell format: " << cellStr << std::endl;
-            std::cerr << "Expected format: {row,col}" << std::endl;
-            break;
-        }
+        last++;
     }
-}
-
-static void extractBlockedCellsFromFile(const std::string &filePath, CLIParameters &params)
-{
-    std::ifstream file(filePath);
+    params.blockedCells.reserve(params.blockedCells.size() + (last - index - 1));
 
-    if (!file.is_open())
+    for (index++; index < last; index++)
     {
-        throw std::runtime_error("Can not open file: " + filePath);
-        exit(1);
-    }
-
-    std::string line;
-    while (std::getline(file, line))
-    {
-        // Skip empty lines and comments
-        if (line.empty() || line[0] == '#')
-        {
-            continue;
-        }
-        
-        std::istringstream iss(line);
-        std::string rowStr;
-        std::string colStr;
-
-        if (std::getline(iss, rowStr, ',') && std::getline(iss, colStr))
-        {
-            try
-            {
-                params.blockedCells.emplace_back(static_cast<uint16_t>(std::stoi(rowStr)),
-                                                 static_cast<uint16_t>(std::stoi(colStr)));
-            }
-            catch (const std::exception &e)
-            {
-                std::cerr << "Invalid coordinate format: " << rowStr << "," << colStr << std::endl;
-            }
-        }
+        params.blockedCells.push_back(parseBlockedCell(argv[index], index));
     }
+    index--; // Left on the last consumed token
 }
 
 /**
@@ -161,11 +279,28 @@ static void extractBlockedCellsFromFile(const std::string &filePath, CLIParamete
  * - --pathLength: Target path length (required)
  * - --maxStartingPoints: Maximum starting points to try (optional, default: 5)
  * - --blockedCells: Blocked cell coordinates (optional)
+ * - --blockedCellsFile: File of blocked cells, loaded once the world exists (optional)
+ * - --worldImage: PBM/PGM image the world is built from, replaces --rows/--cols (optional)
+ * - --occupiedThreshold: PGM occupancy threshold (optional, default: 0.5)
+ * - --map: MovingAI .map the world is built from, replaces --rows/--cols (optional)
+ * - --scenario: MovingAI .scen file run as a benchmark (optional)
+ * - --stdin: Stream format of a world read from standard input (optional)
+ * - --batch: Job file run in batch mode (optional)
+ * - --serve: Unix socket served in daemon mode (optional)
+ * - --threads: Batch or service worker threads (optional, default: hardware concurrency)
+ * - --algorithm: Path finding engine name (optional, default: dfs)
+ * - --output: Result format, text, json or csv (optional, default: text)
+ * - --pathEncoding: Path encoding of JSON records (optional, default: inline)
+ * - --listAlgorithms: List engines and exit
  * 
  * Uses type-safe parameter structures (PathLength, MaxStartingPoints) to prevent
  * argument confusion. Delegates blocked cell parsing to extractBlockedCells().
+ * Numeric values are range checked against their 16-bit fields.
+ * 
+ * @throws std::invalid_argument If a numeric value or blocked cell is malformed
+ *         or out of range; the message names the offending token index
  * 
- * @note Function exits with code 0 if --help flag is encountered
+ * @note Function exits with code 0 if --help or --listAlgorithms flag is encountered
  */
 CLIParameters CLIParser(size_t argc, std::vector<std::string> argv) {
     CLIParameters params;
@@ -181,22 +316,66 @@ CLIParameters CLIParser(size_t argc, std::vector<std::string> argv) {
             exit(0);
         }
         else if (argv[index] == std::string("--rows") && index + 1 < argc) {
-            params.rows = static_cast<uint16_t>(std::stoi(argv[++index]));
+            params.rows = parseNumberArgument<uint16_t>(argv[index + 1], index + 1, "--rows");
+            index++;
         }
         else if (argv[index] == std::string("--cols") && index + 1 < argc) {
-            params.cols = static_cast<uint16_t>(std::stoi(argv[++index]));
+            params.cols = parseNumberArgument<uint16_t>(argv[index + 1], index + 1, "--cols");
+            index++;
         }
         else if (argv[index] == std::string("--pathLength") && index + 1 < argc) {
-            params.pathLength.value = static_cast<uint16_t>(std::stoi(argv[++index]));
+            params.pathLength.value = parseNumberArgument<uint16_t>(argv[index + 1], index + 1, "--pathLength");
+            index++;
         }
         else if (argv[index] == std::string("--maxStartingPoints") && index + 1 < argc) {
-            params.maxStartingPoints.value = static_cast<uint16_t>(std::stoi(argv[++index]));
+            params.maxStartingPoints.value =
+                parseNumberArgument<uint16_t>(argv[index + 1], index + 1, "--maxStartingPoints");
+            index++;
         }
         else if (argv[index] == std::string("--blockedCells") && index + 1 < argc) {
             extractBlockedCells(index, argc, argv, params);
         }
         else if (argv[index] == std::string("--blockedCellsFile") && index + 1 < argc) {
-            extractBlockedCellsFromFile(argv[++index], params);
+            params.blockedCellsFile = argv[++index];
+        }
+        else if (argv[index] == std::string("--worldImage") && index + 1 < argc) {
+            params.worldImage = argv[++index];
+        }
+        else if (argv[index] == std::string("--occupiedThreshold") && index + 1 < argc) {
+            params.occupiedThreshold = parseFractionArgument(argv[index + 1], index + 1, "--occupiedThreshold");
+            index++;
+        }
+        else if (argv[index] == std::string("--map") && index + 1 < argc) {
+            params.mapFile = argv[++index];
+        }
+        else if (argv[index] == std::string("--scenario") && index + 1 < argc) {
+            params.scenarioFile = argv[++index];
+        }
+        else if (argv[index] == std::string("--stdin") && index + 1 < argc) {
+            params.stdinFormat = parseStreamFormat(argv[++index]);
+        }
+        else if (argv[index] == std::string("--batch") && index + 1 < argc) {
+            params.batchFile = argv[++index];
+        }
+        else if (argv[index] == std::string("--serve") && index + 1 < argc) {
+            params.serveSocket = argv[++index];
+        }
+        else if (argv[index] == std::string("--threads") && index + 1 < argc) {
+            params.threads = parseNumberArgument<uint16_t>(argv[index + 1], index + 1, "--threads");
+            index++;
+        }
+        else if (argv[index] == std::string("--algorithm") && index + 1 < argc) {
+            params.algorithm = argv[++index];
+        }
+        else if (argv[index] == std::string("--output") && index + 1 < argc) {
+            params.outputFormat = parseOutputFormat(argv[++index]);
+        }
+        else if (argv[index] == std::string("--pathEncoding") && index + 1 < argc) {
+            params.pathEncoding = parsePathEncoding(argv[++index]);
+        }
+        else if (argv[index] == std::string("--listAlgorithms")) {
+            printAlgorithms();
+            exit(0);
         }
         else if (argv[index] == std::string("--enableMeasurement")) {
             PerformanceMeasureGuard::isMeasurementEnabled=true;
@@ -0,0 +1,239 @@
+/**
+ * @file corridor_algorithm.cpp
+ * @brief Implementation of the junction graph search
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "corridor_algorithm.hpp"
+#include "feasibility_oracle.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+/// Marker for "no edge" (root frame, start without prefix)
+static constexpr uint32_t NO_EDGE = std::numeric_limits<uint32_t>::max();
+
+namespace
+{
+/**
+ * @struct SearchFrame
+ * @brief One node of the current junction path
+ */
+struct SearchFrame
+{
+    uint32_t node;    ///< Node reached
+    uint32_t inEdge;  ///< Edge used to reach it (NO_EDGE for the root)
+    size_t nextIndex; ///< Next incident edge to try
+};
+
+/**
+ * @brief Appends the cells of an edge walked away from the given node
+ * @param graph Contracted world
+ * @param edgeId Edge to walk
+ * @param fromNode Node the walk starts at
+ * @param cells Output linear cell indices
+ */
+void appendEdgeCells(const CorridorGraph &graph, uint32_t edgeId, uint32_t fromNode, std::vector<uint32_t> &cells)
+{
+    const CorridorEdge &edge = graph.getEdge(edgeId);
+    if (edge.from == fromNode)
+    {
+        cells.insert(cells.end(), edge.cells.begin(), edge.cells.end());
+    }
+    else
+    {
+        cells.insert(cells.end(), edge.cells.rbegin(), edge.cells.rend());
+    }
+}
+} // namespace
+
+/**
+ * @brief Runs one DFS over the junction graph from a start configuration
+ *
+ * Iterative DFS over nodes with visited-node and used-edge sets. From the
+ * top node every unused edge is either walked whole to an unvisited node, or,
+ * when its far end is already on the path, only considered as the final,
+ * partial step. As soon as the running length reaches the target the cells
+ * are expanded and truncated.
+ *
+ * @param graph Contracted world
+ * @param rootNode Node the search starts at
+ * @param prefixEdge Edge whose cells precede the root, or NO_EDGE
+ * @param targetLength Target path length
+ * @return Path of targetLength cells, or empty path if none starts this way
+ */
+Path CorridorAlgorithm::searchFrom(const CorridorGraph &graph,
+                                   uint32_t rootNode,
+                                   uint32_t prefixEdge,
+                                   uint32_t targetLength)
+{
+    std::vector<bool> isNodeVisited(graph.getNodeCount(), false);
+    std::vector<bool> isEdgeUsed(graph.getEdgeCount(), false);
+    std::vector<SearchFrame> stack;
+
+    // Expands the current junction path plus a final edge into grid cells
+    auto expand = [&](uint32_t lastEdge, bool includeFarNode) {
+        std::vector<uint32_t> cells;
+        if (prefixEdge != NO_EDGE)
+        {
+            appendEdgeCells(graph, prefixEdge, rootNode, cells);
+            std::reverse(cells.begin(), cells.end()); // Walk towards the root
+        }
+        cells.push_back(graph.getNodeCell(rootNode));
+        for (size_t index = 1; index < stack.size(); index++)
+        {
+            appendEdgeCells(graph, stack[index].inEdge, stack[index - 1].node, cells);
+            cells.push_back(graph.getNodeCell(stack[index].node));
+        }
+        if (lastEdge != NO_EDGE)
+        {
+            const CorridorEdge &edge = graph.getEdge(lastEdge);
+            uint32_t topNode = stack.back().node;
+            appendEdgeCells(graph, lastEdge, topNode, cells);
+            if (includeFarNode)
+            {
+                cells.push_back(graph.getNodeCell(edge.from == topNode ? edge.to : edge.from));
+            }
+        }
+
+        Path path;
+        const uint16_t cols = graph.getCols();
+        for (size_t index = 0; index < targetLength; index++)
+        {
+            path.addCoordinate(static_cast<uint16_t>(cells[index] / cols), static_cast<uint16_t>(cells[index] % cols));
+        }
+        return path;
+    };
+
+    uint32_t length = 1;
+    if (prefixEdge != NO_EDGE)
+    {
+        isEdgeUsed[prefixEdge] = true;
+        length += static_cast<uint32_t>(graph.getEdge(prefixEdge).cells.size());
+    }
+    isNodeVisited[rootNode] = true;
+    stack.push_back({rootNode, NO_EDGE, 0});
+    if (length >= targetLength)
+    {
+        return expand(NO_EDGE, false);
+    }
+
+    uint32_t steps = 0;
+    while (!stack.empty())
+    {
+        if ((++steps & 0x3FF) == 0 && isCancelled())
+        {
+            return {};
+        }
+
+        SearchFrame &frame = stack.back();
+        const std::vector<uint32_t> &incident = graph.getIncidentEdges(frame.node);
+        if (frame.nextIndex == incident.size())
+        {
+            // Backtrack
+            isNodeVisited[frame.node] = false;
+            if (frame.inEdge != NO_EDGE)
+            {
+                isEdgeUsed[frame.inEdge] = false;
+                length -= static_cast<uint32_t>(graph.getEdge(frame.inEdge).cells.size()) + 1;
+            }
+            stack.pop_back();
+            continue;
+        }
+
+        uint32_t edgeId = incident[frame.nextIndex++];
+        if (isEdgeUsed[edgeId])
+        {
+            continue;
+        }
+        const CorridorEdge &edge = graph.getEdge(edgeId);
+        uint32_t farNode = edge.from == frame.node ? edge.to : edge.from;
+        auto corridorLength = static_cast<uint32_t>(edge.cells.size());
+
+        if (isNodeVisited[farNode])
+        {
+            // Far end already on the path - the corridor can only end the path
+            if (length + corridorLength >= targetLength)
+            {
+                return expand(edgeId, false);
+            }
+            continue;
+        }
+
+        if (length + corridorLength + 1 >= targetLength)
+        {
+            return expand(edgeId, true);
+        }
+        isEdgeUsed[edgeId] = true;
+        isNodeVisited[farNode] = true;
+        length += corridorLength + 1;
+        stack.push_back({farNode, edgeId, 0});
+    }
+    return {};
+}
+
+/**
+ * @brief Finds a viable path by searching the junction graph
+ *
+ * 1. Validates input parameters and rejects provably infeasible requests
+ * 2. Contracts the world into a CorridorGraph
+ * 3. For every node, searches from the node itself and from each corridor
+ *    leading to it
+ *
+ * @param matrixWorld Reference to the matrix world
+ * @param pathLength Target path length
+ * @param maxStartingPoints Unused
+ * @return Path object containing the found path (empty if none exists)
+ * @throws std::invalid_argument If pathLength is zero or exceeds matrix size
+ */
+Path CorridorAlgorithm::findViablePath(const MatrixWorld &matrixWorld,
+                                       PathLength pathLength,
+                                       MaxStartingPoints maxStartingPoints)
+{
+    (void)maxStartingPoints;
+
+    if (pathLength.value == 0)
+    {
+        throw std::invalid_argument("Path length must be greater than zero");
+    }
+
+    if (pathLength.value > matrixWorld.getTotalCells())
+    {
+        throw std::invalid_argument("Path length exceeds matrix size");
+    }
+
+    if (!checkPathFeasibility(matrixWorld, pathLength).isFeasible)
+    {
+        return {};
+    }
+
+    CorridorGraph graph(matrixWorld);
+    for (uint32_t node = 0; node < graph.getNodeCount(); node++)
+    {
+        if (isCancelled())
+        {
+            return {};
+        }
+
+        Path path = searchFrom(graph, node, NO_EDGE, pathLength.value);
+        if (!path.isEmpty())
+        {
+            return path;
+        }
+        for (uint32_t edgeId : graph.getIncidentEdges(node))
+        {
+            if (graph.getEdge(edgeId).cells.empty())
+            {
+                continue; // Same as the plain start at this node
+            }
+            path = searchFrom(graph, node, edgeId, pathLength.value);
+            if (!path.isEmpty())
+            {
+                return path;
+            }
+        }
+    }
+    return {};
+}
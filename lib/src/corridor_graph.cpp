@@ -0,0 +1,142 @@
+/**
+ * @file corridor_graph.cpp
+ * @brief Implementation of corridor contraction
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "corridor_graph.hpp"
+#include <array>
+#include <limits>
+#include <utility>
+
+/// Marker for "cell is not a node"
+static constexpr uint32_t NO_NODE = std::numeric_limits<uint32_t>::max();
+
+/// 4-directional offsets: up, right, down, left
+static const std::array<std::array<int, 2>, 4> directions = {{{-1, 0}, {0, 1}, {1, 0}, {0, -1}}};
+
+/**
+ * @brief Contracts the corridors of the given world
+ *
+ * 1. Every free cell with degree other than 2 becomes a node
+ * 2. From every node, each free neighbour starts a walk along degree-2 cells
+ *    until the next node is reached; the walked cells form one edge. Cells
+ *    already claimed by an edge (walked from the other end) are skipped
+ * 3. Free cells left unclaimed lie on pure cycles - one cell per cycle is
+ *    promoted to a node and the cycle becomes its self-loop
+ *
+ * @param matrixWorld World to contract
+ */
+CorridorGraph::CorridorGraph(const MatrixWorld &matrixWorld) : cols(matrixWorld.getRowSize())
+{
+    const uint16_t rows = matrixWorld.getColSize();
+    const size_t totalCells = matrixWorld.getTotalCells();
+
+    std::vector<uint32_t> nodeOf(totalCells, NO_NODE);
+    std::vector<bool> isClaimed(totalCells, false);
+
+    // Free neighbours of a cell as linear indices; returns their count
+    auto freeNeighbours = [&](uint32_t cell, std::array<uint32_t, 4> &neighbours) {
+        size_t count = 0;
+        int row = static_cast<int>(cell / cols);
+        int col = static_cast<int>(cell % cols);
+        for (const auto &direction : directions)
+        {
+            int newRow = row + direction[0];
+            int newCol = col + direction[1];
+            if (newRow >= 0 && newRow < static_cast<int>(rows) && newCol >= 0 && newCol < static_cast<int>(cols) &&
+                matrixWorld.isUnblocked(static_cast<uint16_t>(newRow), static_cast<uint16_t>(newCol)))
+            {
+                neighbours[count++] = (static_cast<uint32_t>(newRow) * cols) + static_cast<uint32_t>(newCol);
+            }
+        }
+        return count;
+    };
+
+    auto addNode = [&](uint32_t cell) {
+        nodeOf[cell] = static_cast<uint32_t>(nodeCells.size());
+        nodeCells.push_back(cell);
+        incidence.emplace_back();
+    };
+
+    // Walks every chain leaving the given node and records the new edges
+    auto walkChains = [&](uint32_t node) {
+        std::array<uint32_t, 4> starts{};
+        size_t startCount = freeNeighbours(nodeCells[node], starts);
+        for (size_t index = 0; index < startCount; index++)
+        {
+            uint32_t first = starts[index];
+            CorridorEdge edge;
+            edge.from = node;
+            if (nodeOf[first] != NO_NODE)
+            {
+                // Adjacent junctions - record the edge once, from the smaller id
+                if (nodeOf[first] <= node)
+                {
+                    continue;
+                }
+                edge.to = nodeOf[first];
+            }
+            else
+            {
+                if (isClaimed[first])
+                {
+                    continue; // Chain already walked from its other end
+                }
+                uint32_t previous = nodeCells[node];
+                std::array<uint32_t, 4> neighbours{};
+                uint32_t current = first;
+                while (nodeOf[current] == NO_NODE)
+                {
+                    isClaimed[current] = true;
+                    edge.cells.push_back(current);
+                    // Degree-2 cell - continue through the neighbour we did not come from
+                    freeNeighbours(current, neighbours);
+                    uint32_t next = neighbours[0] != previous ? neighbours[0] : neighbours[1];
+                    previous = current;
+                    current = next;
+                }
+                edge.to = nodeOf[current];
+            }
+
+            auto edgeId = static_cast<uint32_t>(edges.size());
+            incidence[edge.from].push_back(edgeId);
+            if (edge.to != edge.from)
+            {
+                incidence[edge.to].push_back(edgeId);
+            }
+            edges.push_back(std::move(edge));
+        }
+    };
+
+    // 1. Junctions, dead ends and isolated cells
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (uint16_t col = 0; col < cols; col++)
+        {
+            if (matrixWorld.isUnblocked(row, col) && matrixWorld.countUnblockedNeighbors(row, col) != 2)
+            {
+                addNode((static_cast<uint32_t>(row) * cols) + col);
+            }
+        }
+    }
+
+    // 2. Chains between them
+    for (uint32_t node = 0; node < nodeCells.size(); node++)
+    {
+        walkChains(node);
+    }
+
+    // 3. Pure cycles
+    for (uint32_t cell = 0; cell < totalCells; cell++)
+    {
+        if (!isClaimed[cell] && nodeOf[cell] == NO_NODE &&
+            matrixWorld.isUnblocked(static_cast<uint16_t>(cell / cols), static_cast<uint16_t>(cell % cols)))
+        {
+            addNode(cell);
+            walkChains(nodeOf[cell]);
+        }
+    }
+}
@@ -0,0 +1,267 @@
+/**
+ * @file csr_graph.cpp
+ * @brief Implementation of the CSR graph builder and its cache
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "csr_graph.hpp"
+#include "versioned_cache.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+
+/// Number of graphs kept by getShared()
+static constexpr size_t SHARED_GRAPH_CAPACITY = 8;
+
+/// 4-directional offsets: up, right, down, left
+static const std::array<std::array<int, 2>, 4> directions = {{{-1, 0}, {0, 1}, {1, 0}, {0, -1}}};
+
+namespace
+{
+/**
+ * @brief Distance of a cell along the Hilbert curve covering an n×n square
+ * @param n Side of the square (power of two)
+ * @param x Column coordinate
+ * @param y Row coordinate
+ * @return Hilbert index of the cell
+ */
+uint64_t hilbertIndex(uint32_t n, uint32_t x, uint32_t y)
+{
+    uint64_t index = 0;
+    for (uint32_t side = n / 2; side > 0; side /= 2)
+    {
+        uint32_t quadrantX = (x & side) != 0 ? 1 : 0;
+        uint32_t quadrantY = (y & side) != 0 ? 1 : 0;
+        index += static_cast<uint64_t>(side) * side * ((3 * quadrantX) ^ quadrantY);
+
+        // Rotate the quadrant so the curve pattern repeats
+        if (quadrantY == 0)
+        {
+            if (quadrantX == 1)
+            {
+                x = n - 1 - x;
+                y = n - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return index;
+}
+} // namespace
+
+/**
+ * @brief Builds the graph of the given world
+ *
+ * 1. Collects the free cells and their grid neighbours
+ * 2. Computes the node order of the requested numbering
+ * 3. Fills the CSR arrays in node order, each neighbour list sorted by id
+ *
+ * @param matrixWorld World to convert
+ * @param ordering Node numbering to use
+ */
+CsrGraph::CsrGraph(const MatrixWorld &matrixWorld, CellOrdering ordering)
+    : cols(matrixWorld.getRowSize()), worldVersion(matrixWorld.getVersion()), ordering(ordering)
+{
+    const uint16_t rows = matrixWorld.getColSize();
+    const size_t totalCells = matrixWorld.getTotalCells();
+
+    std::vector<bool> isFree(totalCells, false);
+    std::vector<uint32_t> freeCells;
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (uint16_t col = 0; col < cols; col++)
+        {
+            if (matrixWorld.isUnblocked(row, col))
+            {
+                uint32_t cell = (static_cast<uint32_t>(row) * cols) + col;
+                isFree[cell] = true;
+                freeCells.push_back(cell);
+            }
+        }
+    }
+
+    // Free neighbours of a cell as linear indices; returns their count
+    auto freeNeighbours = [&](uint32_t cell, std::array<uint32_t, 4> &neighbours) {
+        size_t count = 0;
+        int row = static_cast<int>(cell / cols);
+        int col = static_cast<int>(cell % cols);
+        for (const auto &direction : directions)
+        {
+            int newRow = row + direction[0];
+            int newCol = col + direction[1];
+            if (newRow >= 0 && newRow < static_cast<int>(rows) && newCol >= 0 && newCol < static_cast<int>(cols))
+            {
+                uint32_t neighbour = (static_cast<uint32_t>(newRow) * cols) + static_cast<uint32_t>(newCol);
+                if (isFree[neighbour])
+                {
+                    neighbours[count++] = neighbour;
+                }
+            }
+        }
+        return count;
+    };
+
+    // Breadth-first pass from source over unvisited cells, appending to order.
+    // With sortByDegree, neighbours are enqueued by increasing degree (Cuthill-McKee).
+    std::vector<bool> isVisited(totalCells, false);
+    auto breadthFirst = [&](uint32_t source, bool sortByDegree, std::vector<uint32_t> &order) {
+        size_t head = order.size();
+        order.push_back(source);
+        isVisited[source] = true;
+        std::array<uint32_t, 4> neighbours{};
+        std::array<uint32_t, 4> unused{};
+        for (; head < order.size(); head++)
+        {
+            size_t count = freeNeighbours(order[head], neighbours);
+            if (sortByDegree)
+            {
+                std::sort(neighbours.begin(), neighbours.begin() + static_cast<std::ptrdiff_t>(count),
+                          [&](uint32_t first, uint32_t second) {
+                              return freeNeighbours(first, unused) < freeNeighbours(second, unused);
+                          });
+            }
+            for (size_t index = 0; index < count; index++)
+            {
+                if (!isVisited[neighbours[index]])
+                {
+                    isVisited[neighbours[index]] = true;
+                    order.push_back(neighbours[index]);
+                }
+            }
+        }
+    };
+
+    std::vector<uint32_t> order;
+    order.reserve(freeCells.size());
+    switch (ordering)
+    {
+    case CellOrdering::RowMajor:
+        order = freeCells;
+        break;
+
+    case CellOrdering::BFS:
+        for (uint32_t cell : freeCells)
+        {
+            if (!isVisited[cell])
+            {
+                breadthFirst(cell, false, order);
+            }
+        }
+        break;
+
+    case CellOrdering::Hilbert:
+    {
+        uint32_t side = 1;
+        while (side < std::max(rows, cols))
+        {
+            side *= 2;
+        }
+        std::vector<std::pair<uint64_t, uint32_t>> keyed;
+        keyed.reserve(freeCells.size());
+        for (uint32_t cell : freeCells)
+        {
+            keyed.emplace_back(hilbertIndex(side, cell % cols, cell / cols), cell);
+        }
+        std::sort(keyed.begin(), keyed.end());
+        for (const auto &entry : keyed)
+        {
+            order.push_back(entry.second);
+        }
+        break;
+    }
+
+    case CellOrdering::ReverseCuthillMcKee:
+    {
+        // Pseudo-peripheral start: a cell of the last level of a scratch BFS
+        // from the first cell of the component
+        std::vector<uint32_t> component;
+        for (uint32_t cell : freeCells)
+        {
+            if (isVisited[cell])
+            {
+                continue;
+            }
+            component.clear();
+            breadthFirst(cell, false, component);
+            for (uint32_t member : component)
+            {
+                isVisited[member] = false;
+            }
+
+            uint32_t start = component.back();
+            breadthFirst(start, true, order);
+        }
+        std::reverse(order.begin(), order.end());
+        break;
+    }
+    }
+
+    // Node numbering and CSR arrays
+    nodeCells = std::move(order);
+    cellNodes.assign(totalCells, NO_NODE);
+    for (uint32_t node = 0; node < nodeCells.size(); node++)
+    {
+        cellNodes[nodeCells[node]] = node;
+    }
+
+    offsets.reserve(nodeCells.size() + 1);
+    offsets.push_back(0);
+    adjacency.reserve(nodeCells.size() * 4);
+    std::array<uint32_t, 4> neighbours{};
+    for (uint32_t cell : nodeCells)
+    {
+        size_t count = freeNeighbours(cell, neighbours);
+        size_t first = adjacency.size();
+        for (size_t index = 0; index < count; index++)
+        {
+            adjacency.push_back(cellNodes[neighbours[index]]);
+        }
+        std::sort(adjacency.begin() + static_cast<std::ptrdiff_t>(first), adjacency.end());
+        offsets.push_back(static_cast<uint32_t>(adjacency.size()));
+    }
+    adjacency.shrink_to_fit();
+}
+
+/**
+ * @brief Returns the graph of the given world, building it only once per version
+ * @param matrixWorld World to convert
+ * @param ordering Node numbering to use
+ * @return Shared read-only graph
+ */
+std::shared_ptr<const CsrGraph> CsrGraph::getShared(const MatrixWorld &matrixWorld, CellOrdering ordering)
+{
+    static VersionedCache<CsrGraph, CellOrdering> cache(SHARED_GRAPH_CAPACITY);
+    return cache.getOrBuild(matrixWorld.getVersion(), ordering,
+                            [&] { return std::make_shared<const CsrGraph>(matrixWorld, ordering); });
+}
+
+/**
+ * @brief Returns the node of a cell
+ * @param row Row coordinate
+ * @param col Column coordinate
+ * @return Node id, or NO_NODE if the cell is blocked
+ * @throws std::out_of_range If the coordinates are outside the world
+ */
+uint32_t CsrGraph::getNode(uint16_t row, uint16_t col) const
+{
+    if (col >= cols)
+    {
+        throw std::out_of_range("Cell is outside the graph's world");
+    }
+    return cellNodes.at((static_cast<size_t>(row) * cols) + col);
+}
+
+/**
+ * @brief Returns the cell of a node
+ * @param node Node id
+ * @return (row, col) of the node
+ * @throws std::out_of_range If the node does not exist
+ */
+std::pair<uint16_t, uint16_t> CsrGraph::getCell(uint32_t node) const
+{
+    uint32_t cell = nodeCells.at(node);
+    return {static_cast<uint16_t>(cell / cols), static_cast<uint16_t>(cell % cols)};
+}
@@ -7,23 +7,36 @@
  */
 
 #include "dfs_algorithm.hpp"
+#include "feasibility_oracle.hpp"
 #include "path_finder_utils.hpp"
 #include <stdexcept>
 #include <array>
 
+/**
+ * @brief Constructs the engine
+ * @param startWeights Weights ranking the starting points
+ */
+DFSAlgorithm::DFSAlgorithm(const StartScoringWeights &startWeights) : startWeights(startWeights)
+{
+}
+
 /**
  * @brief Finds a viable path using DFS with smart starting point selection
  * @param matrixWorld Reference to the matrix world to search in
  * @param pathLength Target path length wrapped in type-safe structure
- * @param maxStartingPoints Maximum starting points to try per batch
+ * @param maxStartingPoints Number of starting points taken from the ranking per batch
  * @return Path object containing found path (empty if no solution found)
  * @throws std::invalid_argument If pathLength is zero or exceeds matrix size
  * 
  * Implementation uses multi-call stateful integration with PathFinderUtils:
  * 1. Validates input parameters for correctness
- * 2. Iteratively requests starting point candidates until exhausted
- * 3. For each candidate, attempts DFS path finding with backtracking
- * 4. Returns first successful path or empty path if no solution exists
+ * 2. Rejects provably infeasible requests in linear time (feasibility oracle)
+ * 3. Iteratively requests starting point candidates, ranked with the
+ *    engine's weights, until exhausted; on a
+ *    symmetric world only one start per orbit is requested, since a path
+ *    from any other start is a mirror or rotation of one from it
+ * 4. For each candidate, attempts DFS path finding with backtracking
+ * 5. Returns first successful path or empty path if no solution exists
  * 
  * Complexity: O(4^L × S) where L is path length and S is starting points tried
  */
@@ -41,26 +54,28 @@ Path DFSAlgorithm::findViablePath(const MatrixWorld &matrixWorld,
         throw std::invalid_argument("Path length exceeds matrix size");
     }
 
-    PathFinderUtils pathFinder;
+    // Exhausting every start of an impossible request costs exponential time
+    if (!checkPathFeasibility(matrixWorld, pathLength).isFeasible)
+    {
+        return {};
+    }
+
+    PathFinderUtils pathFinder(startWeights, StartPruning::Symmetry);
     while (!pathFinder.getIsExhausted())
     {
-        auto startingPoints = pathFinder.findStartingPointCandidates(matrixWorld, maxStartingPoints.value);
-        
-        // Try each starting point
-        for (const auto &start : startingPoints)
+        // Lazy batch - candidates are read straight from the shared ranking
+        for (const auto &start : pathFinder.nextCandidates(matrixWorld, maxStartingPoints.value))
         {
-            std::vector<std::vector<bool>> visited(matrixWorld.getColSize(),
-                                                   std::vector<bool>(matrixWorld.getRowSize(), false));
-            Path currentPath;
-
-            // Mark starting point as visited and add to path
-            visited[start.first][start.second] = true;
-            currentPath.addCoordinate(start.first, start.second);
+            if (isCancelled())
+            {
+                return {};
+            }
 
             // Attempt DFS from this starting point
-            if (dfsRecursive(matrixWorld, currentPath, visited, pathLength.value))
+            Path path = findPathFrom(matrixWorld, start, pathLength);
+            if (!path.isEmpty())
             {
-                return currentPath;
+                return path;
             }
         }
     }
@@ -68,6 +83,32 @@ Path DFSAlgorithm::findViablePath(const MatrixWorld &matrixWorld,
     return {};
 }
 
+/**
+ * @brief Runs the DFS from a single starting cell
+ * @param matrixWorld Reference to the matrix world
+ * @param start (row, col) of the first path cell
+ * @param pathLength Target path length
+ * @return Path starting at start, or empty path if none exists or cancelled
+ */
+Path DFSAlgorithm::findPathFrom(const MatrixWorld &matrixWorld,
+                                std::pair<uint16_t, uint16_t> start,
+                                PathLength pathLength)
+{
+    std::vector<std::vector<bool>> visited(matrixWorld.getColSize(),
+                                           std::vector<bool>(matrixWorld.getRowSize(), false));
+    Path currentPath;
+
+    // Mark starting point as visited and add to path
+    visited[start.first][start.second] = true;
+    currentPath.addCoordinate(start.first, start.second);
+
+    if (dfsRecursive(matrixWorld, currentPath, visited, pathLength.value))
+    {
+        return currentPath;
+    }
+    return {};
+}
+
 /**
  * @brief Recursive DFS implementation with backtracking for path finding
  * @param matrixWorld Reference to the matrix world for bounds and cell checking
@@ -84,6 +125,7 @@ Path DFSAlgorithm::findViablePath(const MatrixWorld &matrixWorld,
  *    - Recursively searches from new position
  *    - Backtracks if recursive call fails (removes from path, marks unvisited)
  * 4. Returns false if no valid path found from current position
+ *    or the search has been cancelled
  * 
  * Uses safe integer arithmetic with bounds checking to prevent overflow.
  * Maintains path contiguity through 4-directional movement only.
@@ -99,6 +141,12 @@ bool DFSAlgorithm::dfsRecursive(const MatrixWorld &matrixWorld,
         return true;
     }
 
+    // Abandon the search when the caller cancelled it
+    if (isCancelled())
+    {
+        return false;
+    }
+
     // Get current position
     auto [currentRow, currentCol] = currentPath.getCurrentCoordinate();
 
@@ -0,0 +1,124 @@
+/**
+ * @file feasibility_oracle.cpp
+ * @brief Implementation of the feasibility oracle
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "feasibility_oracle.hpp"
+#include <algorithm>
+#include <array>
+#include <vector>
+
+/**
+ * @brief Checks cheap necessary conditions for a simple path of the given length
+ *
+ * Flood fills every component once, counting its cells per checkerboard
+ * colour and its dead ends, and keeps the best value of each bound over all
+ * components. The bounds are checked from the weakest to the strongest, so
+ * the reported reason is the most basic condition the request violates.
+ *
+ * @param matrixWorld World to analyze
+ * @param pathLength Requested path length
+ * @return FeasibilityResult with the verdict, the bound and the reason
+ */
+FeasibilityResult checkPathFeasibility(const MatrixWorld &matrixWorld, PathLength pathLength)
+{
+    const uint16_t rows = matrixWorld.getColSize();
+    const uint16_t cols = matrixWorld.getRowSize();
+
+    std::vector<bool> labelled(matrixWorld.getTotalCells(), false);
+    std::vector<uint32_t> stack;
+
+    // 4-directional offsets: up, right, down, left
+    std::array<std::array<int, 2>, 4> directions = {{{-1, 0}, {0, 1}, {1, 0}, {0, -1}}};
+
+    uint32_t freeCells = 0;
+    uint32_t largestComponent = 0;
+    uint32_t parityBound = 0;   // Best min(size, parity bound) over components
+    uint32_t combinedBound = 0; // Best min(size, parity bound, dead-end bound) over components
+
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (uint16_t col = 0; col < cols; col++)
+        {
+            uint32_t index = (static_cast<uint32_t>(row) * cols) + col;
+            if (labelled[index] || !matrixWorld.isUnblocked(row, col))
+            {
+                continue;
+            }
+
+            // New component found - flood fill it
+            std::array<uint32_t, 2> colourCount = {0, 0};
+            uint32_t deadEnds = 0;
+            labelled[index] = true;
+            stack.push_back(index);
+            while (!stack.empty())
+            {
+                uint32_t current = stack.back();
+                stack.pop_back();
+
+                int currentRow = static_cast<int>(current / cols);
+                int currentCol = static_cast<int>(current % cols);
+                colourCount[static_cast<size_t>(currentRow + currentCol) & 1U]++;
+
+                uint32_t degree = 0;
+                for (auto &direction : directions)
+                {
+                    int newRow = currentRow + direction[0];
+                    int newCol = currentCol + direction[1];
+                    if (newRow < 0 || newRow >= static_cast<int>(rows) || newCol < 0 ||
+                        newCol >= static_cast<int>(cols) ||
+                        !matrixWorld.isUnblocked(static_cast<uint16_t>(newRow), static_cast<uint16_t>(newCol)))
+                    {
+                        continue;
+                    }
+                    degree++;
+                    uint32_t neighbour = (static_cast<uint32_t>(newRow) * cols) + static_cast<uint32_t>(newCol);
+                    if (!labelled[neighbour])
+                    {
+                        labelled[neighbour] = true;
+                        stack.push_back(neighbour);
+                    }
+                }
+                deadEnds += degree == 1 ? 1 : 0;
+            }
+
+            uint32_t size = colourCount[0] + colourCount[1];
+            uint32_t minority = std::min(colourCount[0], colourCount[1]);
+            uint32_t componentParityBound = std::min(size, (2 * minority) + (colourCount[0] != colourCount[1] ? 1 : 0));
+            uint32_t deadEndBound = size - (deadEnds > 2 ? deadEnds - 2 : 0);
+
+            freeCells += size;
+            largestComponent = std::max(largestComponent, size);
+            parityBound = std::max(parityBound, componentParityBound);
+            combinedBound = std::max(combinedBound, std::min(componentParityBound, deadEndBound));
+        }
+    }
+
+    FeasibilityResult result;
+    result.upperBound = combinedBound;
+    const uint32_t length = pathLength.value;
+    const std::string requested = "Path length " + std::to_string(length);
+
+    if (length > freeCells)
+    {
+        result.reason = requested + " exceeds the number of free cells (" + std::to_string(freeCells) + ")";
+    }
+    else if (length > largestComponent)
+    {
+        result.reason =
+            requested + " exceeds the largest connected component (" + std::to_string(largestComponent) + " cells)";
+    }
+    else if (length > parityBound)
+    {
+        result.reason = requested + " exceeds the checkerboard parity bound (" + std::to_string(parityBound) + ")";
+    }
+    else if (length > combinedBound)
+    {
+        result.reason = requested + " exceeds the dead-end bound (" + std::to_string(combinedBound) + ")";
+    }
+    result.isFeasible = result.reason.empty();
+    return result;
+}
@@ -0,0 +1,338 @@
+/**
+ * @file local_search_algorithm.cpp
+ * @brief Implementation of the detour insertion local search
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "local_search_algorithm.hpp"
+#include "path_finder_utils.hpp"
+#include "path_validation.hpp"
+#include "tree_diameter.hpp"
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/// Marker for "no linked cell" in the next/prev arrays
+static constexpr uint32_t NO_CELL = std::numeric_limits<uint32_t>::max();
+
+/// 4-directional offsets: up, right, down, left
+static const std::array<std::array<int, 2>, 4> directions = {{{-1, 0}, {0, 1}, {1, 0}, {0, -1}}};
+
+/**
+ * @brief Extends a seed path to the requested length
+ *
+ * Algorithm:
+ * 1. Validates the (truncated) seed and links it into next/prev arrays
+ * 2. Pushes every step of the path on a worklist
+ * 3. While the path is too short:
+ *    - Pops a step a→b; if it is still a step of the path, tries to replace
+ *      it with a U-shaped detour on either side (new steps are pushed)
+ *    - When the worklist is empty, tries to extend the tail, then the head
+ *    - When no move applies, the search is stuck and returns an empty path
+ * 4. A detour may overshoot the target by one cell, which is trimmed
+ *
+ * @param matrixWorld Reference to the matrix world
+ * @param seedPath Simple contiguous path to start from
+ * @param pathLength Target path length
+ * @return Extended path or empty path if stuck
+ * @throws std::invalid_argument If the seed is empty or invalid
+ */
+Path LocalSearchAlgorithm::extendPath(const MatrixWorld &matrixWorld, const Path &seedPath, PathLength pathLength)
+{
+    if (seedPath.isEmpty())
+    {
+        throw std::invalid_argument("Seed path must not be empty");
+    }
+
+    const uint16_t rows = matrixWorld.getColSize();
+    const uint16_t cols = matrixWorld.getRowSize();
+    const size_t targetLength = pathLength.value;
+
+    // Truncate the seed to the target and validate it
+    Path seed;
+    for (const auto &[row, col] : seedPath)
+    {
+        if (seed.getLength() == targetLength)
+        {
+            break;
+        }
+        seed.addCoordinate(row, col);
+    }
+    if (!isViablePath(matrixWorld, seed, {static_cast<uint16_t>(seed.getLength())}))
+    {
+        throw std::invalid_argument("Seed is not a simple contiguous path of unblocked cells");
+    }
+
+    // Doubly linked list over linear cell indices
+    std::vector<uint32_t> next(matrixWorld.getTotalCells(), NO_CELL);
+    std::vector<uint32_t> prev(matrixWorld.getTotalCells(), NO_CELL);
+    std::vector<bool> onPath(matrixWorld.getTotalCells(), false);
+    std::vector<std::pair<uint32_t, uint32_t>> worklist;
+
+    uint32_t head = NO_CELL;
+    uint32_t tail = NO_CELL;
+    for (const auto &[row, col] : seed)
+    {
+        uint32_t cell = (static_cast<uint32_t>(row) * cols) + col;
+        onPath[cell] = true;
+        if (tail != NO_CELL)
+        {
+            next[tail] = cell;
+            prev[cell] = tail;
+            worklist.emplace_back(tail, cell);
+        }
+        else
+        {
+            head = cell;
+        }
+        tail = cell;
+    }
+    size_t length = seed.getLength();
+
+    // Free cell that is not yet part of the path (signed coordinates for bounds checks)
+    auto isAvailable = [&](int row, int col) {
+        return row >= 0 && row < static_cast<int>(rows) && col >= 0 && col < static_cast<int>(cols) &&
+               !onPath[(static_cast<size_t>(row) * cols) + static_cast<size_t>(col)] &&
+               matrixWorld.isUnblocked(static_cast<uint16_t>(row), static_cast<uint16_t>(col));
+    };
+    auto toCell = [cols](int row, int col) { return (static_cast<uint32_t>(row) * cols) + static_cast<uint32_t>(col); };
+
+    uint32_t moves = 0;
+    while (length < targetLength)
+    {
+        if ((++moves & 0x3FF) == 0 && isCancelled())
+        {
+            return {};
+        }
+
+        if (!worklist.empty())
+        {
+            auto [from, to] = worklist.back();
+            worklist.pop_back();
+            if (next[from] != to)
+            {
+                continue; // Step was replaced by an earlier detour
+            }
+
+            int fromRow = static_cast<int>(from / cols);
+            int fromCol = static_cast<int>(from % cols);
+            int stepRow = static_cast<int>(to / cols) - fromRow;
+            int stepCol = static_cast<int>(to % cols) - fromCol;
+
+            // Both sides perpendicular to the step
+            std::array<std::array<int, 2>, 2> sides = {{{-stepCol, stepRow}, {stepCol, -stepRow}}};
+            for (const auto &side : sides)
+            {
+                int detourFromRow = fromRow + side[0];
+                int detourFromCol = fromCol + side[1];
+                int detourToRow = detourFromRow + stepRow;
+                int detourToCol = detourFromCol + stepCol;
+                if (!isAvailable(detourFromRow, detourFromCol) || !isAvailable(detourToRow, detourToCol))
+                {
+                    continue;
+                }
+
+                uint32_t detourFrom = toCell(detourFromRow, detourFromCol);
+                uint32_t detourTo = toCell(detourToRow, detourToCol);
+                onPath[detourFrom] = true;
+                onPath[detourTo] = true;
+                next[from] = detourFrom;
+                prev[detourFrom] = from;
+                next[detourFrom] = detourTo;
+                prev[detourTo] = detourFrom;
+                next[detourTo] = to;
+                prev[to] = detourTo;
+                worklist.emplace_back(from, detourFrom);
+                worklist.emplace_back(detourFrom, detourTo);
+                worklist.emplace_back(detourTo, to);
+                length += 2;
+                break;
+            }
+            continue;
+        }
+
+        // No detour left - try to extend either end of the path
+        bool isExtended = false;
+        for (const auto &direction : directions)
+        {
+            int newRow = static_cast<int>(tail / cols) + direction[0];
+            int newCol = static_cast<int>(tail % cols) + direction[1];
+            if (isAvailable(newRow, newCol))
+            {
+                uint32_t cell = toCell(newRow, newCol);
+                onPath[cell] = true;
+                next[tail] = cell;
+                prev[cell] = tail;
+                worklist.emplace_back(tail, cell);
+                tail = cell;
+                isExtended = true;
+                break;
+            }
+        }
+        for (size_t index = 0; index < directions.size() && !isExtended; index++)
+        {
+            int newRow = static_cast<int>(head / cols) + directions[index][0];
+            int newCol = static_cast<int>(head % cols) + directions[index][1];
+            if (isAvailable(newRow, newCol))
+            {
+                uint32_t cell = toCell(newRow, newCol);
+                onPath[cell] = true;
+                prev[head] = cell;
+                next[cell] = head;
+                worklist.emplace_back(cell, head);
+                head = cell;
+                isExtended = true;
+            }
+        }
+        if (!isExtended)
+        {
+            return {}; // Stuck - no local move applies
+        }
+        length++;
+    }
+
+    // Walk the list; a final detour may have overshot the target by one cell
+    Path result;
+    for (uint32_t cell = head; cell != NO_CELL && result.getLength() < targetLength; cell = next[cell])
+    {
+        result.addCoordinate(static_cast<uint16_t>(cell / cols), static_cast<uint16_t>(cell % cols));
+    }
+    return result;
+}
+
+/**
+ * @brief Builds a greedy walk from a starting cell using Warnsdorff's rule
+ *
+ * Moving to the neighbour with the fewest onward options keeps the walk from
+ * cutting off regions early, which leaves good detour opportunities.
+ *
+ * @param matrixWorld Reference to the matrix world
+ * @param startRow Row of the first cell
+ * @param startCol Column of the first cell
+ * @param maxLength Maximum walk length
+ * @return Greedy walk starting at (startRow, startCol)
+ */
+Path LocalSearchAlgorithm::buildGreedySeed(const MatrixWorld &matrixWorld,
+                                           uint16_t startRow,
+                                           uint16_t startCol,
+                                           uint16_t maxLength)
+{
+    const int rows = matrixWorld.getColSize();
+    const int cols = matrixWorld.getRowSize();
+    std::vector<bool> visited(matrixWorld.getTotalCells(), false);
+
+    auto isAvailable = [&](int row, int col) {
+        return row >= 0 && row < rows && col >= 0 && col < cols &&
+               !visited[(static_cast<size_t>(row) * cols) + static_cast<size_t>(col)] &&
+               matrixWorld.isUnblocked(static_cast<uint16_t>(row), static_cast<uint16_t>(col));
+    };
+
+    Path seed;
+    int row = startRow;
+    int col = startCol;
+    visited[(static_cast<size_t>(row) * cols) + static_cast<size_t>(col)] = true;
+    seed.addCoordinate(startRow, startCol);
+
+    while (seed.getLength() < maxLength)
+    {
+        int bestRow = -1;
+        int bestCol = -1;
+        int bestOptions = static_cast<int>(directions.size()) + 1;
+        for (const auto &direction : directions)
+        {
+            int newRow = row + direction[0];
+            int newCol = col + direction[1];
+            if (!isAvailable(newRow, newCol))
+            {
+                continue;
+            }
+
+            int options = 0;
+            for (const auto &onward : directions)
+            {
+                options += isAvailable(newRow + onward[0], newCol + onward[1]) ? 1 : 0;
+            }
+            if (options < bestOptions)
+            {
+                bestOptions = options;
+                bestRow = newRow;
+                bestCol = newCol;
+            }
+        }
+
+        if (bestRow < 0)
+        {
+            break; // Dead end
+        }
+        row = bestRow;
+        col = bestCol;
+        visited[(static_cast<size_t>(row) * cols) + static_cast<size_t>(col)] = true;
+        seed.addCoordinate(static_cast<uint16_t>(row), static_cast<uint16_t>(col));
+    }
+    return seed;
+}
+
+/**
+ * @brief Finds a viable path by extending seed paths
+ *
+ * The first seed is the spanning tree diameter, a guaranteed long simple
+ * path computed in linear time. If it cannot be grown to the target, up to
+ * maxStartingPoints best ranked starting points from PathFinderUtils are
+ * turned into greedy seeds and extended with extendPath(). Returns the first
+ * path reaching the target length.
+ *
+ * @param matrixWorld Reference to the matrix world
+ * @param pathLength Target path length
+ * @param maxStartingPoints Number of seeds to try
+ * @return Path object containing the found path (empty if none found)
+ * @throws std::invalid_argument If pathLength is zero or exceeds matrix size
+ */
+Path LocalSearchAlgorithm::findViablePath(const MatrixWorld &matrixWorld,
+                                          PathLength pathLength,
+                                          MaxStartingPoints maxStartingPoints)
+{
+    if (pathLength.value == 0)
+    {
+        throw std::invalid_argument("Path length must be greater than zero");
+    }
+
+    if (pathLength.value > matrixWorld.getTotalCells())
+    {
+        throw std::invalid_argument("Path length exceeds matrix size");
+    }
+
+    Path diameter = TreeDiameterAlgorithm::computeDiameterPath(matrixWorld);
+    if (!diameter.isEmpty())
+    {
+        Path result = extendPath(matrixWorld, diameter, pathLength);
+        if (!result.isEmpty())
+        {
+            return result;
+        }
+    }
+
+    // Candidate batches are limited to the matrix size
+    size_t seedCount = std::min<size_t>(std::max<uint16_t>(maxStartingPoints.value, 1), matrixWorld.getTotalCells());
+
+    PathFinderUtils pathFinder;
+    for (const auto &start : pathFinder.nextCandidates(matrixWorld, static_cast<uint16_t>(seedCount)))
+    {
+        if (isCancelled())
+        {
+            return {};
+        }
+
+        Path seed = buildGreedySeed(matrixWorld, start.first, start.second, pathLength.value);
+        Path result = extendPath(matrixWorld, seed, pathLength);
+        if (!result.isEmpty())
+        {
+            return result;
+        }
+    }
+    return {};
+}
@@ -0,0 +1,70 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Implementation of the read-only file mapping
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "mapped_file.hpp"
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Maps the file
+ *
+ * Empty files are not mapped (mmap rejects zero lengths); their text is
+ * simply empty. The mapping is advised for sequential access.
+ *
+ * @param filePath Path of the file
+ * @throws std::runtime_error If the file cannot be opened or mapped
+ */
+MappedFile::MappedFile(const std::string &filePath) : descriptor(open(filePath.c_str(), O_RDONLY))
+{
+    struct stat info{};
+    if (descriptor < 0 || fstat(descriptor, &info) != 0)
+    {
+        closeDescriptor();
+        throw std::runtime_error("Can not open file: " + filePath);
+    }
+    size = static_cast<size_t>(info.st_size);
+    if (size == 0)
+    {
+        return; // Nothing to map
+    }
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (mapped == MAP_FAILED)
+    {
+        closeDescriptor();
+        throw std::runtime_error("Can not map file: " + filePath);
+    }
+    data = static_cast<const char *>(mapped);
+    madvise(mapped, size, MADV_SEQUENTIAL);
+}
+
+/**
+ * @brief Unmaps the file and closes its descriptor
+ */
+MappedFile::~MappedFile()
+{
+    if (data != nullptr)
+    {
+        munmap(const_cast<char *>(data), size);
+    }
+    closeDescriptor();
+}
+
+/**
+ * @brief Closes the file descriptor if open
+ */
+void MappedFile::closeDescriptor()
+{
+    if (descriptor >= 0)
+    {
+        close(descriptor);
+        descriptor = -1;
+    }
+}
@@ -11,6 +11,8 @@
 #include <cstddef>
 #include <stdexcept>
 #include <array>
+#include <atomic>
+#include <bit>
 
 /**
  * @brief Constructor implementation - initializes matrix with given dimensions
@@ -18,7 +20,7 @@
  * Delegates to matrixInitialize() for actual initialization work.
  * Allows exceptions to bubble up naturally for proper error handling.
  */
-MatrixWorld::MatrixWorld(uint16_t rows, uint16_t cols)
+MatrixWorld::MatrixWorld(uint16_t rows, uint16_t cols) : rows(0), cols(0), wordsPerRow(0), version(0)
 {
     matrixInitialize(rows, cols); // Exceptions bubble up
 }
@@ -99,11 +101,60 @@ bool MatrixWorld::matrixBlanking(std::vector<std::pair<uint16_t, uint16_t>> coor
     return result;
 }
 
+/**
+ * @brief Blocks every cell whose bit is set in a packed mask
+ * 
+ * Applies the whole mask as one band through matrixBlankingRows().
+ * 
+ * @param mask Packed words in the matrix layout
+ * @return true if the mask was applied, false on a size mismatch
+ */
+bool MatrixWorld::matrixBlankingMask(const std::vector<uint64_t> &mask)
+{
+    return mask.size() == worldMatrix.size() && matrixBlankingRows(0, mask.data(), rows);
+}
+
+/**
+ * @brief Blocks every cell whose bit is set in a packed band of rows
+ * 
+ * Padding bits are already set in the matrix words, so they never count as
+ * newly blocked. The version is bumped only if at least one cell changed.
+ * 
+ * @param firstRow First row covered by words
+ * @param words Packed words in the matrix layout
+ * @param rowCount Number of rows covered by words
+ * @return true if the band was applied, false if it extends past the last row
+ */
+bool MatrixWorld::matrixBlankingRows(uint16_t firstRow, const uint64_t *words, size_t rowCount)
+{
+    if (static_cast<size_t>(firstRow) + rowCount > rows)
+    {
+        return false;
+    }
+
+    uint64_t *target = worldMatrix.data() + (firstRow * wordsPerRow);
+    uint32_t newlyBlocked = 0;
+    for (size_t word = 0; word < rowCount * wordsPerRow; word++)
+    {
+        newlyBlocked += static_cast<uint32_t>(std::popcount(words[word] & ~target[word]));
+        target[word] |= words[word];
+    }
+
+    if (newlyBlocked != 0)
+    {
+        noOfUnblockedCells -= newlyBlocked;
+        noOfBlockedCells += newlyBlocked;
+        bumpVersion();
+    }
+    return true;
+}
+
 /**
  * @brief Core matrix initialization implementation
  * 
  * Validates dimensions, calculates memory requirements, and initializes
- * internal data structures. All cells start as unblocked (false).
+ * internal data structures. All cells start as unblocked (false); each row
+ * is padded to a whole number of 64-bit words.
  * Updates dimension variables and cell counters.
  * 
  * @param rows Number of matrix rows
@@ -119,16 +170,20 @@ void MatrixWorld::matrixInitialize(uint16_t rows, uint16_t cols)
     }
 
     size_t matrixSize = static_cast<size_t>(rows) * cols;
-    if (matrixSize > worldMatrix.max_size())
+    size_t words = rows * ((static_cast<size_t>(cols) + 63) / 64);
+    if (words > worldMatrix.max_size())
     {
         throw std::length_error("Matrix is too large for memory");
     }
 
     this->rows = rows;
     this->cols = cols;
-    worldMatrix.resize(matrixSize, false);
+    wordsPerRow = (static_cast<size_t>(cols) + 63) / 64;
+    worldMatrix.resize(words);
+    resetWords();
     noOfUnblockedCells = static_cast<uint32_t>(matrixSize);
     noOfBlockedCells = 0;
+    bumpVersion();
 }
 
 /**
@@ -160,10 +215,13 @@ bool MatrixWorld::setCell(uint16_t row, uint16_t col, bool state)
 {
     try
     {
-        size_t indexToChange = getIndex(row, col);
-        if (worldMatrix[indexToChange] != state)
+        (void)getIndex(row, col);
+        uint64_t &word = worldMatrix[(row * wordsPerRow) + (col / 64)];
+        const uint64_t bit = uint64_t{1} << (col % 64);
+        if (((word & bit) != 0) != state)
         {
-            worldMatrix[indexToChange] = state;
+            word ^= bit;
+            bumpVersion();
             // State change successful, update counters
             if (state)
             {
@@ -199,7 +257,7 @@ bool MatrixWorld::setCell(uint16_t row, uint16_t col, bool state)
 /**
  * @brief Resets all cells to unblocked state
  * 
- * Uses vector::assign() for efficient bulk operation.
+ * Rewrites the packed words in bulk.
  * Resets cell counters to reflect all-unblocked state.
  * Checks for empty matrix to avoid unnecessary operations.
  * 
@@ -212,9 +270,10 @@ bool MatrixWorld::clearMatrix()
         return false;
     }
 
-    worldMatrix.assign(worldMatrix.size(), false);
-    noOfUnblockedCells = static_cast<uint32_t>(worldMatrix.size());
+    resetWords();
+    noOfUnblockedCells = static_cast<uint32_t>(getTotalCells());
     noOfBlockedCells = 0;
+    bumpVersion();
     return true;
 }
 
@@ -304,8 +363,9 @@ uint16_t MatrixWorld::countUnblockedNeighbors(uint16_t row, uint16_t col) const
  */
 bool MatrixWorld::isUnblocked(uint16_t row, uint16_t col) const
 {
-    size_t indexToCheck = getIndex(row, col);
-    return !worldMatrix[indexToCheck];  // Invert: false=unblocked, true=blocked
+    (void)getIndex(row, col);  // Bounds check
+    // Invert: 0=unblocked, 1=blocked
+    return ((worldMatrix[(row * wordsPerRow) + (col / 64)] >> (col % 64)) & 1U) == 0;
 }
 
 /**
@@ -356,13 +416,76 @@ double MatrixWorld::getBlockedToUnblockedRatio() const
 /**
  * @brief Returns total number of cells in the matrix
  * 
- * O(1) operation using vector::size() method.
- * Equivalent to rows × cols but uses actual container size.
+ * O(1) operation; rows × cols, padding words excluded.
  * Useful for validation and capacity calculations.
  * 
  * @return Total cell count in the matrix
  */
 size_t MatrixWorld::getTotalCells() const
 {
-    return worldMatrix.size();
+    return static_cast<size_t>(rows) * cols;
+}
+
+/**
+ * @brief Assigns a new process-wide unique version to the world
+ *
+ * A single relaxed atomic counter shared by all worlds is enough: only
+ * uniqueness matters, not ordering between threads.
+ */
+void MatrixWorld::bumpVersion()
+{
+    static std::atomic<uint64_t> nextVersion{1};
+    version = nextVersion.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the content version of the world
+ * @return Version number identifying the current matrix content
+ */
+uint64_t MatrixWorld::getVersion() const
+{
+    return version;
+}
+
+/**
+ * @brief Marks every cell unblocked and every padding bit blocked
+ *
+ * Padding lives in the high bits of the last word of each row.
+ */
+void MatrixWorld::resetWords()
+{
+    std::fill(worldMatrix.begin(), worldMatrix.end(), 0);
+    const unsigned usedBits = cols % 64;
+    if (usedBits != 0)
+    {
+        const uint64_t padding = ~uint64_t{0} << usedBits;
+        for (size_t row = 0; row < rows; row++)
+        {
+            worldMatrix[(row * wordsPerRow) + wordsPerRow - 1] = padding;
+        }
+    }
+}
+
+/**
+ * @brief Returns the number of 64-bit words storing one row
+ * @return Words per row
+ */
+size_t MatrixWorld::getWordsPerRow() const
+{
+    return wordsPerRow;
+}
+
+/**
+ * @brief Returns the packed words of a row
+ * @param row Row coordinate (0-based)
+ * @return Pointer to the first word of the row
+ * @throws std::invalid_argument If row is out of bounds
+ */
+const uint64_t *MatrixWorld::getRowWords(uint16_t row) const
+{
+    if (row >= rows)
+    {
+        throw std::invalid_argument("The given parameters are out of bounds of the matrix");
+    }
+    return worldMatrix.data() + (row * wordsPerRow);
 }
@@ -0,0 +1,334 @@
+/**
+ * @file moving_ai.cpp
+ * @brief Implementation of the MovingAI .map/.scen loaders and scenario runner
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "moving_ai.hpp"
+#include "mapped_file.hpp"
+#include "path_validation.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+/**
+ * @class LineReader
+ * @brief Iterates over the lines of a text, dropping trailing carriage returns
+ */
+class LineReader
+{
+    std::string_view text;
+    size_t position = 0;
+    size_t lineNumber = 0;
+
+public:
+    explicit LineReader(std::string_view text) : text(text) {}
+
+    /**
+     * @brief Reads the next line
+     * @param line Line without its terminator
+     * @return false at the end of the text
+     */
+    bool next(std::string_view &line)
+    {
+        if (position >= text.size())
+        {
+            return false;
+        }
+        size_t newline = text.find('\n', position);
+        size_t end = newline == std::string_view::npos ? text.size() : newline;
+        line = text.substr(position, end - position);
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.remove_suffix(1);
+        }
+        position = end + 1;
+        lineNumber++;
+        return true;
+    }
+
+    /**
+     * @brief Builds an error naming the current line
+     */
+    [[nodiscard]] std::invalid_argument error(const std::string &message) const
+    {
+        return std::invalid_argument(message + " at line " + std::to_string(lineNumber));
+    }
+};
+
+/**
+ * @brief Whether a MovingAI terrain character can be traversed
+ */
+constexpr bool isFreeTerrain(char terrain)
+{
+    return terrain == '.' || terrain == 'G' || terrain == 'S';
+}
+
+/**
+ * @brief Parses the value of a "height H" or "width W" header line
+ * @return Value, or 0 if it is missing or out of range
+ */
+uint16_t parseDimension(std::string_view value)
+{
+    while (!value.empty() && (value.front() == ' ' || value.front() == '\t'))
+    {
+        value.remove_prefix(1);
+    }
+    uint32_t dimension = 0;
+    auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), dimension);
+    if (error != std::errc{} || end != value.data() + value.size() || dimension > UINT16_MAX)
+    {
+        return 0;
+    }
+    return static_cast<uint16_t>(dimension);
+}
+} // namespace
+
+/**
+ * @brief Decodes a MovingAI .map file into a world
+ *
+ * Header lines may come in any order until the "map" line; the grid rows are
+ * packed into a bitmap in the world's layout.
+ *
+ * @param text File contents
+ * @return World of height rows and width columns
+ * @throws std::invalid_argument If the header or the grid is malformed
+ */
+MatrixWorld loadMovingAiMap(std::string_view text)
+{
+    LineReader reader(text);
+    std::string_view line;
+    uint16_t height = 0;
+    uint16_t width = 0;
+    bool gridFound = false;
+    while (!gridFound && reader.next(line))
+    {
+        if (line.rfind("height", 0) == 0)
+        {
+            height = parseDimension(line.substr(6));
+        }
+        else if (line.rfind("width", 0) == 0)
+        {
+            width = parseDimension(line.substr(5));
+        }
+        else if (line == "map")
+        {
+            gridFound = true;
+        }
+        else if (line.rfind("type", 0) != 0 && !line.empty())
+        {
+            throw reader.error("Unexpected map header line");
+        }
+    }
+    if (!gridFound || height == 0 || width == 0)
+    {
+        throw reader.error("Map header needs height and width of 1-65535 before the map line");
+    }
+
+    MatrixWorld world(height, width);
+    const size_t words = world.getWordsPerRow();
+    std::vector<uint64_t> mask(height * words, 0);
+    for (size_t row = 0; row < height; row++)
+    {
+        if (!reader.next(line))
+        {
+            throw reader.error("Map has fewer rows than its height");
+        }
+        if (line.size() != width)
+        {
+            throw reader.error("Map row does not match the width");
+        }
+        uint64_t *rowWords = mask.data() + (row * words);
+        for (size_t col = 0; col < width; col++)
+        {
+            rowWords[col / 64] |= uint64_t{!isFreeTerrain(line[col])} << (col % 64);
+        }
+    }
+
+    world.matrixBlankingMask(mask);
+    return world;
+}
+
+/**
+ * @brief Loads a MovingAI .map file into a world
+ * @param filePath Path of the .map file
+ * @return Decoded world
+ * @throws std::runtime_error If the file cannot be opened or mapped
+ * @throws std::invalid_argument If the file is malformed
+ */
+MatrixWorld loadMovingAiMapFile(const std::string &filePath)
+{
+    MappedFile file(filePath);
+    return loadMovingAiMap(file.getText());
+}
+
+/**
+ * @brief Parses a MovingAI .scen file
+ *
+ * Fields are whitespace separated; coordinates must fit the map dimensions
+ * given on the same line.
+ *
+ * @param text File contents
+ * @return Queries in file order
+ * @throws std::invalid_argument If a line is malformed or a point lies outside its map
+ */
+std::vector<ScenarioEntry> loadScenarios(std::string_view text)
+{
+    std::vector<ScenarioEntry> scenarios;
+    LineReader reader(text);
+    std::string_view line;
+    while (reader.next(line))
+    {
+        if (line.find_first_not_of(" \t") == std::string_view::npos || line.rfind("version", 0) == 0)
+        {
+            continue;
+        }
+
+        std::istringstream fields{std::string(line)};
+        ScenarioEntry entry;
+        int64_t numbers[6] = {};
+        fields >> entry.bucket >> entry.mapName;
+        for (int64_t &number : numbers)
+        {
+            fields >> number;
+        }
+        fields >> entry.optimalLength;
+        std::string extra;
+        if (fields.fail() || (fields >> extra) ||
+            std::any_of(std::begin(numbers), std::end(numbers),
+                        [](int64_t number) { return number < 0 || number > UINT16_MAX; }))
+        {
+            throw reader.error("Invalid scenario line");
+        }
+
+        entry.mapWidth = static_cast<uint16_t>(numbers[0]);
+        entry.mapHeight = static_cast<uint16_t>(numbers[1]);
+        entry.startX = static_cast<uint16_t>(numbers[2]);
+        entry.startY = static_cast<uint16_t>(numbers[3]);
+        entry.goalX = static_cast<uint16_t>(numbers[4]);
+        entry.goalY = static_cast<uint16_t>(numbers[5]);
+        if (entry.startX >= entry.mapWidth || entry.goalX >= entry.mapWidth || entry.startY >= entry.mapHeight ||
+            entry.goalY >= entry.mapHeight)
+        {
+            throw reader.error("Scenario point outside the map");
+        }
+        scenarios.push_back(std::move(entry));
+    }
+    return scenarios;
+}
+
+/**
+ * @brief Loads a MovingAI .scen file
+ * @param filePath Path of the .scen file
+ * @return Queries in file order
+ * @throws std::runtime_error If the file cannot be opened or mapped
+ * @throws std::invalid_argument If the file is malformed
+ */
+std::vector<ScenarioEntry> loadScenarioFile(const std::string &filePath)
+{
+    MappedFile file(filePath);
+    return loadScenarios(file.getText());
+}
+
+/**
+ * @brief Path length requested for a scenario query
+ * @param entry Scenario query
+ * @return floor(optimalLength) + 1, capped at 65535
+ *
+ * Derived from the optimal octile cost, not the cell count of the route.
+ */
+PathLength scenarioPathLength(const ScenarioEntry &entry)
+{
+    double length = std::floor(std::max(0.0, entry.optimalLength)) + 1.0;
+    return {static_cast<uint16_t>(std::min(length, static_cast<double>(UINT16_MAX)))};
+}
+
+/**
+ * @brief Runs every scenario query against an engine
+ *
+ * 1. Checks every query against the map dimensions
+ * 2. Times findViablePath() per query with a steady clock
+ * 3. Validates each answer, then sorts the latencies for the percentiles
+ *
+ * @param matrixWorld World decoded from the scenarios' map
+ * @param scenarios Queries to run
+ * @param algorithm Engine answering the queries
+ * @param maxStartingPoints Starting points passed to every query
+ * @return Throughput, latency percentiles and validity counts
+ * @throws std::invalid_argument If a query was generated for a map of other dimensions
+ */
+ScenarioReport runScenarios(const MatrixWorld &matrixWorld, const std::vector<ScenarioEntry> &scenarios,
+                            PathAlgorithm &algorithm, MaxStartingPoints maxStartingPoints)
+{
+    for (size_t index = 0; index < scenarios.size(); index++)
+    {
+        if (scenarios[index].mapHeight != matrixWorld.getColSize() ||
+            scenarios[index].mapWidth != matrixWorld.getRowSize())
+        {
+            throw std::invalid_argument("Scenario " + std::to_string(index + 1) + " was generated for a " +
+                                        std::to_string(scenarios[index].mapWidth) + "x" +
+                                        std::to_string(scenarios[index].mapHeight) + " map");
+        }
+    }
+
+    ScenarioReport report;
+    std::vector<double> latencies;
+    latencies.reserve(scenarios.size());
+    for (const ScenarioEntry &entry : scenarios)
+    {
+        const PathLength pathLength = scenarioPathLength(entry);
+        auto start = std::chrono::steady_clock::now();
+        Path path = algorithm.findViablePath(matrixWorld, pathLength, maxStartingPoints);
+        auto stop = std::chrono::steady_clock::now();
+        latencies.push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+
+        if (!path.isEmpty())
+        {
+            (isViablePath(matrixWorld, path, pathLength) ? report.solved : report.invalid)++;
+        }
+    }
+
+    report.queries = scenarios.size();
+    if (latencies.empty())
+    {
+        return report;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    for (double latency : latencies)
+    {
+        report.totalSeconds += latency / 1e6;
+    }
+    report.queriesPerSecond = report.totalSeconds > 0.0 ? static_cast<double>(report.queries) / report.totalSeconds
+                                                        : 0.0;
+    auto percentile = [&](double fraction) {
+        auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(latencies.size())));
+        return latencies[std::clamp<size_t>(rank, 1, latencies.size()) - 1];
+    };
+    report.p50Micros = percentile(0.50);
+    report.p90Micros = percentile(0.90);
+    report.p99Micros = percentile(0.99);
+    report.maxMicros = latencies.back();
+    return report;
+}
+
+/**
+ * @brief Prints a scenario report
+ * @param report Report to print
+ */
+void printScenarioReport(const ScenarioReport &report)
+{
+    std::cout << "Scenarios: " << report.queries << " (" << report.solved << " solved, " << report.invalid
+              << " invalid)" << std::endl;
+    std::cout << "Total time: " << report.totalSeconds << " s" << std::endl;
+    std::cout << "Throughput: " << report.queriesPerSecond << " queries/s" << std::endl;
+    std::cout << "Latency p50/p90/p99/max: " << report.p50Micros << " / " << report.p90Micros << " / "
+              << report.p99Micros << " / " << report.maxMicros << " us" << std::endl;
+}
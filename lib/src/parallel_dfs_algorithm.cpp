@@ -0,0 +1,134 @@
+/**
+ * @file parallel_dfs_algorithm.cpp
+ * @brief Implementation of the multi-threaded DFS
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "parallel_dfs_algorithm.hpp"
+#include "candidate_ranking.hpp"
+#include "dfs_algorithm.hpp"
+#include "feasibility_oracle.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Constructs the engine
+ * @param threadCount Number of worker threads (0 = hardware concurrency)
+ * @param startWeights Weights ranking the starting points
+ */
+ParallelDFSAlgorithm::ParallelDFSAlgorithm(unsigned threadCount, const StartScoringWeights &startWeights)
+    : threadCount(threadCount != 0 ? threadCount : std::max(1U, std::thread::hardware_concurrency())),
+      startWeights(startWeights)
+{
+}
+
+/**
+ * @brief Finds a viable path by searching starting points in parallel
+ *
+ * 1. Validates input parameters and rejects provably infeasible requests
+ * 2. Starts the workers; each claims candidates from the shared cursor and
+ *    runs a single-start DFS on them until the cursor is exhausted or a path
+ *    has been found
+ * 3. The first worker to find a path stores it and raises the stop flag
+ * 4. The calling thread supervises and forwards cancellation of the engine
+ *
+ * @param matrixWorld Reference to the matrix world
+ * @param pathLength Target path length
+ * @param maxStartingPoints Unused
+ * @return Path object containing the found path (empty if none exists)
+ * @throws std::invalid_argument If pathLength is zero or exceeds matrix size
+ */
+Path ParallelDFSAlgorithm::findViablePath(const MatrixWorld &matrixWorld,
+                                          PathLength pathLength,
+                                          MaxStartingPoints maxStartingPoints)
+{
+    (void)maxStartingPoints;
+
+    if (pathLength.value == 0)
+    {
+        throw std::invalid_argument("Path length must be greater than zero");
+    }
+
+    if (pathLength.value > matrixWorld.getTotalCells())
+    {
+        throw std::invalid_argument("Path length exceeds matrix size");
+    }
+
+    if (!checkPathFeasibility(matrixWorld, pathLength).isFeasible)
+    {
+        return {};
+    }
+
+    // One start per symmetry orbit - the others would repeat equivalent searches
+    SharedCandidateCursor cursor(CandidateRanking::getShared(matrixWorld, startWeights, StartPruning::Symmetry));
+
+    // Shared search state - guarded by searchMutex except for the atomic flag
+    std::atomic<bool> stopSearch{false};
+    std::mutex searchMutex;
+    std::condition_variable searchDone;
+    unsigned finishedWorkers = 0;
+    Path result;
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount);
+    for (unsigned worker = 0; worker < threadCount; worker++)
+    {
+        workers.emplace_back([&] {
+            DFSAlgorithm dfs;
+            dfs.setCancellationFlag(&stopSearch);
+            while (!stopSearch.load(std::memory_order_relaxed) && !isCancelled())
+            {
+                auto start = cursor.claim();
+                if (!start)
+                {
+                    break;
+                }
+
+                Path path = dfs.findPathFrom(matrixWorld, *start, pathLength);
+                if (!path.isEmpty())
+                {
+                    std::lock_guard<std::mutex> lock(searchMutex);
+                    if (!stopSearch.load())
+                    {
+                        result = std::move(path);
+                        stopSearch.store(true);
+                    }
+                    break;
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(searchMutex);
+            finishedWorkers++;
+            searchDone.notify_all();
+        });
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(searchMutex);
+        while (!stopSearch.load() && finishedWorkers < threadCount)
+        {
+            searchDone.wait_for(lock, std::chrono::milliseconds(10));
+            if (isCancelled())
+            {
+                break;
+            }
+        }
+    }
+    // Cancel the workers still running
+    stopSearch.store(true);
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    return result;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file path_client.cpp
+ * @brief Implementation of the path service client
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "path_client.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/**
+ * @brief Connects to a service
+ * @param socketPath Filesystem path the service listens on
+ * @throws std::runtime_error If the connection fails
+ */
+PathClient::PathClient(const std::string &socketPath)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path))
+    {
+        throw std::runtime_error("Socket path too long: " + socketPath);
+    }
+    std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+    fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        throw std::runtime_error(std::string("Can not create socket: ") + std::strerror(errno));
+    }
+    if (::connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0)
+    {
+        const std::string reason = std::strerror(errno);
+        ::close(fd);
+        throw std::runtime_error("Can not connect to " + socketPath + ": " + reason);
+    }
+}
+
+/**
+ * @brief Closes the connection
+ */
+PathClient::~PathClient()
+{
+    ::close(fd);
+}
+
+/**
+ * @brief Sends a request without waiting for its response
+ * @param request Request to send; its id is assigned here
+ * @return Id of the request
+ * @throws std::runtime_error If the connection fails
+ */
+uint32_t PathClient::submit(ServiceRequest request)
+{
+    request.requestId = nextRequestId++;
+    writeFrame(fd, encodeRequest(request));
+    return request.requestId;
+}
+
+/**
+ * @brief Waits for the response of a request
+ *
+ * Responses of other requests read on the way are kept for their own
+ * receive() call.
+ *
+ * @param requestId Id returned by submit()
+ * @return Response of that request
+ * @throws std::runtime_error If the connection fails or closes first
+ */
+ServiceResponse PathClient::receive(uint32_t requestId)
+{
+    auto ready = received.find(requestId);
+    if (ready != received.end())
+    {
+        ServiceResponse response = std::move(ready->second);
+        received.erase(ready);
+        return response;
+    }
+
+    std::string payload;
+    while (readFrame(fd, payload))
+    {
+        ServiceResponse response = decodeResponse(payload);
+        if (response.requestId == requestId)
+        {
+            return response;
+        }
+        received.emplace(response.requestId, std::move(response));
+    }
+    throw std::runtime_error("Service closed the connection");
+}
+
+/**
+ * @brief Loads (or replaces) a resident world
+ * @param name World name
+ * @param reference World reference, see loadWorldReference()
+ * @return Ok with the world version, or Error
+ */
+ServiceResponse PathClient::loadWorld(const std::string &name, const std::string &reference)
+{
+    ServiceRequest request;
+    request.type = RequestType::LoadWorld;
+    request.world = name;
+    request.reference = reference;
+    return receive(submit(std::move(request)));
+}
+
+/**
+ * @brief Blocks or unblocks cells of a resident world
+ * @param name World name
+ * @param cells (row, col) cells
+ * @param blocked New state of the cells
+ * @return Ok with the new world version, or Error
+ */
+ServiceResponse PathClient::mutateCells(const std::string &name, std::vector<std::pair<uint16_t, uint16_t>> cells,
+                                        bool blocked)
+{
+    ServiceRequest request;
+    request.type = RequestType::MutateCells;
+    request.world = name;
+    request.cells = std::move(cells);
+    request.blocked = blocked;
+    return receive(submit(std::move(request)));
+}
+
+/**
+ * @brief Finds a path in a resident world
+ * @param name World name
+ * @param pathLength Requested path length
+ * @param algorithm Registry name of the engine
+ * @param maxStartingPoints Starting points limit
+ * @param deadlineMillis Time budget in milliseconds (0 = none)
+ * @return Query response
+ */
+ServiceResponse PathClient::queryPath(const std::string &name, PathLength pathLength, const std::string &algorithm,
+                                      MaxStartingPoints maxStartingPoints, uint32_t deadlineMillis)
+{
+    ServiceRequest request;
+    request.type = RequestType::QueryPath;
+    request.world = name;
+    request.pathLength = pathLength;
+    request.algorithm = algorithm;
+    request.maxStartingPoints = maxStartingPoints;
+    request.deadlineMillis = deadlineMillis;
+    return receive(submit(std::move(request)));
+}
+
+/**
+ * @brief Cancels a query sent with submit()
+ * @param requestId Id of the query
+ * @return Ok if the query was still in flight, Error otherwise
+ */
+ServiceResponse PathClient::cancel(uint32_t requestId)
+{
+    ServiceRequest request;
+    request.type = RequestType::Cancel;
+    request.targetId = requestId;
+    return receive(submit(std::move(request)));
+}
@@ -7,50 +7,81 @@
  */
 
 #include "path_finder_utils.hpp"
+#include <algorithm>
 #include <stdexcept>
 #include <vector>
 
 /**
- * @brief Default constructor initializes empty priority queue and exhaustion state
+ * @brief Default constructor initializes an empty cursor and exhaustion state
  * 
- * Initializes PathFinderUtils with empty priority queue and sets isExhausted to false.
- * Priority queue will be lazily populated on first call to findStartingPointCandidates().
+ * Initializes PathFinderUtils without a ranking and sets isExhausted to false.
+ * The ranking will be lazily obtained on first call to findStartingPointCandidates().
  * This approach avoids unnecessary computation if the object is created but never used.
  */
-// Priority queue is automatically initialized as empty by default constructor
+// Ranking pointer starts empty and cursor at zero by member initializers
 // isExhausted flag is initialized to false by member initializer
 PathFinderUtils::PathFinderUtils() = default;
 
+/**
+ * @brief Constructor selecting the scoring policy of the ranking
+ * @param weights Weights of the criteria ranking the candidates
+ * @param pruning Redundant candidates to skip
+ */
+PathFinderUtils::PathFinderUtils(const StartScoringWeights &weights, StartPruning pruning)
+    : weights(weights), pruning(pruning)
+{
+}
+
 /**
  * @brief Finds and returns prioritized starting point candidates for path finding
  * @param matrixWorld Reference to the matrix world to analyze
- * @param numberOfCandidates Number of candidates to return (1-255)
+ * @param numberOfCandidates Number of candidates to return (1-65535)
  * @return Vector of coordinate pairs representing best starting points
  * @throws std::invalid_argument If numberOfCandidates is zero or matrix is fully blocked
  * @throws std::length_error If numberOfCandidates exceeds total matrix cells
  * @throws std::runtime_error If all candidates have been exhausted from previous calls
  * 
- * Multi-call stateful algorithm that maintains internal priority queue:
- * 1. **Lazy Initialization**: Populates priority queue on first call only
+ * Copies the lazy batch of nextCandidates() into a vector, for callers that
+ * need to keep the candidates around.
+ */
+std::vector<std::pair<std::uint16_t, uint16_t>> PathFinderUtils::findStartingPointCandidates(
+    const MatrixWorld &matrixWorld,
+    uint16_t numberOfCandidates)
+{
+    CandidateRange batch = nextCandidates(matrixWorld, numberOfCandidates);
+    return std::vector<std::pair<std::uint16_t, uint16_t>>(batch.begin(), batch.end());
+}
+
+/**
+ * @brief Lazily returns the next batch of starting point candidates
+ * @param matrixWorld Reference to the matrix world to analyze
+ * @param numberOfCandidates Number of candidates to return (1-65535)
+ * @return Range over the next candidates, best first
+ * @throws std::invalid_argument If numberOfCandidates is zero or matrix is fully blocked
+ * @throws std::length_error If numberOfCandidates exceeds total matrix cells
+ * @throws std::runtime_error If all candidates have been exhausted from previous calls
+ * 
+ * Multi-call stateful algorithm that walks a shared CandidateRanking:
+ * 1. **Lazy Initialization**: Obtains the ranking on first call only
  * 2. **Scoring System**: Ranks cells by unblocked neighbor count (0-4 neighbors)
+ *    or by the configured weighted criteria
  * 3. **Batch Processing**: Returns requested number of highest-scored candidates
  * 4. **Exhaustion Tracking**: Marks when all candidates have been consumed
  * 
  * **Stateful Behavior:**
- * - First call: Scans entire matrix and builds priority queue
- * - Subsequent calls: Returns next batch from existing queue
+ * - First call: Fetches (or builds) the bucket-sorted ranking of the world
+ * - Subsequent calls: Returns next batch from the cursor position
  * - Final call: Returns remaining candidates and sets exhaustion flag
  * 
  * **Integration Pattern:**
  * Designed for multi-call usage with DFS algorithm - call repeatedly until
  * getIsExhausted() returns true to try all possible starting points.
  * 
- * **Performance:** O(N×M) for first call, O(k) for subsequent calls where k is numberOfCandidates
+ * **Performance:** O(N×M) for the first call on a new world version (counting
+ * sort, no heap), O(1) for subsequent calls - candidates are decoded while
+ * the range is iterated
  */
-// Default constructor - initializes an empty priority queue and sets isExhausted to false
-std::vector<std::pair<std::uint16_t, uint16_t>> PathFinderUtils::findStartingPointCandidates(
-    const MatrixWorld &matrixWorld,
-    uint8_t numberOfCandidates)
+CandidateRange PathFinderUtils::nextCandidates(const MatrixWorld &matrixWorld, uint16_t numberOfCandidates)
 {
     // Input validation - ensure numberOfCandidates is valid
     if (numberOfCandidates == 0)
@@ -70,64 +101,27 @@ std::vector<std::pair<std::uint16_t, uint16_t>> PathFinderUtils::findStartingPoi
         throw std::length_error("Number of candidates exceeds total number of cells in the matrix.");
     }
 
-    // Check exhaustion state - prevent operations on exhausted queue
+    // Check exhaustion state - prevent operations on exhausted ranking
     if (isExhausted)
     {
         throw std::runtime_error("All candidates have been exhausted.");
     }
 
-    // Lazy initialization: populate priority queue on first call
-    // This approach avoids unnecessary computation if the object is created but never used
-    if (priorityQueue.empty())
+    // Lazy initialization: the ranking is shared by all queries on this world version
+    if (!ranking)
     {
-        // Iterate through all matrix positions to find and score unblocked cells
-        for (uint16_t colIndex = 0; colIndex < matrixWorld.getRowSize(); colIndex++)
-        {
-            for (uint16_t rowIndex = 0; rowIndex < matrixWorld.getColSize(); rowIndex++)
-            {
-                // Only consider unblocked (passable) cells as potential starting points
-                if (matrixWorld.isUnblocked(rowIndex, colIndex))
-                {
-                    // Score each cell by counting unblocked neighbors (0-4)
-                    // Higher scores indicate better connectivity for path finding
-                    uint32_t score = matrixWorld.countUnblockedNeighbors(rowIndex, colIndex);
-                    priorityQueue.emplace(score, std::make_pair(rowIndex, colIndex));
-                }
-            }
-        }
+        ranking = CandidateRanking::getShared(matrixWorld, weights, pruning);
     }
 
-    std::vector<std::pair<std::uint16_t, uint16_t>> candidates;
+    // Return the requested batch, or everything left if fewer candidates remain
+    size_t first = cursor;
+    cursor += std::min<size_t>(numberOfCandidates, ranking->size() - cursor);
 
-    // Branch based on availability: full request vs. partial fulfillment
-    if (priorityQueue.size() > numberOfCandidates)
+    // Mark as exhausted once all candidates have been consumed
+    if (cursor == ranking->size())
     {
-        // Standard case: extract exactly the requested number of candidates
-        for (uint8_t i = 0; i < numberOfCandidates && !priorityQueue.empty(); ++i)
-        {
-            candidates.push_back(priorityQueue.top().second);
-            priorityQueue.pop();
-        }
-
-        // Check if queue became empty after extraction (edge case)
-        if (priorityQueue.empty())
-        {
-            isExhausted = true;
-        }
-    }
-    else
-    {
-        // Exhaustion case: return all remaining candidates
-        // This handles scenarios where fewer candidates exist than requested
-        while (!priorityQueue.empty())
-        {
-            candidates.push_back(priorityQueue.top().second);
-            priorityQueue.pop();
-        }
-
-        // Mark as exhausted since all candidates have been consumed
         isExhausted = true;
     }
 
-    return candidates;
-}
\ No newline at end of file
+    return {ranking, first, cursor};
+}
@@ -0,0 +1,303 @@
+/**
+ * @file path_repair.cpp
+ * @brief Implementation of local path repair
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "path_repair.hpp"
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+ * @struct RepairContext
+ * @brief Shared state of one repair run
+ *
+ * Cells are packed as linear indices (row * cols + col). Only cells of the
+ * path and of the bounded searches are ever stored.
+ */
+struct RepairContext
+{
+    const MatrixWorld &matrixWorld;     ///< World after the mutations
+    uint16_t rows;                      ///< Number of matrix rows
+    uint16_t cols;                      ///< Number of matrix columns
+    std::unordered_set<uint32_t> used;  ///< Cells currently part of the kept path
+    uint32_t expansionBudget;           ///< Remaining cell expansions
+    uint32_t expansions = 0;            ///< Cells expanded so far
+};
+
+/// 4-directional offsets: up, right, down, left
+static const std::array<std::array<int, 2>, 4> directions = {{{-1, 0}, {0, 1}, {1, 0}, {0, -1}}};
+
+/**
+ * @brief Checks that a cell lies inside the matrix and is unblocked
+ * @param context Repair state
+ * @param row Signed row coordinate
+ * @param col Signed column coordinate
+ * @return true if the cell can be part of a path
+ */
+static bool isFreeCell(const RepairContext &context, int row, int col)
+{
+    return row >= 0 && row < static_cast<int>(context.rows) && col >= 0 && col < static_cast<int>(context.cols) &&
+           context.matrixWorld.isUnblocked(static_cast<uint16_t>(row), static_cast<uint16_t>(col));
+}
+
+/**
+ * @brief Finds a short detour connecting two path cells around a gap
+ * @param context Repair state (used cells are avoided, budget is consumed)
+ * @param from Last cell of the segment before the gap
+ * @param to First cell of the segment after the gap
+ * @param radius Margin around the two cells the search may use
+ * @param bridge Output: intermediate cells from 'from' to 'to' (both excluded)
+ * @return true if a connection was found within the budget
+ *
+ * Breadth-first search restricted to the bounding box of the two cells grown
+ * by 'radius', so the bridge is the shortest local detour.
+ */
+static bool findBridge(RepairContext &context, uint32_t from, uint32_t to, uint16_t radius, std::vector<uint32_t> &bridge)
+{
+    int fromRow = static_cast<int>(from / context.cols);
+    int fromCol = static_cast<int>(from % context.cols);
+    int toRow = static_cast<int>(to / context.cols);
+    int toCol = static_cast<int>(to % context.cols);
+    int minRow = std::min(fromRow, toRow) - radius;
+    int maxRow = std::max(fromRow, toRow) + radius;
+    int minCol = std::min(fromCol, toCol) - radius;
+    int maxCol = std::max(fromCol, toCol) + radius;
+
+    std::unordered_map<uint32_t, uint32_t> parent;
+    std::queue<uint32_t> frontier;
+    parent.emplace(from, from);
+    frontier.push(from);
+
+    while (!frontier.empty() && context.expansions < context.expansionBudget)
+    {
+        uint32_t current = frontier.front();
+        frontier.pop();
+        context.expansions++;
+
+        int row = static_cast<int>(current / context.cols);
+        int col = static_cast<int>(current % context.cols);
+        for (const auto &direction : directions)
+        {
+            int newRow = row + direction[0];
+            int newCol = col + direction[1];
+            if (newRow < minRow || newRow > maxRow || newCol < minCol || newCol > maxCol ||
+                !isFreeCell(context, newRow, newCol))
+            {
+                continue;
+            }
+
+            uint32_t neighbour = (static_cast<uint32_t>(newRow) * context.cols) + static_cast<uint32_t>(newCol);
+            if (neighbour == to)
+            {
+                // Walk the parent chain back to 'from'
+                bridge.clear();
+                for (uint32_t cell = current; cell != from; cell = parent[cell])
+                {
+                    bridge.push_back(cell);
+                }
+                std::reverse(bridge.begin(), bridge.end());
+                return true;
+            }
+
+            if (parent.count(neighbour) == 0 && context.used.count(neighbour) == 0)
+            {
+                parent.emplace(neighbour, current);
+                frontier.push(neighbour);
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Extends the path at its tail with a bounded depth-first search
+ * @param context Repair state (used cells are updated, budget is consumed)
+ * @param path Path to extend in place
+ * @param targetLength Required path length
+ *
+ * Backtracks like DFSAlgorithm but with an explicit stack and an expansion
+ * budget. When the budget runs out the deepest consistent state is kept.
+ */
+static void extendTail(RepairContext &context, std::deque<uint32_t> &path, size_t targetLength)
+{
+    // Direction index to try next for every cell appended by this search
+    std::vector<uint8_t> nextDirection;
+    const size_t baseLength = path.size();
+    nextDirection.push_back(0);
+
+    while (path.size() < targetLength && context.expansions < context.expansionBudget)
+    {
+        uint8_t &direction = nextDirection.back();
+        if (direction == directions.size())
+        {
+            // Dead end - backtrack unless we are back at the original tail
+            if (path.size() == baseLength)
+            {
+                return;
+            }
+            context.used.erase(path.back());
+            path.pop_back();
+            nextDirection.pop_back();
+            continue;
+        }
+
+        uint32_t tail = path.back();
+        int newRow = static_cast<int>(tail / context.cols) + directions[direction][0];
+        int newCol = static_cast<int>(tail % context.cols) + directions[direction][1];
+        direction++;
+        if (!isFreeCell(context, newRow, newCol))
+        {
+            continue;
+        }
+
+        uint32_t neighbour = (static_cast<uint32_t>(newRow) * context.cols) + static_cast<uint32_t>(newCol);
+        if (context.used.insert(neighbour).second)
+        {
+            context.expansions++;
+            path.push_back(neighbour);
+            nextDirection.push_back(0);
+        }
+    }
+}
+
+/**
+ * @brief Repairs a previous path after the given cells changed state
+ *
+ * 1. Cuts the previous path at every changed cell that is no longer free,
+ *    leaving a list of still valid segments
+ * 2. Joins consecutive segments with a bounded local bridge search; when a
+ *    gap cannot be bridged the shorter side is dropped
+ * 3. Extends the joined path at the tail, then at the head, until it reaches
+ *    the required length, or trims surplus cells from the tail
+ *
+ * Unblocked changed cells never invalidate the path and only become
+ * available to the bridge and extension searches.
+ *
+ * @param matrixWorld World after the mutations
+ * @param previousPath Path that was valid before the mutations
+ * @param changedCells Cells whose state changed
+ * @param pathLength Required path length
+ * @param limits Search budget
+ * @return Repaired path, or an empty path if the repair failed within the budget
+ * @throws std::invalid_argument If pathLength is zero or exceeds matrix size
+ */
+Path PathRepair::repairPath(const MatrixWorld &matrixWorld,
+                            const Path &previousPath,
+                            const std::vector<std::pair<uint16_t, uint16_t>> &changedCells,
+                            PathLength pathLength,
+                            RepairLimits limits)
+{
+    if (pathLength.value == 0)
+    {
+        throw std::invalid_argument("Path length must be greater than zero");
+    }
+
+    if (pathLength.value > matrixWorld.getTotalCells())
+    {
+        throw std::invalid_argument("Path length exceeds matrix size");
+    }
+
+    RepairContext context{matrixWorld, matrixWorld.getColSize(), matrixWorld.getRowSize(), {}, limits.maxExpansions};
+    lastExpansions = 0;
+
+    // Cells that were blocked by the mutations. Out of bounds cells are
+    // skipped: their index would alias an in-bounds cell, and the path loop
+    // below drops out of bounds path cells by their coordinates
+    std::unordered_set<uint32_t> invalidCells;
+    for (const auto &[row, col] : changedCells)
+    {
+        if (row < context.rows && col < context.cols && !matrixWorld.isUnblocked(row, col))
+        {
+            invalidCells.insert((static_cast<uint32_t>(row) * context.cols) + col);
+        }
+    }
+
+    // 1. Cut the previous path into still valid segments
+    std::vector<std::deque<uint32_t>> segments(1);
+    for (const auto &[row, col] : previousPath)
+    {
+        uint32_t cell = (static_cast<uint32_t>(row) * context.cols) + col;
+        if (row >= context.rows || col >= context.cols || invalidCells.count(cell) != 0)
+        {
+            if (!segments.back().empty())
+            {
+                segments.emplace_back();
+            }
+            continue;
+        }
+        segments.back().push_back(cell);
+        context.used.insert(cell);
+    }
+    if (segments.back().empty())
+    {
+        segments.pop_back();
+    }
+    if (segments.empty())
+    {
+        return {};
+    }
+
+    // 2. Reconnect consecutive segments locally
+    std::deque<uint32_t> repaired = std::move(segments.front());
+    std::vector<uint32_t> bridge;
+    for (size_t index = 1; index < segments.size(); index++)
+    {
+        std::deque<uint32_t> &next = segments[index];
+        if (findBridge(context, repaired.back(), next.front(), limits.searchRadius, bridge))
+        {
+            for (uint32_t cell : bridge)
+            {
+                context.used.insert(cell);
+                repaired.push_back(cell);
+            }
+            repaired.insert(repaired.end(), next.begin(), next.end());
+            continue;
+        }
+
+        // Gap cannot be bridged - keep the longer side
+        std::deque<uint32_t> &dropped = next.size() <= repaired.size() ? next : repaired;
+        for (uint32_t cell : dropped)
+        {
+            context.used.erase(cell);
+        }
+        if (&dropped == &repaired)
+        {
+            repaired = std::move(next);
+        }
+    }
+
+    // 3. Re-extend (tail first, then head) or trim to the required length
+    const size_t targetLength = pathLength.value;
+    if (repaired.size() < targetLength)
+    {
+        extendTail(context, repaired, targetLength);
+    }
+    if (repaired.size() < targetLength)
+    {
+        std::reverse(repaired.begin(), repaired.end());
+        extendTail(context, repaired, targetLength);
+        std::reverse(repaired.begin(), repaired.end());
+    }
+    lastExpansions = context.expansions;
+
+    if (repaired.size() < targetLength)
+    {
+        return {};
+    }
+    repaired.resize(targetLength);
+
+    Path result;
+    for (uint32_t cell : repaired)
+    {
+        result.addCoordinate(static_cast<uint16_t>(cell / context.cols), static_cast<uint16_t>(cell % context.cols));
+    }
+    return result;
+}
@@ -0,0 +1,1002 @@
+/**
+ * @file path_service.cpp
+ * @brief Implementation of the path service and its wire protocol
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "path_service.hpp"
+#include "algorithm_registry.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+/// Bytes of the frame length prefix
+constexpr size_t LENGTH_BYTES = sizeof(uint32_t);
+
+/// Pending connections queued by listen()
+constexpr int LISTEN_BACKLOG = 64;
+
+/// Pause after accept() fails for lack of descriptors or memory
+constexpr std::chrono::milliseconds ACCEPT_BACKOFF{50};
+
+/**
+ * @class PayloadWriter
+ * @brief Appends little-endian fields to a frame, length prefix reserved up front
+ */
+class PayloadWriter
+{
+    std::string frame = std::string(LENGTH_BYTES, '\0');
+
+public:
+    template <typename Unsigned> void put(Unsigned value)
+    {
+        for (size_t byte = 0; byte < sizeof(Unsigned); byte++)
+        {
+            frame += static_cast<char>((value >> (8 * byte)) & 0xFF);
+        }
+    }
+
+    void putString(const std::string &text)
+    {
+        if (text.size() > UINT16_MAX)
+        {
+            throw std::invalid_argument("String field longer than 65535 bytes");
+        }
+        put(static_cast<uint16_t>(text.size()));
+        frame += text;
+    }
+
+    /**
+     * @brief Fills in the length prefix and hands out the frame
+     */
+    [[nodiscard]] std::string finish()
+    {
+        const auto length = static_cast<uint32_t>(frame.size() - LENGTH_BYTES);
+        for (size_t byte = 0; byte < LENGTH_BYTES; byte++)
+        {
+            frame[byte] = static_cast<char>((length >> (8 * byte)) & 0xFF);
+        }
+        return std::move(frame);
+    }
+};
+
+/**
+ * @class PayloadReader
+ * @brief Reads little-endian fields from a payload, rejecting truncation
+ */
+class PayloadReader
+{
+    std::string_view payload;
+    size_t offset = 0;
+
+    void require(size_t bytes) const
+    {
+        if (payload.size() - offset < bytes)
+        {
+            throw std::invalid_argument("Truncated payload");
+        }
+    }
+
+public:
+    explicit PayloadReader(std::string_view payload) : payload(payload) {}
+
+    template <typename Unsigned> [[nodiscard]] Unsigned get()
+    {
+        require(sizeof(Unsigned));
+        Unsigned value = 0;
+        for (size_t byte = 0; byte < sizeof(Unsigned); byte++)
+        {
+            value |= static_cast<Unsigned>(static_cast<uint8_t>(payload[offset + byte])) << (8 * byte);
+        }
+        offset += sizeof(Unsigned);
+        return value;
+    }
+
+    [[nodiscard]] std::string getString()
+    {
+        const auto length = get<uint16_t>();
+        require(length);
+        std::string text(payload.substr(offset, length));
+        offset += length;
+        return text;
+    }
+
+    void finish() const
+    {
+        if (offset != payload.size())
+        {
+            throw std::invalid_argument("Trailing bytes after payload");
+        }
+    }
+};
+
+/**
+ * @brief Reads exactly size bytes
+ * @return Bytes read; less than size only at end of stream
+ */
+size_t readFully(int fd, char *data, size_t size)
+{
+    size_t done = 0;
+    while (done < size)
+    {
+        const ssize_t received = ::recv(fd, data + done, size - done, 0);
+        if (received < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (received < 0)
+        {
+            throw std::runtime_error(std::string("Can not read socket: ") + std::strerror(errno));
+        }
+        if (received == 0)
+        {
+            break;
+        }
+        done += static_cast<size_t>(received);
+    }
+    return done;
+}
+} // namespace
+
+/**
+ * @struct PathService::Connection
+ * @brief Accepted client; the socket is closed once nothing refers to it
+ */
+struct PathService::Connection
+{
+    int fd;                          ///< Connected socket
+    std::mutex writeMutex;           ///< Serialises responses of the reader and the workers
+    std::thread reader;              ///< Decodes the requests of this connection
+    std::atomic<bool> finished{false}; ///< Set when the reader is about to return
+
+    explicit Connection(int fd) : fd(fd) {}
+    Connection(const Connection &) = delete;
+    Connection &operator=(const Connection &) = delete;
+    ~Connection()
+    {
+        ::close(fd);
+    }
+};
+
+/**
+ * @struct PathService::ActiveQuery
+ * @brief Cancellation state of a queued or running query
+ */
+struct PathService::ActiveQuery
+{
+    std::atomic<bool> cancelled{false}; ///< Attached to the engine as its cancellation flag
+    std::atomic<uint8_t> reason{0};     ///< ResponseStatus of the first cancellation (0 = none)
+    std::optional<DeadlineQueue::iterator> deadline; ///< Entry in PathService::deadlines, guarded by stateMutex
+
+    /**
+     * @brief Raises the flag; the first reason wins
+     */
+    void raise(ResponseStatus status)
+    {
+        uint8_t none = 0;
+        reason.compare_exchange_strong(none, static_cast<uint8_t>(status));
+        cancelled.store(true);
+    }
+};
+
+/**
+ * @struct PathService::Task
+ * @brief Request queued for the workers
+ */
+struct PathService::Task
+{
+    std::shared_ptr<Connection> connection; ///< Connection to answer on
+    ServiceRequest request;                 ///< Decoded request
+    std::shared_ptr<ActiveQuery> query;     ///< Cancellation state (QueryPath only)
+};
+
+/**
+ * @brief Encodes a request as a complete frame
+ * @param request Request to encode
+ * @return Length prefix and payload
+ * @throws std::invalid_argument If a string or the cell list does not fit its length field
+ */
+std::string encodeRequest(const ServiceRequest &request)
+{
+    PayloadWriter writer;
+    writer.put(static_cast<uint8_t>(request.type));
+    writer.put(request.requestId);
+    switch (request.type)
+    {
+    case RequestType::LoadWorld:
+        writer.putString(request.world);
+        writer.putString(request.reference);
+        break;
+    case RequestType::MutateCells:
+        writer.putString(request.world);
+        writer.put(static_cast<uint8_t>(request.blocked ? 1 : 0));
+        writer.put(static_cast<uint32_t>(request.cells.size()));
+        for (const auto &[row, col] : request.cells)
+        {
+            writer.put(row);
+            writer.put(col);
+        }
+        break;
+    case RequestType::QueryPath:
+        writer.putString(request.world);
+        writer.put(request.pathLength.value);
+        writer.putString(request.algorithm);
+        writer.put(request.maxStartingPoints.value);
+        writer.put(request.deadlineMillis);
+        break;
+    case RequestType::Cancel:
+        writer.put(request.targetId);
+        break;
+    }
+    return writer.finish();
+}
+
+/**
+ * @brief Decodes a request payload
+ * @param payload Frame payload (without the length prefix)
+ * @return Decoded request
+ * @throws std::invalid_argument If the payload is truncated, has trailing bytes or an unknown type
+ */
+ServiceRequest decodeRequest(std::string_view payload)
+{
+    PayloadReader reader(payload);
+    ServiceRequest request;
+    const auto type = reader.get<uint8_t>();
+    request.requestId = reader.get<uint32_t>();
+    switch (type)
+    {
+    case static_cast<uint8_t>(RequestType::LoadWorld):
+        request.type = RequestType::LoadWorld;
+        request.world = reader.getString();
+        request.reference = reader.getString();
+        break;
+    case static_cast<uint8_t>(RequestType::MutateCells): {
+        request.type = RequestType::MutateCells;
+        request.world = reader.getString();
+        request.blocked = reader.get<uint8_t>() != 0;
+        const auto count = reader.get<uint32_t>();
+        if (count > (payload.size() / (2 * sizeof(uint16_t))))
+        {
+            throw std::invalid_argument("Truncated payload");
+        }
+        request.cells.reserve(count);
+        for (uint32_t cell = 0; cell < count; cell++)
+        {
+            const auto row = reader.get<uint16_t>();
+            request.cells.emplace_back(row, reader.get<uint16_t>());
+        }
+        break;
+    }
+    case static_cast<uint8_t>(RequestType::QueryPath):
+        request.type = RequestType::QueryPath;
+        request.world = reader.getString();
+        request.pathLength.value = reader.get<uint16_t>();
+        request.algorithm = reader.getString();
+        request.maxStartingPoints.value = reader.get<uint16_t>();
+        request.deadlineMillis = reader.get<uint32_t>();
+        break;
+    case static_cast<uint8_t>(RequestType::Cancel):
+        request.type = RequestType::Cancel;
+        request.targetId = reader.get<uint32_t>();
+        break;
+    default:
+        throw std::invalid_argument("Unknown request type " + std::to_string(type));
+    }
+    reader.finish();
+    return request;
+}
+
+/**
+ * @brief Encodes a response as a complete frame
+ * @param response Response to encode
+ * @return Length prefix and payload
+ */
+std::string encodeResponse(const ServiceResponse &response)
+{
+    PayloadWriter writer;
+    writer.put(response.requestId);
+    writer.put(static_cast<uint8_t>(response.status));
+    writer.put(response.micros);
+    writer.put(response.worldVersion);
+    writer.putString(response.message.substr(0, UINT16_MAX));
+    writer.put(static_cast<uint32_t>(response.path.getLength()));
+    for (const auto &[row, col] : response.path)
+    {
+        writer.put(row);
+        writer.put(col);
+    }
+    return writer.finish();
+}
+
+/**
+ * @brief Decodes a response payload
+ * @param payload Frame payload (without the length prefix)
+ * @return Decoded response
+ * @throws std::invalid_argument If the payload is truncated, has trailing bytes or an unknown status
+ */
+ServiceResponse decodeResponse(std::string_view payload)
+{
+    PayloadReader reader(payload);
+    ServiceResponse response;
+    response.requestId = reader.get<uint32_t>();
+    const auto status = reader.get<uint8_t>();
+    if (status > static_cast<uint8_t>(ResponseStatus::Error))
+    {
+        throw std::invalid_argument("Unknown response status " + std::to_string(status));
+    }
+    response.status = static_cast<ResponseStatus>(status);
+    response.micros = reader.get<uint32_t>();
+    response.worldVersion = reader.get<uint64_t>();
+    response.message = reader.getString();
+    const auto count = reader.get<uint32_t>();
+    for (uint32_t cell = 0; cell < count; cell++)
+    {
+        const auto row = reader.get<uint16_t>();
+        response.path.addCoordinate(row, reader.get<uint16_t>());
+    }
+    reader.finish();
+    return response;
+}
+
+/**
+ * @brief Reads one frame
+ * @param fd Connected socket
+ * @param payload Receives the payload
+ * @return false on end of stream before the first byte of a frame
+ * @throws std::runtime_error If reading fails or the stream ends inside a frame
+ * @throws std::invalid_argument If the length exceeds MAX_FRAME_BYTES
+ */
+bool readFrame(int fd, std::string &payload)
+{
+    char prefix[LENGTH_BYTES];
+    const size_t prefixBytes = readFully(fd, prefix, LENGTH_BYTES);
+    if (prefixBytes == 0)
+    {
+        return false;
+    }
+    if (prefixBytes != LENGTH_BYTES)
+    {
+        throw std::runtime_error("Connection closed inside a frame");
+    }
+
+    uint32_t length = 0;
+    for (size_t byte = 0; byte < LENGTH_BYTES; byte++)
+    {
+        length |= static_cast<uint32_t>(static_cast<uint8_t>(prefix[byte])) << (8 * byte);
+    }
+    if (length > MAX_FRAME_BYTES)
+    {
+        throw std::invalid_argument("Frame of " + std::to_string(length) + " bytes exceeds the limit");
+    }
+    payload.resize(length);
+    if (readFully(fd, payload.data(), length) != length)
+    {
+        throw std::runtime_error("Connection closed inside a frame");
+    }
+    return true;
+}
+
+/**
+ * @brief Writes one complete frame
+ * @param fd Connected socket
+ * @param frame Encoded frame
+ * @throws std::runtime_error If writing fails (including a closed peer, no SIGPIPE is raised)
+ */
+void writeFrame(int fd, std::string_view frame)
+{
+    size_t done = 0;
+    while (done < frame.size())
+    {
+        const ssize_t sent = ::send(fd, frame.data() + done, frame.size() - done, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (sent < 0)
+        {
+            throw std::runtime_error(std::string("Can not write socket: ") + std::strerror(errno));
+        }
+        done += static_cast<size_t>(sent);
+    }
+}
+
+/**
+ * @brief Gets the wire name of a response status
+ * @param status Response status
+ * @return Lower case name ("found", "timed_out", ...)
+ */
+const char *responseStatusName(ResponseStatus status)
+{
+    static constexpr const char *STATUS_NAMES[] = {"ok",        "found",     "not_found", "infeasible",
+                                                   "cancelled", "timed_out", "error"};
+    return STATUS_NAMES[static_cast<size_t>(status)];
+}
+
+/**
+ * @brief Creates a stopped service
+ * @param socketPath Filesystem path to listen on (replaced if it exists)
+ * @param threadCount Worker threads (0 = hardware concurrency)
+ */
+PathService::PathService(std::string socketPath, unsigned threadCount)
+    : socketPath(std::move(socketPath)),
+      threadCount(threadCount != 0 ? threadCount : std::max(1U, std::thread::hardware_concurrency()))
+{
+}
+
+/**
+ * @brief Stops the service if running
+ */
+PathService::~PathService()
+{
+    stop();
+}
+
+/**
+ * @brief Binds the socket and starts the accept, deadline and worker threads
+ * @throws std::runtime_error If the socket cannot be created, bound or listened on
+ */
+void PathService::start()
+{
+    if (running)
+    {
+        return;
+    }
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path))
+    {
+        throw std::runtime_error("Socket path too long: " + socketPath);
+    }
+    std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+    listenFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listenFd < 0)
+    {
+        throw std::runtime_error(std::string("Can not create socket: ") + std::strerror(errno));
+    }
+    ::unlink(socketPath.c_str());
+    if (::bind(listenFd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0 ||
+        ::listen(listenFd, LISTEN_BACKLOG) != 0)
+    {
+        const std::string reason = std::strerror(errno);
+        ::close(listenFd);
+        listenFd = -1;
+        throw std::runtime_error("Can not listen on " + socketPath + ": " + reason);
+    }
+
+    stopping = false;
+    running = true;
+    acceptThread = std::thread(&PathService::acceptLoop, this);
+    deadlineThread = std::thread(&PathService::deadlineLoop, this);
+    for (unsigned worker = 0; worker < threadCount; worker++)
+    {
+        workers.emplace_back(&PathService::workLoop, this);
+    }
+}
+
+/**
+ * @brief Closes the socket and every connection, cancels the queries and joins all threads
+ *
+ * 1. Wakes the accept thread by shutting the listening socket down
+ * 2. Shuts every connection down, which ends its reader
+ * 3. Cancels all queries so running engines return promptly
+ * 4. Joins every thread and removes the socket file
+ */
+void PathService::stop()
+{
+    if (!running)
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+        for (auto &[key, query] : activeQueries)
+        {
+            query->raise(ResponseStatus::Cancelled);
+        }
+    }
+    taskReady.notify_all();
+    deadlineChanged.notify_all();
+
+    ::shutdown(listenFd, SHUT_RDWR);
+    acceptThread.join();
+    // The accept thread is gone, so the connection list no longer grows
+    for (auto &connection : connections)
+    {
+        ::shutdown(connection->fd, SHUT_RDWR);
+    }
+    for (auto &connection : connections)
+    {
+        connection->reader.join();
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    deadlineThread.join();
+
+    workers.clear();
+    connections.clear();
+    tasks.clear();
+    activeQueries.clear();
+    deadlines.clear();
+    ::close(listenFd);
+    listenFd = -1;
+    ::unlink(socketPath.c_str());
+    running = false;
+}
+
+/**
+ * @brief Gets the number of resident worlds
+ * @return Loaded worlds
+ */
+size_t PathService::getWorldCount()
+{
+    std::lock_guard<std::mutex> lock(stateMutex);
+    return worlds.size();
+}
+
+/**
+ * @brief Gets the number of deadlines of queued and running queries
+ * @return Pending deadlines
+ */
+size_t PathService::getPendingDeadlineCount()
+{
+    std::lock_guard<std::mutex> lock(stateMutex);
+    return deadlines.size();
+}
+
+/**
+ * @brief Accepts connections and starts their readers, reaping finished ones
+ */
+void PathService::acceptLoop()
+{
+    while (true)
+    {
+        const int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_CLOEXEC);
+        const int acceptError = fd < 0 ? errno : 0;
+        std::unique_lock<std::mutex> lock(stateMutex);
+        if (stopping)
+        {
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+            return;
+        }
+        if (fd < 0)
+        {
+            // An aborted handshake is retried at once. Other errors (out of
+            // descriptors or memory) persist until connections close, so
+            // back off without holding the state lock instead of spinning
+            if (acceptError != ECONNABORTED && acceptError != EINTR)
+            {
+                lock.unlock();
+                std::this_thread::sleep_for(ACCEPT_BACKOFF);
+            }
+            continue;
+        }
+
+        auto finished = std::partition(connections.begin(), connections.end(),
+                                       [](const auto &connection) { return !connection->finished.load(); });
+        for (auto connection = finished; connection != connections.end(); ++connection)
+        {
+            (*connection)->reader.join();
+        }
+        connections.erase(finished, connections.end());
+
+        auto connection = std::make_shared<Connection>(fd);
+        connection->reader = std::thread(&PathService::readLoop, this, connection);
+        connections.push_back(std::move(connection));
+    }
+}
+
+/**
+ * @brief Decodes the requests of one connection until it closes
+ *
+ * Cancel requests are answered here so they never wait behind queued work.
+ * On exit every query of the connection is cancelled.
+ *
+ * @param connection Connection to read
+ */
+void PathService::readLoop(const std::shared_ptr<Connection> &connection)
+{
+    std::string payload;
+    while (true)
+    {
+        try
+        {
+            if (!readFrame(connection->fd, payload))
+            {
+                break;
+            }
+        }
+        catch (const std::exception &)
+        {
+            break; // Framing is lost, drop the connection
+        }
+
+        ServiceRequest request;
+        try
+        {
+            request = decodeRequest(payload);
+        }
+        catch (const std::invalid_argument &e)
+        {
+            ServiceResponse response;
+            response.message = e.what();
+            respond(*connection, response);
+            continue;
+        }
+
+        if (request.type == RequestType::Cancel)
+        {
+            respond(*connection, cancel(*connection, request));
+            continue;
+        }
+
+        Task task{connection, std::move(request), nullptr};
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            if (task.request.type == RequestType::QueryPath)
+            {
+                task.query = std::make_shared<ActiveQuery>();
+                if (!activeQueries.emplace(std::make_pair(connection.get(), task.request.requestId), task.query)
+                         .second)
+                {
+                    task.query = nullptr;
+                    task.request.type = RequestType::Cancel; // Answered below
+                }
+                else if (task.request.deadlineMillis != 0)
+                {
+                    auto deadline =
+                        std::chrono::steady_clock::now() + std::chrono::milliseconds(task.request.deadlineMillis);
+                    if (deadlines.empty() || deadline < deadlines.begin()->first)
+                    {
+                        deadlineChanged.notify_one();
+                    }
+                    task.query->deadline = deadlines.emplace(deadline, task.query);
+                }
+            }
+            if (task.request.type != RequestType::Cancel)
+            {
+                tasks.push_back(std::move(task));
+                taskReady.notify_one();
+                continue;
+            }
+        }
+        ServiceResponse response;
+        response.requestId = task.request.requestId;
+        response.message = "Request id " + std::to_string(task.request.requestId) + " is already in flight";
+        respond(*connection, response);
+    }
+
+    ::shutdown(connection->fd, SHUT_RDWR);
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        for (auto &[key, query] : activeQueries)
+        {
+            if (key.first == connection.get())
+            {
+                query->raise(ResponseStatus::Cancelled);
+            }
+        }
+    }
+    connection->finished.store(true);
+}
+
+/**
+ * @brief Raises the cancellation flags of queries whose deadline passed
+ */
+void PathService::deadlineLoop()
+{
+    std::unique_lock<std::mutex> lock(stateMutex);
+    while (!stopping)
+    {
+        if (deadlines.empty())
+        {
+            deadlineChanged.wait(lock);
+            continue;
+        }
+        auto first = deadlines.begin();
+        if (first->first > std::chrono::steady_clock::now())
+        {
+            deadlineChanged.wait_until(lock, first->first);
+            continue;
+        }
+        if (auto query = first->second.lock())
+        {
+            query->raise(ResponseStatus::TimedOut);
+            query->deadline.reset();
+        }
+        deadlines.erase(first);
+    }
+}
+
+/**
+ * @brief Runs queued requests until the service stops
+ *
+ * Each worker keeps one engine instance per algorithm name.
+ */
+void PathService::workLoop()
+{
+    std::map<std::string, std::unique_ptr<PathAlgorithm>> engines;
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            taskReady.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            if (stopping)
+            {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+
+        ServiceResponse response;
+        try
+        {
+            switch (task.request.type)
+            {
+            case RequestType::LoadWorld:
+                response = loadWorld(task.request);
+                break;
+            case RequestType::MutateCells:
+                response = mutateCells(task.request);
+                break;
+            case RequestType::QueryPath:
+                response = queryPath(task.request, *task.query, engines);
+                break;
+            case RequestType::Cancel:
+                break;
+            }
+        }
+        catch (const std::exception &e)
+        {
+            response.status = ResponseStatus::Error;
+            response.message = e.what();
+        }
+        response.requestId = task.request.requestId;
+
+        if (task.query)
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            activeQueries.erase(std::make_pair(task.connection.get(), task.request.requestId));
+            // Finished queries drop their deadline, so the queue only holds pending ones
+            if (task.query->deadline)
+            {
+                deadlines.erase(*task.query->deadline);
+                task.query->deadline.reset();
+            }
+        }
+        respond(*task.connection, response);
+    }
+}
+
+/**
+ * @brief Sends a response, ignoring peers that went away
+ * @param connection Connection to answer on
+ * @param response Response to send
+ */
+void PathService::respond(Connection &connection, const ServiceResponse &response)
+{
+    const std::string frame = encodeResponse(response);
+    std::lock_guard<std::mutex> lock(connection.writeMutex);
+    try
+    {
+        writeFrame(connection.fd, frame);
+    }
+    catch (const std::runtime_error &)
+    {
+        // The reader notices the closed connection and cancels its queries
+    }
+}
+
+/**
+ * @brief Cancels a queued or running query of the same connection
+ * @param connection Connection the Cancel request arrived on
+ * @param request Cancel request
+ * @return Ok if the query was found, Error otherwise
+ */
+ServiceResponse PathService::cancel(const Connection &connection, const ServiceRequest &request)
+{
+    ServiceResponse response;
+    response.requestId = request.requestId;
+    std::lock_guard<std::mutex> lock(stateMutex);
+    auto query = activeQueries.find(std::make_pair(&connection, request.targetId));
+    if (query == activeQueries.end())
+    {
+        response.message = "No query " + std::to_string(request.targetId) + " in flight";
+        return response;
+    }
+    query->second->raise(ResponseStatus::Cancelled);
+    response.status = ResponseStatus::Ok;
+    return response;
+}
+
+/**
+ * @brief Finds a resident world
+ * @param name World name
+ * @return World, or nullptr if no world has that name
+ */
+std::shared_ptr<PathService::ResidentWorld> PathService::findWorld(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(stateMutex);
+    auto world = worlds.find(name);
+    return world == worlds.end() ? nullptr : world->second;
+}
+
+/**
+ * @brief Loads a world and makes it resident under its name
+ *
+ * The world is decoded outside the service lock. A world already resident
+ * under the name is replaced; mutations still running on it are lost.
+ *
+ * @param request LoadWorld request
+ * @return Ok with the version of the new world
+ */
+ServiceResponse PathService::loadWorld(const ServiceRequest &request)
+{
+    if (request.world.empty())
+    {
+        throw std::invalid_argument("World name must not be empty");
+    }
+    std::shared_ptr<CachedWorld> cached = makeCachedWorld(loadWorldReference(request.reference));
+    cached->ranking = CandidateRanking::getShared(cached->world);
+
+    auto resident = std::make_shared<ResidentWorld>();
+    resident->snapshot = cached;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        worlds[request.world] = std::move(resident);
+    }
+
+    ServiceResponse response;
+    response.status = ResponseStatus::Ok;
+    response.worldVersion = cached->world.getVersion();
+    return response;
+}
+
+/**
+ * @brief Blocks or unblocks cells of a resident world
+ *
+ * 1. Rejects the whole request if a cell is outside the world
+ * 2. Copies the current snapshot and applies the cells to the copy
+ * 3. Recomputes the per-world indexes if anything changed and publishes the copy;
+ *    the candidate rankings are patched from the previous version's instead of
+ *    rescoring the world
+ *
+ * @param request MutateCells request
+ * @return Ok with the version of the published world
+ */
+ServiceResponse PathService::mutateCells(const ServiceRequest &request)
+{
+    auto resident = findWorld(request.world);
+    if (!resident)
+    {
+        throw std::invalid_argument("Unknown world '" + request.world + "'");
+    }
+
+    std::lock_guard<std::mutex> writeLock(resident->writeMutex);
+    std::shared_ptr<const CachedWorld> current;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        current = resident->snapshot;
+    }
+    for (const auto &[row, col] : request.cells)
+    {
+        if (row >= current->world.getColSize() || col >= current->world.getRowSize())
+        {
+            throw std::invalid_argument("Cell {" + std::to_string(row) + "," + std::to_string(col) +
+                                        "} outside the world");
+        }
+    }
+
+    ServiceResponse response;
+    response.status = ResponseStatus::Ok;
+    MatrixWorld world = current->world;
+    for (const auto &[row, col] : request.cells)
+    {
+        world.setCell(row, col, request.blocked);
+    }
+    if (world.getVersion() == current->world.getVersion())
+    {
+        response.worldVersion = current->world.getVersion(); // Nothing changed, keep the indexes warm
+        return response;
+    }
+    std::shared_ptr<CachedWorld> next = makeCachedWorld(std::move(world));
+    next->ranking = CandidateRanking::getPatched(next->world, *current->ranking, request.cells);
+    // DFS engines rank with symmetry pruning; seed theirs from the patched order too
+    (void)CandidateRanking::getPatched(next->world, *current->ranking, request.cells, StartPruning::Symmetry);
+    response.worldVersion = next->world.getVersion();
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        resident->snapshot = std::move(next);
+    }
+    return response;
+}
+
+/**
+ * @brief Runs a query on the current snapshot of its world
+ * @param request QueryPath request
+ * @param query Cancellation state, attached to the engine for the search
+ * @param engines Engines of the calling worker, by algorithm name
+ * @return Found, NotFound, Infeasible, Cancelled or TimedOut
+ */
+ServiceResponse PathService::queryPath(const ServiceRequest &request, ActiveQuery &query,
+                                       std::map<std::string, std::unique_ptr<PathAlgorithm>> &engines)
+{
+    ServiceResponse response;
+    if (query.cancelled.load())
+    {
+        response.status = static_cast<ResponseStatus>(query.reason.load());
+        return response;
+    }
+
+    auto resident = findWorld(request.world);
+    if (!resident)
+    {
+        throw std::invalid_argument("Unknown world '" + request.world + "'");
+    }
+    std::shared_ptr<const CachedWorld> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        snapshot = resident->snapshot;
+    }
+    auto engine = engines.find(request.algorithm);
+    if (engine == engines.end())
+    {
+        engine = engines.emplace(request.algorithm, AlgorithmRegistry::instance().create(request.algorithm)).first;
+    }
+
+    response.worldVersion = snapshot->world.getVersion();
+    if (request.pathLength.value > snapshot->feasibilityBound)
+    {
+        response.status = ResponseStatus::Infeasible;
+        response.message = "Path length " + std::to_string(request.pathLength.value) +
+                           " exceeds the feasibility bound (" + std::to_string(snapshot->feasibilityBound) + ")";
+        return response;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    engine->second->setCancellationFlag(&query.cancelled);
+    try
+    {
+        response.path = engine->second->findViablePath(snapshot->world, request.pathLength, request.maxStartingPoints);
+    }
+    catch (...)
+    {
+        engine->second->setCancellationFlag(nullptr);
+        throw;
+    }
+    engine->second->setCancellationFlag(nullptr);
+    auto stop = std::chrono::steady_clock::now();
+    response.micros = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(stop - start).count());
+
+    if (!response.path.isEmpty())
+    {
+        response.status = ResponseStatus::Found;
+    }
+    else if (query.cancelled.load())
+    {
+        response.status = static_cast<ResponseStatus>(query.reason.load());
+    }
+    else
+    {
+        response.status = ResponseStatus::NotFound;
+    }
+    return response;
+}
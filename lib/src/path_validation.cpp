@@ -0,0 +1,49 @@
+/**
+ * @file path_validation.cpp
+ * @brief Implementation of path result validation
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "path_validation.hpp"
+#include <vector>
+
+/**
+ * @brief Checks that a path is a valid answer to a path finding query
+ *
+ * Engines raced against each other are not trusted blindly - the portfolio
+ * only accepts results that pass this check.
+ *
+ * @param matrixWorld World the path was searched in
+ * @param path Candidate result
+ * @param pathLength Requested path length
+ * @return true if the path is a simple contiguous path of the requested length
+ */
+bool isViablePath(const MatrixWorld &matrixWorld, const Path &path, PathLength pathLength)
+{
+    if (path.getLength() != pathLength.value || !path.isContiguous())
+    {
+        return false;
+    }
+
+    const uint16_t rows = matrixWorld.getColSize();
+    const uint16_t cols = matrixWorld.getRowSize();
+    std::vector<bool> visited(matrixWorld.getTotalCells(), false);
+
+    for (const auto &[row, col] : path)
+    {
+        if (row >= rows || col >= cols || !matrixWorld.isUnblocked(row, col))
+        {
+            return false;
+        }
+
+        size_t index = (static_cast<size_t>(row) * cols) + col;
+        if (visited[index])
+        {
+            return false; // Cell visited twice - not a simple path
+        }
+        visited[index] = true;
+    }
+    return true;
+}
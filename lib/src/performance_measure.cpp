@@ -7,95 +7,567 @@
  */
 
 #include "performance_measure.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <chrono>
 #include <cstring>
+#include <ctime>
+#include <iomanip>
 #include <iostream>
 #include <linux/perf_event.h>
 #include <sys/ioctl.h>
-#include <cstdlib> // For exit()
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace
+{
+/**
+ * @struct CounterSpec
+ * @brief The perf event and the report label of one counter.
+ */
+struct CounterSpec
+{
+    uint32_t type;     ///< perf_event_attr::type
+    uint64_t config;   ///< perf_event_attr::config
+    const char *label; ///< Name in the measure summary
+};
+
+/**
+ * @brief The counters of the group, indexed by PerformanceMeasure::Counter.
+ *
+ * Hardware events come first, so the leader is a hardware event whenever
+ * the PMU is available; software events may join a hardware group.
+ */
+constexpr std::array<CounterSpec, PerformanceMeasure::COUNTER_COUNT> COUNTER_SPECS = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "Cycles"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "Instructions"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES, "Cache references"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "Cache misses"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, "Branch misses"},
+    {PERF_TYPE_HW_CACHE,
+     PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+     "L1D read misses"},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK, "Task clock(nS)"},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS, "Page faults"},
+}};
+
+/**
+ * @brief The most detailed tier that worked so far, shared by all instances.
+ *
+ * Tiers that failed once are not probed again, so a process without perf
+ * permissions does not retry perf_event_open on every measurement.
+ */
+std::atomic<uint8_t> firstWorkingTier{0};
+
+/**
+ * @brief The errno of the first perf_event_open failure that lowered firstWorkingTier.
+ */
+std::atomic<int> firstFallbackError{0};
+
+/**
+ * @brief Reads the CPU time of the calling thread.
+ * @return Nanoseconds, or std::nullopt if the clock is unavailable.
+ */
+std::optional<uint64_t> readThreadCpuNanos()
+{
+    timespec now = {};
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now) != 0)
+    {
+        return std::nullopt;
+    }
+    return (static_cast<uint64_t>(now.tv_sec) * 1000000000U) + static_cast<uint64_t>(now.tv_nsec);
+}
+
+/**
+ * @brief Reads the time stamp counter.
+ * @return Ticks, or std::nullopt on CPUs without one.
+ */
+std::optional<uint64_t> readTimeStampCounter()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::nullopt;
+#endif
+}
+
+/**
+ * @brief The position of a counter in the arrays of PerformanceMeasure.
+ */
+constexpr size_t indexOf(PerformanceMeasure::Counter counter)
+{
+    return static_cast<size_t>(counter);
+}
+
+/**
+ * @brief Divides two counters, scaled.
+ * @return numerator × scale / denominator, or std::nullopt if either is missing or the denominator is zero.
+ */
+std::optional<double> counterRatio(const PerformanceMeasure::Measures &measures, PerformanceMeasure::Counter numerator,
+                                   PerformanceMeasure::Counter denominator, double scale)
+{
+    const std::optional<uint64_t> top = measures.get(numerator);
+    const std::optional<uint64_t> bottom = measures.get(denominator);
+    if (!top || !bottom || *bottom == 0)
+    {
+        return std::nullopt;
+    }
+    return static_cast<double>(*top) * scale / static_cast<double>(*bottom);
+}
+
+/**
+ * @brief Writes a derived metric, or "n/a".
+ */
+void printMetric(std::ostream &stream, const char *label, std::optional<double> value, const char *unit = "")
+{
+    stream << label << ": ";
+    if (value)
+    {
+        stream << std::fixed << std::setprecision(2) << *value << unit << std::defaultfloat;
+    }
+    else
+    {
+        stream << "n/a";
+    }
+    stream << "\n";
+}
+} // namespace
+
+/**
+ * @brief Returns the report name of a tier.
+ * @param tier Measurement tier.
+ * @return Human readable name.
+ */
+const char *PerformanceMeasure::tierName(Tier tier)
+{
+    switch (tier)
+    {
+    case Tier::PerfCounters:
+        return "perf counters";
+    case Tier::UserSpaceCounters:
+        return "user-space perf counters";
+    case Tier::ThreadClock:
+        return "thread CPU clock and TSC";
+    case Tier::WallTime:
+        break;
+    }
+    return "wall time only";
+}
+
+/**
+ * @brief Returns the value of a counter.
+ * @param counter Counter to read.
+ * @return The value, or std::nullopt if the counter was not counted.
+ */
+std::optional<uint64_t> PerformanceMeasure::Measures::get(Counter counter) const
+{
+    if (!counted[indexOf(counter)])
+    {
+        return std::nullopt;
+    }
+    return counters[indexOf(counter)];
+}
+
+/**
+ * @brief Returns instructions per cycle.
+ * * Low IPC with high miss rates points to a memory-bound run, low IPC
+ * with a high branch MPKI to a branch-bound one.
+ * @return IPC, or std::nullopt if unavailable.
+ */
+std::optional<double> PerformanceMeasure::Measures::getInstructionsPerCycle() const
+{
+    return counterRatio(*this, Counter::Instructions, Counter::Cycles, 1.0);
+}
+
+/**
+ * @brief Returns the share of cache references that missed.
+ * @return Miss rate in [0, 1], or std::nullopt if unavailable.
+ */
+std::optional<double> PerformanceMeasure::Measures::getCacheMissRate() const
+{
+    return counterRatio(*this, Counter::CacheMisses, Counter::CacheReferences, 1.0);
+}
+
+/**
+ * @brief Returns the branch misses per thousand instructions.
+ * @return MPKI, or std::nullopt if unavailable.
+ */
+std::optional<double> PerformanceMeasure::Measures::getBranchMissesPerKiloInstruction() const
+{
+    return counterRatio(*this, Counter::BranchMisses, Counter::Instructions, 1000.0);
+}
+
+/**
+ * @brief Returns the L1 data cache read misses per thousand instructions.
+ * @return MPKI, or std::nullopt if unavailable.
+ */
+std::optional<double> PerformanceMeasure::Measures::getL1dMissesPerKiloInstruction() const
+{
+    return counterRatio(*this, Counter::L1dReadMisses, Counter::Instructions, 1000.0);
+}
 
 /**
  * @brief Constructs a new PerformanceMeasure object.
- * * This constructor initializes the perf_event_attr struct to monitor
- * CPU cycles, preparing the object for performance measurement.
+ * * No counter is open until measureStart().
+ */
+PerformanceMeasure::PerformanceMeasure() : perfFileDesc(-1)
+{
+    counterFileDescs.fill(-1);
+}
+
+/**
+ * @brief Closes any counter left open.
  */
-PerformanceMeasure::PerformanceMeasure()
+PerformanceMeasure::~PerformanceMeasure()
 {
-    cycleCounterS.type = PERF_TYPE_HARDWARE;
-    cycleCounterS.size = sizeof(perf_event_attr);
-    cycleCounterS.config = PERF_COUNT_HW_CPU_CYCLES;
+    closeCounters();
+}
+
+/**
+ * @brief Copies only the last measures; counters are never shared.
+ * @param other Instance to copy.
+ */
+PerformanceMeasure::PerformanceMeasure(const PerformanceMeasure &other)
+    : startTime(other.startTime), stopTime(other.stopTime), lastMeasures(other.lastMeasures), perfFileDesc(-1),
+      activeTier(other.activeTier), tierLimit(other.tierLimit),
+      activeFallbackError(other.activeFallbackError), progressMessages(other.progressMessages)
+{
+    counterFileDescs.fill(-1);
+}
+
+/**
+ * @brief Copies only the last measures; counters are never shared.
+ * @param other Instance to copy.
+ * @return A reference to this instance.
+ */
+PerformanceMeasure &PerformanceMeasure::operator=(const PerformanceMeasure &other)
+{
+    if (this != &other)
+    {
+        closeCounters();
+        startTime = other.startTime;
+        stopTime = other.stopTime;
+        lastMeasures = other.lastMeasures;
+        activeTier = other.activeTier;
+        tierLimit = other.tierLimit;
+        activeFallbackError = other.activeFallbackError;
+        progressMessages = other.progressMessages;
+    }
+    return *this;
+}
+
+/**
+ * @brief Closes every counter of the group.
+ */
+void PerformanceMeasure::closeCounters()
+{
+    for (int32_t &fileDesc : counterFileDescs)
+    {
+        if (fileDesc != -1)
+        {
+            close(fileDesc);
+            fileDesc = -1;
+        }
+    }
+    perfFileDesc = -1;
+}
+
+/**
+ * @brief Limits the tiers this instance may use.
+ * @param tier The most detailed tier allowed.
+ */
+void PerformanceMeasure::setTierLimit(Tier tier)
+{
+    tierLimit = tier;
+}
+
+/**
+ * @brief Enables or disables the start and stop messages on stdout.
+ * @param enabled Whether to print them.
+ */
+void PerformanceMeasure::setProgressMessages(bool enabled)
+{
+    progressMessages = enabled;
+}
+
+/**
+ * @brief Returns the tier of the running or last measurement.
+ * @return Measurement tier.
+ */
+PerformanceMeasure::Tier PerformanceMeasure::getTier() const
+{
+    return activeTier;
+}
+
+/**
+ * @brief Opens the counters the machine supports as one group.
+ * * The first counter that opens becomes the (disabled) leader, the others
+ * join it; counters the machine does not support are skipped.
+ * @param userSpaceOnly Whether to exclude kernel and hypervisor counting.
+ * @return 0 if at least one counter opened, else the errno of the first failure.
+ */
+int PerformanceMeasure::openCounterGroup(bool userSpaceOnly)
+{
+    closeCounters();
+    int openError = 0;
+    for (size_t index = 0; index < COUNTER_COUNT; index++)
+    {
+        perf_event_attr attr = {};
+        attr.type = COUNTER_SPECS[index].type;
+        attr.size = sizeof(perf_event_attr);
+        attr.config = COUNTER_SPECS[index].config;
+        attr.read_format =
+            PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        attr.disabled = perfFileDesc == -1 ? 1 : 0;
+        attr.exclude_kernel = userSpaceOnly ? 1 : 0;
+        attr.exclude_hv = userSpaceOnly ? 1 : 0;
+
+        const auto fileDesc = static_cast<int32_t>(perf_event_open(&attr, 0, -1, perfFileDesc, 0));
+        if (fileDesc == -1)
+        {
+            if (openError == 0)
+            {
+                openError = errno;
+            }
+            continue;
+        }
+        if (ioctl(fileDesc, PERF_EVENT_IOC_ID, &counterIds[index]) == -1)
+        {
+            close(fileDesc);
+            continue;
+        }
+        counterFileDescs[index] = fileDesc;
+        if (perfFileDesc == -1)
+        {
+            perfFileDesc = fileDesc;
+        }
+    }
+    return perfFileDesc != -1 ? 0 : (openError != 0 ? openError : ENOENT);
 }
 
 /**
  * @brief Starts the performance measurement.
- * * This function opens the perf event file descriptor for CPU cycles.
- * It resets and enables the counter, then records the start time.
- * @note This function will exit the program if it fails to open the
- * perf event file descriptor, as performance measurement is a critical
- * part of the application's functionality.
+ * * This function walks the tiers from the most detailed one that has not
+ * failed before (and is within the tier limit):
+ * 1. perf event group counting user and kernel space
+ * 2. the same group with exclude_kernel/exclude_hv, which perf_event_paranoid
+ *    2 still allows unprivileged processes
+ * 3. the thread CPU clock and the time stamp counter
+ * 4. wall time alone
+ * A perf tier that fails is skipped by later measurements of the process.
+ * The counters are reset, the start time is recorded and the group is
+ * enabled at once.
  */
 void PerformanceMeasure::measureStart()
 {
-    perfFileDesc = static_cast<int32_t>(perf_event_open(&cycleCounterS, 0, -1, -1, 0));
-
-    if (perfFileDesc == -1)
+    closeCounters();
+    const uint8_t cachedTier = firstWorkingTier.load();
+    auto tier = static_cast<Tier>(std::max(cachedTier, static_cast<uint8_t>(tierLimit)));
+    // Starting below the limit because of an earlier failure reports that failure
+    activeFallbackError = cachedTier > static_cast<uint8_t>(tierLimit) ? firstFallbackError.load() : 0;
+    while (tier == Tier::PerfCounters || tier == Tier::UserSpaceCounters)
     {
-        std::cerr << "Error opening the perf_event_open file descriptor." << "\n";
-        std::cerr << "The performance measurement can not operate" << "\n";
-        std::cerr << "Reason: " << strerror(errno) << " (errno " << errno << ")" << "\n";
-        exit(1);
+        const int openError = openCounterGroup(tier == Tier::UserSpaceCounters);
+        if (openError == 0)
+        {
+            break;
+        }
+        tier = static_cast<Tier>(static_cast<uint8_t>(tier) + 1);
+        // The first perf tier that failed explains every tier below it
+        if (activeFallbackError == 0)
+        {
+            activeFallbackError = openError;
+        }
+        int noError = 0;
+        firstFallbackError.compare_exchange_strong(noError, openError);
+        uint8_t working = firstWorkingTier.load();
+        while (working < static_cast<uint8_t>(tier) &&
+               !firstWorkingTier.compare_exchange_weak(working, static_cast<uint8_t>(tier)))
+        {
+        }
     }
 
-    ioctl(perfFileDesc, PERF_EVENT_IOC_RESET, 0);
-    ioctl(perfFileDesc, PERF_EVENT_IOC_ENABLE, 0);
+    std::optional<uint64_t> threadNanos;
+    if (tier == Tier::ThreadClock)
+    {
+        threadNanos = readThreadCpuNanos();
+        tier = threadNanos ? Tier::ThreadClock : Tier::WallTime;
+    }
+    activeTier = tier;
 
+    // The wall time encloses the counting interval
+    if (perfFileDesc != -1)
+    {
+        ioctl(perfFileDesc, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    }
     startTime = std::chrono::high_resolution_clock::now();
+    if (perfFileDesc != -1)
+    {
+        ioctl(perfFileDesc, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+    else if (activeTier == Tier::ThreadClock)
+    {
+        startTicks = readTimeStampCounter().value_or(0);
+        startThreadNanos = readThreadCpuNanos().value_or(*threadNanos);
+    }
 
-    std::cout << "Starting measurement" << "\n";
+    if (progressMessages)
+    {
+        std::cout << "Starting measurement" << "\n";
+    }
 }
 
 /**
  * @brief Stops the performance measurement.
- * * This function disables the perf event counter, reads the cycle count,
- * and closes the file descriptor. It also records the stop time.
+ * * This function disables the group, reads all counters with one
+ * PERF_FORMAT_GROUP read and closes the group. Values are matched to
+ * counters by id and scaled by time enabled / time running in case the
+ * kernel multiplexed the group with other events. A group that was never
+ * scheduled leaves every counter uncounted. Without perf events the
+ * thread CPU time becomes the task clock and the TSC delta is kept.
  */
 void PerformanceMeasure::measureStop()
 {
-    ioctl(perfFileDesc, PERF_EVENT_IOC_DISABLE);
-    read(perfFileDesc, &cycleCount, sizeof(uint64_t));
-    close(perfFileDesc);
-
+    std::optional<uint64_t> threadNanos;
+    std::optional<uint64_t> ticks;
+    if (perfFileDesc != -1)
+    {
+        ioctl(perfFileDesc, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+    else if (activeTier == Tier::ThreadClock)
+    {
+        threadNanos = readThreadCpuNanos();
+        ticks = readTimeStampCounter();
+    }
     stopTime = std::chrono::high_resolution_clock::now();
 
-    std::cout << "Stopping measurement" << "\n";
+    // { nr, time_enabled, time_running, { value, id }[nr] }
+    std::array<uint64_t, 3 + (2 * COUNTER_COUNT)> groupRead = {};
+    const ssize_t received = perfFileDesc == -1 ? -1 : read(perfFileDesc, groupRead.data(), sizeof(groupRead));
+
+    lastMeasures = {};
+    lastMeasures.runningShare = 1.0;
+    if (received >= static_cast<ssize_t>(3 * sizeof(uint64_t)))
+    {
+        const uint64_t entries = std::min<uint64_t>(groupRead[0], COUNTER_COUNT);
+        const uint64_t enabled = groupRead[1];
+        const uint64_t running = groupRead[2];
+        const double scale = running != 0 && running < enabled ? static_cast<double>(enabled) / running : 1.0;
+        lastMeasures.runningShare = enabled != 0 ? static_cast<double>(running) / enabled : 1.0;
+        // A group that never got on the PMU (e.g. more hardware events than
+        // free counters) counted nothing: its zeros are not counts
+        for (uint64_t entry = 0; running != 0 && entry < entries; entry++)
+        {
+            const uint64_t value = groupRead[3 + (2 * entry)];
+            const uint64_t id = groupRead[4 + (2 * entry)];
+            for (size_t index = 0; index < COUNTER_COUNT; index++)
+            {
+                if (counterFileDescs[index] != -1 && counterIds[index] == id)
+                {
+                    lastMeasures.counters[index] = static_cast<uint64_t>(static_cast<double>(value) * scale);
+                    lastMeasures.counted[index] = true;
+                }
+            }
+        }
+    }
+    if (threadNanos)
+    {
+        lastMeasures.counters[indexOf(Counter::TaskClock)] = *threadNanos - startThreadNanos;
+        lastMeasures.counted[indexOf(Counter::TaskClock)] = true;
+    }
+    if (ticks)
+    {
+        lastMeasures.tscTicks = *ticks - startTicks;
+    }
+    lastMeasures.cycleCount = lastMeasures.get(Counter::Cycles).value_or(0);
+    lastMeasures.tier = activeTier;
+    lastMeasures.fallbackError = activeFallbackError;
+    closeCounters();
+
+    if (progressMessages)
+    {
+        std::cout << "Stopping measurement" << "\n";
+    }
 }
 
 /**
- * @brief Prints the measured time and cycle counts.
+ * @brief Prints the measured time, counters and derived metrics.
  * * This function calculates the elapsed time in microseconds and prints
  * a formatted summary to the standard output.
  */
 void PerformanceMeasure::printMeasurements()
 {
-    Measures printS = {};
+    Measures printS = lastMeasures;
     printS.timeCount = std::chrono::duration_cast<std::chrono::microseconds>(stopTime - startTime).count();
-    printS.cycleCount = this->cycleCount;
+    printMeasures(std::cout, printS);
+}
 
-    std::cout << "=== MEASURE SUMMARY ===" << "\n";
-    std::cout << "Time taken(uS): " << printS.timeCount << "\n";
-    std::cout << "Cycles: " << printS.cycleCount << "\n";
-    std::cout << "=======================" << "\n";
+/**
+ * @brief Writes a measure summary: time, counters and derived metrics.
+ * * CPU utilization is task clock over wall time; a multiplexed group is
+ * flagged with the share of the time it was counting.
+ * @param stream Output stream.
+ * @param measures Measures with timeCount in microseconds.
+ */
+void PerformanceMeasure::printMeasures(std::ostream &stream, const Measures &measures)
+{
+    stream << "=== MEASURE SUMMARY ===" << "\n";
+    stream << "Measurement tier: " << tierName(measures.tier);
+    if (measures.fallbackError != 0)
+    {
+        stream << " (perf_event_open: " << strerror(measures.fallbackError) << ")";
+    }
+    stream << "\n";
+    stream << "Time taken(uS): " << measures.timeCount << "\n";
+    for (size_t index = 0; index < COUNTER_COUNT; index++)
+    {
+        stream << COUNTER_SPECS[index].label << ": ";
+        if (measures.counted[index])
+        {
+            stream << measures.counters[index];
+        }
+        else
+        {
+            stream << "n/a";
+        }
+        stream << "\n";
+    }
+    if (measures.tscTicks)
+    {
+        stream << "TSC ticks: " << *measures.tscTicks << "\n";
+    }
+
+    std::optional<double> cacheMissPercent = measures.getCacheMissRate();
+    if (cacheMissPercent)
+    {
+        *cacheMissPercent *= 100.0;
+    }
+    std::optional<double> cpuUtilization;
+    if (const std::optional<uint64_t> taskClock = measures.get(Counter::TaskClock); taskClock && measures.timeCount != 0)
+    {
+        cpuUtilization = static_cast<double>(*taskClock) / (10.0 * static_cast<double>(measures.timeCount));
+    }
+    printMetric(stream, "IPC", measures.getInstructionsPerCycle());
+    printMetric(stream, "Cache miss rate", cacheMissPercent, "%");
+    printMetric(stream, "Branch MPKI", measures.getBranchMissesPerKiloInstruction());
+    printMetric(stream, "L1D MPKI", measures.getL1dMissesPerKiloInstruction());
+    printMetric(stream, "CPU utilization", cpuUtilization, "%");
+    if (measures.runningShare < 1.0)
+    {
+        printMetric(stream, "Counters scaled, group counted", measures.runningShare * 100.0, "% of the time");
+    }
+    stream << "=======================" << "\n";
 }
 
 /**
- * @brief Saves the measured time and cycle counts.
- * @return A Measures struct containing the final time (in milliseconds) and cycle counts.
+ * @brief Saves the measured time and counters.
+ * @return A Measures struct containing the final time (in milliseconds) and counters.
  */
 PerformanceMeasure::Measures PerformanceMeasure::saveMeasures()
 {
-    Measures saveS = {};
+    Measures saveS = lastMeasures;
     saveS.timeCount = std::chrono::duration_cast<std::chrono::milliseconds>(stopTime - startTime).count();
-    saveS.cycleCount = this->cycleCount;
     return saveS;
-}
\ No newline at end of file
+}
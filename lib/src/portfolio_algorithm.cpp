@@ -0,0 +1,174 @@
+/**
+ * @file portfolio_algorithm.cpp
+ * @brief Implementation of the concurrent engine portfolio
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "portfolio_algorithm.hpp"
+#include "algorithm_registry.hpp"
+#include "feasibility_oracle.hpp"
+#include "path_validation.hpp"
+#include "world_statistics.hpp"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @brief Constructs a portfolio racing the given engines
+ * @param engineNames Registry names of the engines to race (empty = all applicable)
+ * @throws std::invalid_argument If "portfolio" itself is listed
+ */
+PortfolioAlgorithm::PortfolioAlgorithm(std::vector<std::string> engineNames) : engineNames(std::move(engineNames))
+{
+    if (std::find(this->engineNames.begin(), this->engineNames.end(), "portfolio") != this->engineNames.end())
+    {
+        throw std::invalid_argument("A portfolio cannot race itself");
+    }
+}
+
+/**
+ * @brief Races the engines and returns the first valid path
+ *
+ * 1. Validates input parameters the same way the DFS engine does
+ * 2. Rejects provably infeasible requests before any thread is started
+ * 3. Resolves the engines to race (explicit list or all applicable engines)
+ * 4. Starts one thread per engine, all sharing a single cancellation flag
+ * 5. The first viable path - or an empty result of a complete engine - decides
+ *    the race, raises the flag and wakes the supervising thread
+ * 6. Joins all threads and records the winner in the registry
+ *
+ * Engine exceptions are contained in their thread and count as a lost race.
+ * The supervising thread also forwards cancellation of the portfolio itself.
+ *
+ * @param matrixWorld Reference to the matrix world
+ * @param pathLength Target path length
+ * @param maxStartingPoints Maximum starting points forwarded to the engines
+ * @return Path object containing the found path (empty if none found)
+ * @throws std::invalid_argument If pathLength is zero or exceeds matrix size,
+ *         or an explicitly listed engine is not registered
+ */
+Path PortfolioAlgorithm::findViablePath(const MatrixWorld &matrixWorld,
+                                        PathLength pathLength,
+                                        MaxStartingPoints maxStartingPoints)
+{
+    if (pathLength.value == 0)
+    {
+        throw std::invalid_argument("Path length must be greater than zero");
+    }
+
+    if (pathLength.value > matrixWorld.getTotalCells())
+    {
+        throw std::invalid_argument("Path length exceeds matrix size");
+    }
+
+    lastWinner.clear();
+    if (!checkPathFeasibility(matrixWorld, pathLength).isFeasible)
+    {
+        return {}; // Not worth starting a single thread
+    }
+
+    AlgorithmRegistry &registry = AlgorithmRegistry::instance();
+    WorldStatistics stats = computeWorldStatistics(matrixWorld);
+
+    std::vector<AlgorithmDescriptor> engines;
+    if (engineNames.empty())
+    {
+        engines = registry.selectEngines(stats, pathLength);
+    }
+    else
+    {
+        std::vector<AlgorithmDescriptor> descriptors = registry.getDescriptors();
+        for (const auto &name : engineNames)
+        {
+            auto entry = std::find_if(descriptors.begin(), descriptors.end(),
+                                      [&name](const AlgorithmDescriptor &descriptor) { return descriptor.name == name; });
+            if (entry == descriptors.end())
+            {
+                throw std::invalid_argument("Unknown algorithm: " + name);
+            }
+            engines.push_back(*entry);
+        }
+    }
+
+    if (engines.empty())
+    {
+        return {};
+    }
+
+    // Shared race state - guarded by raceMutex except for the atomic flag
+    std::atomic<bool> stopRace{false};
+    std::mutex raceMutex;
+    std::condition_variable raceDone;
+    size_t finishedEngines = 0;
+    bool isDecided = false;
+    Path result;
+
+    std::vector<std::thread> workers;
+    workers.reserve(engines.size());
+    for (const auto &descriptor : engines)
+    {
+        workers.emplace_back([&, descriptor] {
+            Path path;
+            bool hasFinished = false;
+            try
+            {
+                std::unique_ptr<PathAlgorithm> engine = descriptor.factory();
+                engine->setCancellationFlag(&stopRace);
+                path = engine->findViablePath(matrixWorld, pathLength, maxStartingPoints);
+                hasFinished = true;
+            }
+            catch (const std::exception &)
+            {
+                // A failing engine simply loses the race
+            }
+
+            std::lock_guard<std::mutex> lock(raceMutex);
+            finishedEngines++;
+            // Results produced after the race was stopped may be truncated - ignore them
+            if (hasFinished && !isDecided && !stopRace.load())
+            {
+                bool isValidPath = !path.isEmpty() && isViablePath(matrixWorld, path, pathLength);
+                bool isProvenInfeasible = path.isEmpty() && descriptor.isComplete;
+                if (isValidPath || isProvenInfeasible)
+                {
+                    isDecided = true;
+                    result = std::move(path);
+                    lastWinner = descriptor.name;
+                    stopRace.store(true);
+                }
+            }
+            raceDone.notify_all();
+        });
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(raceMutex);
+        while (!isDecided && finishedEngines < engines.size())
+        {
+            raceDone.wait_for(lock, std::chrono::milliseconds(10));
+            if (isCancelled())
+            {
+                break;
+            }
+        }
+    }
+    // Cancel the engines still running
+    stopRace.store(true);
+
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    if (!lastWinner.empty())
+    {
+        registry.recordWin(lastWinner, stats);
+    }
+
+    return result;
+}
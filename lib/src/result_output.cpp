@@ -0,0 +1,408 @@
+/**
+ * @file result_output.cpp
+ * @brief Implementation of the JSON lines and CSV result writers
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "result_output.hpp"
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+
+namespace
+{
+/**
+ * @brief Appends an integer without going through a stream
+ */
+template <typename Integer> void appendNumber(std::string &output, Integer value)
+{
+    char digits[24];
+    auto [end, error] = std::to_chars(digits, digits + sizeof(digits), value);
+    output.append(digits, end);
+}
+
+/**
+ * @brief Appends microseconds rounded to 0.1
+ */
+void appendMicros(std::string &output, double micros)
+{
+    const auto tenths = static_cast<uint64_t>(std::llround(micros * 10.0));
+    appendNumber(output, tenths / 10);
+    output += '.';
+    output += static_cast<char>('0' + (tenths % 10));
+}
+
+/**
+ * @brief Record keys of the perf counters, in PerformanceMeasure::Counter order
+ */
+constexpr std::array<const char *, PerformanceMeasure::COUNTER_COUNT> COUNTER_KEYS = {
+    "cycles", "instructions", "cache_references", "cache_misses",
+    "branch_misses", "l1d_read_misses", "task_clock_ns", "page_faults"};
+
+/**
+ * @brief Appends a JSON string literal
+ */
+void appendJsonString(std::string &output, std::string_view text)
+{
+    static constexpr char HEX[] = "0123456789abcdef";
+    output += '"';
+    for (char character : text)
+    {
+        switch (character)
+        {
+        case '"':
+            output += "\\\"";
+            break;
+        case '\\':
+            output += "\\\\";
+            break;
+        case '\n':
+            output += "\\n";
+            break;
+        case '\r':
+            output += "\\r";
+            break;
+        case '\t':
+            output += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(character) < 0x20)
+            {
+                output += "\\u00";
+                output += HEX[(character >> 4) & 0xF];
+                output += HEX[character & 0xF];
+            }
+            else
+            {
+                output += character;
+            }
+        }
+    }
+    output += '"';
+}
+
+/**
+ * @brief Appends a CSV field, quoted if it holds a separator, quote or line break
+ */
+void appendCsvField(std::string &output, std::string_view text)
+{
+    if (text.find_first_of(",\"\r\n") == std::string_view::npos)
+    {
+        output += text;
+        return;
+    }
+    output += '"';
+    for (char character : text)
+    {
+        output += character;
+        if (character == '"')
+        {
+            output += '"';
+        }
+    }
+    output += '"';
+}
+} // namespace
+
+/**
+ * @brief Parses an output format name
+ * @param name "text", "json" or "csv"
+ * @return Matching format
+ * @throws std::invalid_argument If the name is unknown
+ */
+OutputFormat parseOutputFormat(std::string_view name)
+{
+    if (name == "text")
+    {
+        return OutputFormat::Text;
+    }
+    if (name == "json")
+    {
+        return OutputFormat::Json;
+    }
+    if (name == "csv")
+    {
+        return OutputFormat::Csv;
+    }
+    throw std::invalid_argument("Unknown output format '" + std::string(name) + "' (expected text, json or csv)");
+}
+
+/**
+ * @brief Parses a path encoding name
+ * @param name "inline" or "compact"
+ * @return Matching encoding
+ * @throws std::invalid_argument If the name is unknown
+ */
+PathEncoding parsePathEncoding(std::string_view name)
+{
+    if (name == "inline")
+    {
+        return PathEncoding::Inline;
+    }
+    if (name == "compact")
+    {
+        return PathEncoding::Compact;
+    }
+    throw std::invalid_argument("Unknown path encoding '" + std::string(name) + "' (expected inline or compact)");
+}
+
+/**
+ * @brief Encodes a path as one move letter per step
+ * @param path Contiguous path
+ * @return 'U', 'D', 'L' or 'R' for each step after the first cell ('?' for a non-adjacent step)
+ */
+std::string encodeMoves(const Path &path)
+{
+    std::string moves;
+    if (path.isEmpty())
+    {
+        return moves;
+    }
+    moves.reserve(path.getLength() - 1);
+    auto previous = path.begin();
+    for (auto cell = std::next(previous); cell != path.end(); previous = cell++)
+    {
+        const int rowStep = static_cast<int>(cell->first) - static_cast<int>(previous->first);
+        const int colStep = static_cast<int>(cell->second) - static_cast<int>(previous->second);
+        if (rowStep == -1 && colStep == 0)
+        {
+            moves += 'U';
+        }
+        else if (rowStep == 1 && colStep == 0)
+        {
+            moves += 'D';
+        }
+        else if (rowStep == 0 && colStep == -1)
+        {
+            moves += 'L';
+        }
+        else if (rowStep == 0 && colStep == 1)
+        {
+            moves += 'R';
+        }
+        else
+        {
+            moves += '?';
+        }
+    }
+    return moves;
+}
+
+/**
+ * @brief Appends a record as one JSON object and a newline
+ *
+ * Keys: job (batch only), status, algorithm, world, rows, cols,
+ * blocked_cells, path_length (requested), length (found), timings_us
+ * {load, feasibility, search, total}, path, reason (if any), counters (if
+ * measured: tier and every perf counter, null when it was not counted).
+ *
+ * @param output Buffer to append to
+ * @param record Query record
+ * @param encoding Path encoding
+ */
+void appendJsonRecord(std::string &output, const QueryRecord &record, PathEncoding encoding)
+{
+    output += '{';
+    if (record.job.has_value())
+    {
+        output += "\"job\":";
+        appendNumber(output, *record.job);
+        output += ',';
+    }
+    output += "\"status\":";
+    appendJsonString(output, record.status);
+    output += ",\"algorithm\":";
+    appendJsonString(output, record.algorithm);
+    output += ",\"world\":";
+    appendJsonString(output, record.world);
+    output += ",\"rows\":";
+    appendNumber(output, record.rows);
+    output += ",\"cols\":";
+    appendNumber(output, record.cols);
+    output += ",\"blocked_cells\":";
+    appendNumber(output, record.blockedCells);
+    output += ",\"path_length\":";
+    appendNumber(output, record.pathLength.value);
+    output += ",\"length\":";
+    appendNumber(output, record.path.getLength());
+
+    output += ",\"timings_us\":{\"load\":";
+    appendMicros(output, record.timings.loadMicros);
+    output += ",\"feasibility\":";
+    appendMicros(output, record.timings.feasibilityMicros);
+    output += ",\"search\":";
+    appendMicros(output, record.timings.searchMicros);
+    output += ",\"total\":";
+    appendMicros(output, record.timings.totalMicros);
+    output += "},\"path\":";
+
+    if (record.path.isEmpty())
+    {
+        output += "null";
+    }
+    else if (encoding == PathEncoding::Compact)
+    {
+        const auto [row, col] = *record.path.begin();
+        output += "{\"start\":[";
+        appendNumber(output, row);
+        output += ',';
+        appendNumber(output, col);
+        output += "],\"moves\":\"";
+        output += encodeMoves(record.path);
+        output += "\"}";
+    }
+    else
+    {
+        output += '[';
+        for (const auto &[row, col] : record.path)
+        {
+            output += '[';
+            appendNumber(output, row);
+            output += ',';
+            appendNumber(output, col);
+            output += "],";
+        }
+        output.back() = ']';
+    }
+
+    if (record.counters.has_value())
+    {
+        output += ",\"counters\":{\"tier\":";
+        appendJsonString(output, PerformanceMeasure::tierName(record.counters->tier));
+        for (size_t index = 0; index < PerformanceMeasure::COUNTER_COUNT; index++)
+        {
+            output += ",\"";
+            output += COUNTER_KEYS[index];
+            output += "\":";
+            const auto value = record.counters->get(static_cast<PerformanceMeasure::Counter>(index));
+            if (value.has_value())
+            {
+                appendNumber(output, *value);
+            }
+            else
+            {
+                output += "null";
+            }
+        }
+        output += '}';
+    }
+
+    if (!record.reason.empty())
+    {
+        output += ",\"reason\":";
+        appendJsonString(output, record.reason);
+    }
+    output += "}\n";
+}
+
+/**
+ * @brief Appends the CSV header line
+ * @param output Buffer to append to
+ */
+void appendCsvHeader(std::string &output)
+{
+    output += "job,status,algorithm,world,rows,cols,blocked_cells,path_length,length,"
+              "load_us,feasibility_us,search_us,total_us,start_row,start_col,moves,reason,measurement_tier";
+    for (const char *key : COUNTER_KEYS)
+    {
+        output += ',';
+        output += key;
+    }
+    output += '\n';
+}
+
+/**
+ * @brief Appends a record as one CSV row; the path is always compact (start, moves)
+ *
+ * The counter columns are empty unless the record was measured.
+ *
+ * @param output Buffer to append to
+ * @param record Query record
+ */
+void appendCsvRecord(std::string &output, const QueryRecord &record)
+{
+    if (record.job.has_value())
+    {
+        appendNumber(output, *record.job);
+    }
+    output += ',';
+    appendCsvField(output, record.status);
+    output += ',';
+    appendCsvField(output, record.algorithm);
+    output += ',';
+    appendCsvField(output, record.world);
+    output += ',';
+    appendNumber(output, record.rows);
+    output += ',';
+    appendNumber(output, record.cols);
+    output += ',';
+    appendNumber(output, record.blockedCells);
+    output += ',';
+    appendNumber(output, record.pathLength.value);
+    output += ',';
+    appendNumber(output, record.path.getLength());
+    for (double micros : {record.timings.loadMicros, record.timings.feasibilityMicros, record.timings.searchMicros,
+                          record.timings.totalMicros})
+    {
+        output += ',';
+        appendMicros(output, micros);
+    }
+    output += ',';
+    if (!record.path.isEmpty())
+    {
+        appendNumber(output, record.path.begin()->first);
+        output += ',';
+        appendNumber(output, record.path.begin()->second);
+        output += ',';
+        output += encodeMoves(record.path);
+    }
+    else
+    {
+        output += ",,";
+    }
+    output += ',';
+    appendCsvField(output, record.reason);
+    output += ',';
+    if (record.counters.has_value())
+    {
+        appendCsvField(output, PerformanceMeasure::tierName(record.counters->tier));
+    }
+    for (size_t index = 0; index < PerformanceMeasure::COUNTER_COUNT; index++)
+    {
+        output += ',';
+        if (record.counters.has_value())
+        {
+            const auto value = record.counters->get(static_cast<PerformanceMeasure::Counter>(index));
+            if (value.has_value())
+            {
+                appendNumber(output, *value);
+            }
+        }
+    }
+    output += '\n';
+}
+
+/**
+ * @brief Writes a record in the given format with a single stream write
+ * @param stream Output stream
+ * @param record Query record
+ * @param format OutputFormat::Json or OutputFormat::Csv (Text writes nothing)
+ * @param encoding Path encoding of JSON records
+ */
+void writeRecord(std::ostream &stream, const QueryRecord &record, OutputFormat format, PathEncoding encoding)
+{
+    std::string line;
+    if (format == OutputFormat::Json)
+    {
+        appendJsonRecord(line, record, encoding);
+    }
+    else if (format == OutputFormat::Csv)
+    {
+        appendCsvRecord(line, record);
+    }
+    stream.write(line.data(), static_cast<std::streamsize>(line.size()));
+}
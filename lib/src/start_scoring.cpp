@@ -0,0 +1,248 @@
+/**
+ * @file start_scoring.cpp
+ * @brief Implementation of weighted starting point scoring
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "start_scoring.hpp"
+#include <algorithm>
+#include <array>
+
+namespace
+{
+constexpr uint16_t LEVELS = StartScoringWeights::FEATURE_LEVELS;
+
+/**
+ * @brief Checks whether a cell of the degree array is free
+ * @param degree Degree byte of the cell
+ */
+bool isFree(uint8_t degree)
+{
+    return degree <= LEVELS;
+}
+
+/**
+ * @brief Rounds numerator / denominator × LEVELS to the nearest level
+ */
+uint16_t toLevel(uint64_t numerator, uint64_t denominator)
+{
+    return static_cast<uint16_t>(((2 * LEVELS * numerator) + denominator) / (2 * denominator));
+}
+
+/**
+ * @brief Calls visit(neighbour) for every in-bounds 4-neighbour index of a cell
+ */
+template <typename Visit> void forEachNeighbour(uint32_t cell, uint16_t rows, uint16_t cols, Visit visit)
+{
+    const uint32_t row = cell / cols;
+    const uint32_t col = cell % cols;
+    if (row > 0)
+    {
+        visit(cell - cols);
+    }
+    if (row + 1 < rows)
+    {
+        visit(cell + cols);
+    }
+    if (col > 0)
+    {
+        visit(cell - 1);
+    }
+    if (col + 1 < cols)
+    {
+        visit(cell + 1);
+    }
+}
+
+/**
+ * @brief Component size level of every cell
+ *
+ * Labels components with an explicit-stack flood fill, then maps each size
+ * to its share of the largest component.
+ */
+std::vector<uint16_t> componentLevels(const std::vector<uint8_t> &degrees, uint16_t rows, uint16_t cols)
+{
+    constexpr uint32_t UNLABELLED = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> component(degrees.size(), UNLABELLED);
+    std::vector<uint32_t> sizes;
+    std::vector<uint32_t> stack;
+
+    for (uint32_t start = 0; start < degrees.size(); start++)
+    {
+        if (!isFree(degrees[start]) || component[start] != UNLABELLED)
+        {
+            continue;
+        }
+        const auto label = static_cast<uint32_t>(sizes.size());
+        uint32_t size = 0;
+        component[start] = label;
+        stack.push_back(start);
+        while (!stack.empty())
+        {
+            uint32_t cell = stack.back();
+            stack.pop_back();
+            size++;
+            forEachNeighbour(cell, rows, cols, [&](uint32_t neighbour) {
+                if (isFree(degrees[neighbour]) && component[neighbour] == UNLABELLED)
+                {
+                    component[neighbour] = label;
+                    stack.push_back(neighbour);
+                }
+            });
+        }
+        sizes.push_back(size);
+    }
+
+    const uint32_t largest = sizes.empty() ? 1 : *std::max_element(sizes.begin(), sizes.end());
+    std::vector<uint16_t> levels(degrees.size(), 0);
+    for (uint32_t cell = 0; cell < degrees.size(); cell++)
+    {
+        if (component[cell] != UNLABELLED)
+        {
+            levels[cell] = toLevel(sizes[component[cell]], largest);
+        }
+    }
+    return levels;
+}
+
+/**
+ * @brief Local free-area level of every cell
+ *
+ * A summed-area table gives the free cell count of any window in O(1). Cells
+ * outside the world count as blocked, so border cells score lower.
+ */
+std::vector<uint16_t> localAreaLevels(const std::vector<uint8_t> &degrees, uint16_t rows, uint16_t cols)
+{
+    constexpr int RADIUS = StartScoringWeights::LOCAL_AREA_RADIUS;
+    constexpr uint32_t WINDOW = (2 * RADIUS + 1) * (2 * RADIUS + 1);
+    const size_t stride = static_cast<size_t>(cols) + 1;
+
+    // table[(r + 1) × stride + (c + 1)] = free cells in rows [0, r] × cols [0, c]
+    std::vector<uint32_t> table(static_cast<size_t>(rows + 1) * stride, 0);
+    for (size_t row = 0; row < rows; row++)
+    {
+        uint32_t rowSum = 0;
+        for (size_t col = 0; col < cols; col++)
+        {
+            rowSum += isFree(degrees[(row * cols) + col]) ? 1 : 0;
+            table[((row + 1) * stride) + col + 1] = table[(row * stride) + col + 1] + rowSum;
+        }
+    }
+
+    std::vector<uint16_t> levels(degrees.size(), 0);
+    for (int row = 0; row < rows; row++)
+    {
+        const auto top = static_cast<size_t>(std::max(row - RADIUS, 0));
+        const auto bottom = static_cast<size_t>(std::min(row + RADIUS + 1, static_cast<int>(rows)));
+        for (int col = 0; col < cols; col++)
+        {
+            const size_t cell = (static_cast<size_t>(row) * cols) + col;
+            if (!isFree(degrees[cell]))
+            {
+                continue;
+            }
+            const auto left = static_cast<size_t>(std::max(col - RADIUS, 0));
+            const auto right = static_cast<size_t>(std::min(col + RADIUS + 1, static_cast<int>(cols)));
+            uint32_t free = table[(bottom * stride) + right] - table[(top * stride) + right] -
+                            table[(bottom * stride) + left] + table[(top * stride) + left];
+            levels[cell] = toLevel(free, WINDOW);
+        }
+    }
+    return levels;
+}
+
+/**
+ * @brief Dead-end distance level of every cell
+ *
+ * Multi-source BFS from every free cell of degree 0 or 1, stopped at
+ * distance LEVELS; cells farther away (or in components without dead ends)
+ * get the full level.
+ */
+std::vector<uint16_t> deadEndLevels(const std::vector<uint8_t> &degrees, uint16_t rows, uint16_t cols)
+{
+    std::vector<uint16_t> levels(degrees.size(), LEVELS);
+    std::vector<uint32_t> frontier;
+    for (uint32_t cell = 0; cell < degrees.size(); cell++)
+    {
+        if (degrees[cell] <= 1)
+        {
+            levels[cell] = 0;
+            frontier.push_back(cell);
+        }
+    }
+
+    std::vector<uint32_t> nextFrontier;
+    for (uint16_t distance = 1; distance < LEVELS && !frontier.empty(); distance++)
+    {
+        for (uint32_t cell : frontier)
+        {
+            forEachNeighbour(cell, rows, cols, [&](uint32_t neighbour) {
+                if (isFree(degrees[neighbour]) && levels[neighbour] > distance)
+                {
+                    levels[neighbour] = distance;
+                    nextFrontier.push_back(neighbour);
+                }
+            });
+        }
+        frontier.swap(nextFrontier);
+        nextFrontier.clear();
+    }
+    return levels;
+}
+} // namespace
+
+/**
+ * @brief Computes the weighted score of every cell
+ *
+ * The neighbour count and endpoint criteria are read straight from the
+ * degree array; the others get one scratch array of levels each, only when
+ * their weight is non-zero.
+ *
+ * @param matrixWorld World to score
+ * @param degrees Neighbour count per cell, values above FEATURE_LEVELS for blocked cells
+ * @param weights Criteria weights
+ * @return Score per cell, NO_START_SCORE for blocked cells
+ */
+std::vector<uint16_t> computeStartScores(const MatrixWorld &matrixWorld,
+                                         const std::vector<uint8_t> &degrees,
+                                         const StartScoringWeights &weights)
+{
+    const uint16_t rows = matrixWorld.getColSize();
+    const uint16_t cols = matrixWorld.getRowSize();
+
+    std::vector<uint16_t> scores(degrees.size(), NO_START_SCORE);
+    for (size_t cell = 0; cell < degrees.size(); cell++)
+    {
+        if (isFree(degrees[cell]))
+        {
+            scores[cell] = static_cast<uint16_t>((weights.degree * degrees[cell]) +
+                                                 (degrees[cell] == 1 ? weights.endpoint * LEVELS : 0));
+        }
+    }
+
+    auto addLevels = [&](uint8_t weight, const std::vector<uint16_t> &levels) {
+        for (size_t cell = 0; cell < scores.size(); cell++)
+        {
+            if (scores[cell] != NO_START_SCORE)
+            {
+                scores[cell] = static_cast<uint16_t>(scores[cell] + (weight * levels[cell]));
+            }
+        }
+    };
+
+    if (weights.componentSize != 0)
+    {
+        addLevels(weights.componentSize, componentLevels(degrees, rows, cols));
+    }
+    if (weights.localArea != 0)
+    {
+        addLevels(weights.localArea, localAreaLevels(degrees, rows, cols));
+    }
+    if (weights.deadEndDistance != 0)
+    {
+        addLevels(weights.deadEndDistance, deadEndLevels(degrees, rows, cols));
+    }
+    return scores;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file tree_diameter.cpp
+ * @brief Implementation of the spanning tree diameter stage
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "tree_diameter.hpp"
+#include "csr_graph.hpp"
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/// Marker for "no node" in parent and distance arrays
+static constexpr uint32_t NO_CELL = std::numeric_limits<uint32_t>::max();
+
+/**
+ * @brief Breadth-first pass over the tree edges of one component
+ * @param source Node to start from
+ * @param graph Adjacency graph of the free cells
+ * @param treeParent Spanning tree (parent of every node, root points to itself)
+ * @param distance Output tree distances (must be NO_CELL for the component)
+ * @param bfsParent Output predecessor of every reached node
+ * @return Node farthest from source within the tree
+ *
+ * Graph neighbours x and y are joined by a tree edge iff one is the parent of
+ * the other, so no explicit child lists are needed.
+ */
+static uint32_t farthestInTree(uint32_t source,
+                               const CsrGraph &graph,
+                               const std::vector<uint32_t> &treeParent,
+                               std::vector<uint32_t> &distance,
+                               std::vector<uint32_t> &bfsParent)
+{
+    const std::vector<uint32_t> &offsets = graph.getOffsets();
+    const std::vector<uint32_t> &adjacency = graph.getAdjacency();
+    std::vector<uint32_t> frontier{source};
+    distance[source] = 0;
+    bfsParent[source] = NO_CELL;
+    uint32_t farthest = source;
+
+    for (size_t head = 0; head < frontier.size(); head++)
+    {
+        uint32_t node = frontier[head];
+        farthest = node; // BFS order - the last dequeued node is the farthest
+        for (uint32_t edge = offsets[node]; edge < offsets[node + 1]; edge++)
+        {
+            uint32_t neighbour = adjacency[edge];
+            bool isTreeEdge = treeParent[neighbour] == node || treeParent[node] == neighbour;
+            if (isTreeEdge && distance[neighbour] == NO_CELL)
+            {
+                distance[neighbour] = distance[node] + 1;
+                bfsParent[neighbour] = node;
+                frontier.push_back(neighbour);
+            }
+        }
+    }
+    return farthest;
+}
+
+/**
+ * @brief Computes the longest spanning tree diameter over all components
+ *
+ * Runs on the world's shared CsrGraph, so repeated calls on an unchanged
+ * world (e.g. the diameter engine and the local search seed) build the
+ * adjacency once. For every component:
+ * 1. Iterative depth-first search builds the spanning tree (parent array)
+ * 2. Tree BFS from the root finds one end u of the diameter
+ * 3. Tree BFS from u finds the other end v; the BFS parents give the path
+ *
+ * @param matrixWorld Reference to the matrix world
+ * @return Longest diameter path found (empty if no free cell exists)
+ */
+Path TreeDiameterAlgorithm::computeDiameterPath(const MatrixWorld &matrixWorld)
+{
+    const std::shared_ptr<const CsrGraph> graph = CsrGraph::getShared(matrixWorld);
+    const std::vector<uint32_t> &offsets = graph->getOffsets();
+    const std::vector<uint32_t> &adjacency = graph->getAdjacency();
+    const uint32_t nodeCount = graph->getNodeCount();
+
+    std::vector<uint32_t> treeParent(nodeCount, NO_CELL);
+    std::vector<uint32_t> distance(nodeCount, NO_CELL);
+    std::vector<uint32_t> bfsParent(nodeCount, NO_CELL);
+    std::vector<uint32_t> component;
+    std::vector<std::pair<uint32_t, uint32_t>> stack; // Node and its next adjacency entry
+
+    Path best;
+    // Row-major nodes: roots are visited in scan order
+    for (uint32_t root = 0; root < nodeCount; root++)
+    {
+        if (treeParent[root] != NO_CELL)
+        {
+            continue;
+        }
+
+        // 1. Depth-first spanning tree of the component
+        component.clear();
+        component.push_back(root);
+        treeParent[root] = root;
+        stack.emplace_back(root, offsets[root]);
+        while (!stack.empty())
+        {
+            auto [node, edge] = stack.back();
+            if (edge == offsets[node + 1])
+            {
+                stack.pop_back();
+                continue;
+            }
+            stack.back().second++;
+
+            uint32_t neighbour = adjacency[edge];
+            if (treeParent[neighbour] == NO_CELL)
+            {
+                treeParent[neighbour] = node;
+                component.push_back(neighbour);
+                stack.emplace_back(neighbour, offsets[neighbour]);
+            }
+        }
+
+        if (component.size() <= best.getLength())
+        {
+            continue; // Diameter cannot beat the best one found so far
+        }
+
+        // 2. and 3. Two tree BFS passes
+        uint32_t firstEnd = farthestInTree(root, *graph, treeParent, distance, bfsParent);
+        for (uint32_t node : component)
+        {
+            distance[node] = NO_CELL;
+        }
+        uint32_t secondEnd = farthestInTree(firstEnd, *graph, treeParent, distance, bfsParent);
+
+        if (distance[secondEnd] + 1 > best.getLength())
+        {
+            best.clear();
+            for (uint32_t node = secondEnd; node != NO_CELL; node = bfsParent[node])
+            {
+                const auto [row, col] = graph->getCell(node);
+                best.addCoordinate(row, col);
+            }
+        }
+        for (uint32_t node : component)
+        {
+            distance[node] = NO_CELL;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Answers the request from the tree diameter
+ * @param matrixWorld Reference to the matrix world
+ * @param pathLength Target path length
+ * @param maxStartingPoints Unused
+ * @return Prefix of the diameter path, or empty path if the diameter is too short
+ * @throws std::invalid_argument If pathLength is zero or exceeds matrix size
+ */
+Path TreeDiameterAlgorithm::findViablePath(const MatrixWorld &matrixWorld,
+                                           PathLength pathLength,
+                                           MaxStartingPoints maxStartingPoints)
+{
+    (void)maxStartingPoints;
+
+    if (pathLength.value == 0)
+    {
+        throw std::invalid_argument("Path length must be greater than zero");
+    }
+
+    if (pathLength.value > matrixWorld.getTotalCells())
+    {
+        throw std::invalid_argument("Path length exceeds matrix size");
+    }
+
+    Path diameter = computeDiameterPath(matrixWorld);
+    if (diameter.getLength() < pathLength.value)
+    {
+        return {};
+    }
+
+    Path result;
+    for (const auto &[row, col] : diameter)
+    {
+        if (result.getLength() == pathLength.value)
+        {
+            break;
+        }
+        result.addCoordinate(row, col);
+    }
+    return result;
+}
@@ -0,0 +1,291 @@
+/**
+ * @file world_image_loader.cpp
+ * @brief Implementation of the PBM/PGM world loaders
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "world_image_loader.hpp"
+#include "mapped_file.hpp"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Table of every byte with its bit order reversed
+ */
+constexpr std::array<uint8_t, 256> makeReversedBytes()
+{
+    std::array<uint8_t, 256> table{};
+    for (unsigned byte = 0; byte < 256; byte++)
+    {
+        unsigned reversed = 0;
+        for (unsigned bit = 0; bit < 8; bit++)
+        {
+            reversed |= ((byte >> bit) & 1U) << (7 - bit);
+        }
+        table[byte] = static_cast<uint8_t>(reversed);
+    }
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> REVERSED_BYTES = makeReversedBytes();
+} // namespace
+
+/**
+ * @brief Parses the header of a binary PBM or PGM image
+ *
+ * Header fields are decimal numbers separated by whitespace, with # comments
+ * running to the end of the line; exactly one whitespace character separates
+ * the last field from the raster. That separator must be present, so a
+ * prefix ending inside the header is always rejected.
+ *
+ * @param image Image contents or a prefix holding the whole header
+ * @return Parsed header
+ * @throws std::invalid_argument If the header is malformed or unsupported
+ */
+ImageHeader parseImageHeader(std::string_view image)
+{
+    if (image.size() < 2 || image[0] != 'P' || (image[1] != '4' && image[1] != '5'))
+    {
+        throw std::invalid_argument("Unsupported image format (expected binary PBM P4 or PGM P5)");
+    }
+
+    ImageHeader header;
+    header.format = image[1];
+    uint32_t width = 0;
+    uint32_t height = 0;
+    size_t position = 2;
+    auto readField = [&](uint32_t &value) {
+        while (position < image.size())
+        {
+            char current = image[position];
+            if (current == '#')
+            {
+                size_t newline = image.find('\n', position);
+                position = newline == std::string_view::npos ? image.size() : newline + 1;
+            }
+            else if (current == ' ' || current == '\t' || current == '\n' || current == '\r' || current == '\v' ||
+                     current == '\f')
+            {
+                position++;
+            }
+            else
+            {
+                break;
+            }
+        }
+        auto [end, error] = std::from_chars(image.data() + position, image.data() + image.size(), value);
+        if (error != std::errc{})
+        {
+            throw std::invalid_argument("Malformed image header");
+        }
+        position = static_cast<size_t>(end - image.data());
+    };
+
+    readField(width);
+    readField(height);
+    if (header.format == '5')
+    {
+        readField(header.maxValue);
+        if (header.maxValue == 0 || header.maxValue > 65535)
+        {
+            throw std::invalid_argument("Image maximum grey value must be 1-65535");
+        }
+    }
+    if (position >= image.size())
+    {
+        throw std::invalid_argument("Truncated image data");
+    }
+    // Exactly one whitespace byte separates the header from the raster
+    if (std::isspace(static_cast<unsigned char>(image[position])) == 0)
+    {
+        throw std::invalid_argument("Malformed image header");
+    }
+    header.dataOffset = position + 1;
+
+    if (width == 0 || height == 0 || width > UINT16_MAX || height > UINT16_MAX)
+    {
+        throw std::invalid_argument("Image width and height must be 1-65535");
+    }
+    header.width = static_cast<uint16_t>(width);
+    header.height = static_cast<uint16_t>(height);
+    return header;
+}
+
+/**
+ * @brief Packs one PBM row into world row words
+ *
+ * Eight PBM bytes make one world word: each byte is bit-reversed through a
+ * table (PBM stores the leftmost pixel in the most significant bit) and
+ * shifted into place.
+ *
+ * @param bytes Packed PBM row
+ * @param cols Pixels in the row
+ * @param words Output row words
+ */
+void packPbmRow(const uint8_t *bytes, uint16_t cols, uint64_t *words)
+{
+    const size_t byteCount = (static_cast<size_t>(cols) + 7) / 8;
+    const size_t wordCount = (static_cast<size_t>(cols) + 63) / 64;
+    for (size_t word = 0; word < wordCount; word++)
+    {
+        uint64_t bits = 0;
+        const size_t last = std::min(byteCount, (word + 1) * 8);
+        for (size_t byte = word * 8; byte < last; byte++)
+        {
+            bits |= uint64_t{REVERSED_BYTES[bytes[byte]]} << ((byte % 8) * 8);
+        }
+        words[word] = bits;
+    }
+}
+
+/**
+ * @brief Thresholds one 8-bit PGM row into world row words
+ *
+ * With SSE2, 16 pixels are compared per instruction: unsigned bytes are
+ * compared as signed after flipping their top bit, and movemask gathers the
+ * 16 results into bits. The remaining pixels are compared one by one.
+ *
+ * @param pixels Grey values
+ * @param cols Pixels in the row
+ * @param cutoff Pixels below cutoff are set
+ * @param words Output row words
+ */
+void packPgmRow(const uint8_t *pixels, uint16_t cols, uint16_t cutoff, uint64_t *words)
+{
+    const size_t wordCount = (static_cast<size_t>(cols) + 63) / 64;
+#if defined(__SSE2__)
+    const bool vectorized = cutoff >= 1 && cutoff <= 255;
+    const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80));
+    const __m128i limit = _mm_set1_epi8(static_cast<char>((cutoff & 0xFF) ^ 0x80));
+#endif
+    for (size_t word = 0; word < wordCount; word++)
+    {
+        const size_t first = word * 64;
+        const size_t last = std::min<size_t>(cols, first + 64);
+        uint64_t bits = 0;
+        size_t col = first;
+#if defined(__SSE2__)
+        for (; vectorized && col + 16 <= last; col += 16)
+        {
+            __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels + col));
+            __m128i below = _mm_cmplt_epi8(_mm_xor_si128(values, bias), limit);
+            bits |= uint64_t{static_cast<uint16_t>(_mm_movemask_epi8(below))} << (col - first);
+        }
+#endif
+        for (; col < last; col++)
+        {
+            bits |= uint64_t{pixels[col] < cutoff} << (col - first);
+        }
+        words[word] = bits;
+    }
+}
+
+/**
+ * @brief Grey value below which a PGM pixel is blocked
+ * @param header Image header
+ * @param occupiedThreshold Occupancy above which a pixel is blocked
+ * @return ceil(maxval × (1 - occupiedThreshold))
+ * @throws std::invalid_argument If the threshold is not between 0 and 1
+ */
+uint32_t occupancyCutoff(const ImageHeader &header, double occupiedThreshold)
+{
+    if (!(occupiedThreshold >= 0.0 && occupiedThreshold <= 1.0))
+    {
+        throw std::invalid_argument("Occupied threshold must be between 0 and 1");
+    }
+    return static_cast<uint32_t>(std::ceil(header.maxValue * (1.0 - occupiedThreshold)));
+}
+
+/**
+ * @brief Decodes one raster row into world row words
+ *
+ * PBM rows and 8-bit PGM rows go through packPbmRow() and packPgmRow();
+ * 16-bit PGM samples are big-endian and thresholded one by one.
+ *
+ * @param header Image header
+ * @param row Raster row
+ * @param cutoff PGM grey value below which a pixel is blocked
+ * @param words Output row words
+ */
+void packImageRow(const ImageHeader &header, const uint8_t *row, uint32_t cutoff, uint64_t *words)
+{
+    if (header.format == '4')
+    {
+        packPbmRow(row, header.width, words);
+    }
+    else if (header.maxValue <= 255)
+    {
+        packPgmRow(row, header.width, static_cast<uint16_t>(cutoff), words);
+    }
+    else
+    {
+        std::fill(words, words + ((static_cast<size_t>(header.width) + 63) / 64), 0);
+        for (size_t col = 0; col < header.width; col++)
+        {
+            const uint32_t value = (uint32_t{row[2 * col]} << 8) | row[(2 * col) + 1];
+            words[col / 64] |= uint64_t{value < cutoff} << (col % 64);
+        }
+    }
+}
+
+/**
+ * @brief Decodes a binary PBM (P4) or PGM (P5) image into a world
+ *
+ * Rows are packed into a bitmap in the world's layout and merged with one
+ * matrixBlankingMask() call. A pixel is blocked when its grey value is below
+ * occupancyCutoff().
+ *
+ * @param image Image file contents
+ * @param occupiedThreshold PGM occupancy above which a pixel is blocked
+ * @return Decoded world
+ * @throws std::invalid_argument If the data is not a supported image
+ */
+MatrixWorld loadWorldImage(std::string_view image, double occupiedThreshold)
+{
+    const ImageHeader header = parseImageHeader(image);
+    const uint32_t cutoff = occupancyCutoff(header, occupiedThreshold);
+    const size_t rowBytes = header.getRowBytes();
+    if (image.size() - header.dataOffset < rowBytes * header.height)
+    {
+        throw std::invalid_argument("Truncated image data");
+    }
+
+    MatrixWorld world(header.height, header.width);
+    const size_t words = world.getWordsPerRow();
+    std::vector<uint64_t> mask(header.height * words);
+    const auto *raster = reinterpret_cast<const uint8_t *>(image.data() + header.dataOffset);
+    for (size_t row = 0; row < header.height; row++)
+    {
+        packImageRow(header, raster + (row * rowBytes), cutoff, mask.data() + (row * words));
+    }
+
+    world.matrixBlankingMask(mask);
+    return world;
+}
+
+/**
+ * @brief Loads a binary PBM (P4) or PGM (P5) image file into a world
+ * @param filePath Path of the image file
+ * @param occupiedThreshold PGM occupancy above which a pixel is blocked
+ * @return Decoded world
+ * @throws std::runtime_error If the file cannot be opened or mapped
+ * @throws std::invalid_argument If the file is not a supported image
+ */
+MatrixWorld loadWorldImageFile(const std::string &filePath, double occupiedThreshold)
+{
+    MappedFile file(filePath);
+    return loadWorldImage(file.getText(), occupiedThreshold);
+}
@@ -0,0 +1,427 @@
+/**
+ * @file world_pipeline.cpp
+ * @brief Implementation of the pipelined world loader
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "world_pipeline.hpp"
+#include "blocked_cells_loader.hpp"
+#include "bounded_queue.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace
+{
+/// Most rows scored in one go, so abandoning the scores waits for little work
+constexpr uint16_t SCORE_BAND_ROWS = 64;
+
+/**
+ * @struct ParsedBatch
+ * @brief Cells or packed rows parsed from the input, handed to the builder
+ */
+struct ParsedBatch
+{
+    std::vector<std::pair<uint16_t, uint16_t>> cells; ///< Blocked cells (cells streams)
+    std::vector<uint64_t> rowWords;                    ///< Packed rows from firstRow on (rows streams)
+    uint16_t firstRow = UINT16_MAX;                    ///< Lowest row touched
+    uint16_t lastRow = 0;                              ///< Highest row touched
+    size_t items = 0;                                  ///< Cell lines or rows in the batch
+};
+
+/**
+ * @brief Stage 1: reads chunks until end of input or until the parser stops taking them
+ * @return Number of chunks read
+ * @throws std::runtime_error If read() fails
+ */
+size_t readChunks(int inputFd, size_t chunkBytes, BoundedQueue<std::vector<char>> &chunks)
+{
+    size_t chunkCount = 0;
+    while (true)
+    {
+        std::vector<char> chunk(chunkBytes);
+        ssize_t received = 0;
+        do
+        {
+            received = ::read(inputFd, chunk.data(), chunk.size());
+        } while (received < 0 && errno == EINTR);
+        if (received < 0)
+        {
+            throw std::runtime_error(std::string("Can not read input stream: ") + std::strerror(errno));
+        }
+        if (received == 0)
+        {
+            return chunkCount;
+        }
+        chunk.resize(static_cast<size_t>(received));
+        if (!chunks.push(std::move(chunk)))
+        {
+            return chunkCount;
+        }
+        chunkCount++;
+    }
+}
+
+/**
+ * @brief Stage 2 for cells streams: one batch per chunk of complete lines
+ * @throws std::invalid_argument If a line is malformed or outside the world
+ */
+void parseCells(BoundedQueue<std::vector<char>> &chunks, BoundedQueue<ParsedBatch> &batches, uint16_t rows,
+                uint16_t cols)
+{
+    std::string pending;
+    std::vector<char> chunk;
+    size_t lineNumber = 0;
+    bool more = true;
+    while (more)
+    {
+        more = chunks.pop(chunk);
+        if (more)
+        {
+            pending.append(chunk.data(), chunk.size());
+        }
+
+        ParsedBatch batch;
+        size_t consumed = 0;
+        while (consumed < pending.size())
+        {
+            size_t newline = pending.find('\n', consumed);
+            if (newline == std::string::npos && more)
+            {
+                break; // Completed by a later chunk
+            }
+            size_t lineEnd = newline == std::string::npos ? pending.size() : newline;
+            lineNumber++;
+
+            uint32_t row = 0;
+            uint32_t col = 0;
+            const CellLine parsed = parseBlockedCellLine(pending.data() + consumed, pending.data() + lineEnd, row, col);
+            if (parsed != CellLine::Skipped)
+            {
+                if (parsed == CellLine::Malformed || row >= rows || col >= cols)
+                {
+                    if (!batch.cells.empty())
+                    {
+                        batch.items = batch.cells.size();
+                        batches.push(std::move(batch)); // Cells before the bad line are still applied
+                    }
+                    throw std::invalid_argument(std::string(parsed == CellLine::Cell ? "Blocked cell outside the matrix"
+                                                                                     : "Invalid blocked cell format") +
+                                                " at line " + std::to_string(lineNumber));
+                }
+                batch.cells.emplace_back(static_cast<uint16_t>(row), static_cast<uint16_t>(col));
+                batch.firstRow = std::min(batch.firstRow, static_cast<uint16_t>(row));
+                batch.lastRow = std::max(batch.lastRow, static_cast<uint16_t>(row));
+            }
+            consumed = lineEnd + 1;
+        }
+        pending.erase(0, std::min(consumed, pending.size()));
+
+        batch.items = batch.cells.size();
+        if (batch.items != 0 && !batches.push(std::move(batch)))
+        {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Stage 2 for rows streams: one batch per chunk of complete rows
+ * @throws std::invalid_argument If the stream holds too many rows or ends inside one
+ */
+void parseRows(BoundedQueue<std::vector<char>> &chunks, BoundedQueue<ParsedBatch> &batches, uint16_t rows,
+               size_t words)
+{
+    const size_t rowBytes = words * sizeof(uint64_t);
+    std::string pending;
+    std::vector<char> chunk;
+    size_t row = 0;
+    while (chunks.pop(chunk))
+    {
+        pending.append(chunk.data(), chunk.size());
+        const size_t rowCount = pending.size() / rowBytes;
+        if (row + rowCount > rows)
+        {
+            throw std::invalid_argument("Stream holds more rows than the matrix (" + std::to_string(rows) + ")");
+        }
+        if (rowCount == 0)
+        {
+            continue;
+        }
+
+        ParsedBatch batch;
+        batch.rowWords.resize(rowCount * words);
+        std::memcpy(batch.rowWords.data(), pending.data(), rowCount * rowBytes);
+        if constexpr (std::endian::native == std::endian::big)
+        {
+            for (uint64_t &word : batch.rowWords)
+            {
+                word = __builtin_bswap64(word);
+            }
+        }
+        batch.firstRow = static_cast<uint16_t>(row);
+        batch.lastRow = static_cast<uint16_t>(row + rowCount - 1);
+        batch.items = rowCount;
+        pending.erase(0, rowCount * rowBytes);
+        row += rowCount;
+        if (!batches.push(std::move(batch)))
+        {
+            return;
+        }
+    }
+    if (!pending.empty())
+    {
+        throw std::invalid_argument("Stream ends inside row " + std::to_string(row));
+    }
+}
+
+/**
+ * @class OverlappedScoring
+ * @brief Stage 4: scores final rows on its own thread while the builder goes on
+ *
+ * The builder announces how many leading rows may be scored; announcements
+ * are dropped while the queue is full, since a later one supersedes them.
+ */
+class OverlappedScoring
+{
+    const MatrixWorld &matrixWorld;
+    DegreeScores scores;
+    BoundedQueue<uint16_t> limits;
+    std::atomic<bool> abandoned{false};
+    uint16_t announced = 0;
+    std::thread scorer;
+
+public:
+    OverlappedScoring(const MatrixWorld &matrixWorld, size_t queueDepth)
+        : matrixWorld(matrixWorld), scores(matrixWorld), limits(queueDepth)
+    {
+        scorer = std::thread([this] {
+            try
+            {
+                uint16_t limit = 0;
+                while (limits.pop(limit))
+                {
+                    while (scores.getScoredRows() < limit && !abandoned.load(std::memory_order_relaxed))
+                    {
+                        const auto next = static_cast<uint16_t>(
+                            std::min<size_t>(limit, static_cast<size_t>(scores.getScoredRows()) + SCORE_BAND_ROWS));
+                        scores.scoreRows(this->matrixWorld, next);
+                    }
+                }
+            }
+            catch (...)
+            {
+                // The first query builds its ranking instead. Closing the
+                // queue keeps the builder from blocking on a full one
+                abandoned = true;
+                limits.close();
+            }
+        });
+    }
+
+    OverlappedScoring(const OverlappedScoring &) = delete;
+    OverlappedScoring &operator=(const OverlappedScoring &) = delete;
+
+    ~OverlappedScoring()
+    {
+        abandon();
+    }
+
+    /** @brief Whether rows are still being scored */
+    [[nodiscard]] bool isActive() const { return scorer.joinable(); }
+
+    /**
+     * @brief Lets the scorer go up to the given row (exclusive)
+     */
+    void announce(uint16_t limit)
+    {
+        if (limit > announced && limits.tryPush(limit))
+        {
+            announced = limit;
+        }
+    }
+
+    /**
+     * @brief Stops scoring and waits for the scorer to leave the world alone
+     */
+    void abandon()
+    {
+        if (scorer.joinable())
+        {
+            abandoned = true;
+            limits.close();
+            scorer.join();
+        }
+    }
+
+    /**
+     * @brief Scores the remaining rows of the finished world
+     * @return Complete scores, or nothing if they were abandoned
+     */
+    [[nodiscard]] std::optional<DegreeScores> finish()
+    {
+        if (!scorer.joinable())
+        {
+            return std::nullopt;
+        }
+        if (!abandoned)
+        {
+            limits.push(matrixWorld.getColSize()); // Returns at once if the scorer closed the queue
+        }
+        limits.close();
+        scorer.join();
+        if (abandoned || !scores.isComplete())
+        {
+            return std::nullopt;
+        }
+        return std::move(scores);
+    }
+};
+} // namespace
+
+/**
+ * @brief Blocks the cells of a cells or rows stream with the stages of the load overlapped
+ *
+ * The builder tracks how many leading rows are final: everything before the
+ * last row of a rows batch, and for cells before the lowest row still to
+ * come - the highest row of the latest batch, as long as batches do not go
+ * back. Rows up to one before that are announced to the scorer, since a
+ * row's score also reads the row below. Rows at or past the final ones are
+ * the only rows the builder writes, so scoring and building never touch the
+ * same words.
+ *
+ * @param inputFd Readable file descriptor
+ * @param matrixWorld World to block the cells in
+ * @param format StreamFormat::Cells or StreamFormat::Rows
+ * @param options Chunk size, queue depth and the ranking to seed
+ * @return Items and chunks read, and the seeded ranking
+ * @throws std::runtime_error If reading fails
+ * @throws std::invalid_argument If the stream is malformed
+ */
+PipelineResult loadWorldPipelined(int inputFd, MatrixWorld &matrixWorld, StreamFormat format,
+                                  const PipelineOptions &options)
+{
+    if (format == StreamFormat::Image)
+    {
+        throw std::invalid_argument("Image streams create their own world, use streamWorldImage()");
+    }
+
+    const uint16_t rows = matrixWorld.getColSize();
+    const uint16_t cols = matrixWorld.getRowSize();
+    const size_t words = matrixWorld.getWordsPerRow();
+
+    PipelineResult result;
+    BoundedQueue<std::vector<char>> chunks(options.queueDepth);
+    BoundedQueue<ParsedBatch> batches(options.queueDepth);
+    std::exception_ptr readerError;
+    std::exception_ptr parserError;
+
+    std::thread reader([&] {
+        try
+        {
+            result.chunks = readChunks(inputFd, std::max<size_t>(options.chunkBytes, 1), chunks);
+        }
+        catch (...)
+        {
+            readerError = std::current_exception();
+        }
+        chunks.close();
+    });
+    std::thread parser([&] {
+        try
+        {
+            if (format == StreamFormat::Cells)
+            {
+                parseCells(chunks, batches, rows, cols);
+            }
+            else
+            {
+                parseRows(chunks, batches, rows, words);
+            }
+        }
+        catch (...)
+        {
+            parserError = std::current_exception();
+        }
+        chunks.close();
+        batches.close();
+    });
+
+    // Stage 3 on the calling thread; stops the other stages on the way out
+    OverlappedScoring scoring(matrixWorld, options.queueDepth);
+    std::exception_ptr builderError;
+    try
+    {
+        std::vector<uint64_t> staging(format == StreamFormat::Cells ? static_cast<size_t>(rows) * words : 0, 0);
+        size_t finalRows = 0;
+        ParsedBatch batch;
+        while (batches.pop(batch))
+        {
+            if (batch.firstRow < finalRows && scoring.isActive())
+            {
+                scoring.abandon(); // Unsorted cells: scored rows may change
+            }
+
+            if (format == StreamFormat::Cells)
+            {
+                for (auto [row, col] : batch.cells)
+                {
+                    staging[(row * words) + (col / 64)] |= uint64_t{1} << (col % 64);
+                }
+                uint64_t *band = staging.data() + (batch.firstRow * words);
+                const size_t rowCount = static_cast<size_t>(batch.lastRow - batch.firstRow) + 1;
+                matrixWorld.matrixBlankingRows(batch.firstRow, band, rowCount);
+                std::fill(band, band + (rowCount * words), 0);
+                finalRows = std::max<size_t>(finalRows, batch.lastRow);
+            }
+            else
+            {
+                matrixWorld.matrixBlankingRows(batch.firstRow, batch.rowWords.data(),
+                                               static_cast<size_t>(batch.lastRow - batch.firstRow) + 1);
+                finalRows = static_cast<size_t>(batch.lastRow) + 1;
+            }
+            result.items += batch.items;
+
+            if (finalRows > 0 && scoring.isActive())
+            {
+                scoring.announce(static_cast<uint16_t>(finalRows - 1));
+            }
+        }
+    }
+    catch (...)
+    {
+        builderError = std::current_exception();
+        batches.close();
+        chunks.close();
+    }
+
+    parser.join();
+    reader.join();
+    for (const std::exception_ptr &error : {builderError, readerError, parserError})
+    {
+        if (error)
+        {
+            scoring.abandon();
+            std::rethrow_exception(error);
+        }
+    }
+
+    if (std::optional<DegreeScores> scores = scoring.finish())
+    {
+        result.ranking =
+            CandidateRanking::getPrescored(matrixWorld, std::move(*scores), options.weights, options.pruning);
+    }
+    return result;
+}
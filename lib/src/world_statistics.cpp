@@ -0,0 +1,136 @@
+/**
+ * @file world_statistics.cpp
+ * @brief Implementation of world statistics collection
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "world_statistics.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <vector>
+
+/**
+ * @brief Computes structural statistics of the given world
+ *
+ * Scans the matrix row by row, classifying every free cell by its degree, and
+ * flood fills each not yet labelled free cell to measure component sizes.
+ * The flood fill uses an explicit stack so very large components cannot
+ * overflow the call stack.
+ *
+ * @param matrixWorld World to analyze
+ * @return Filled WorldStatistics structure
+ */
+WorldStatistics computeWorldStatistics(const MatrixWorld &matrixWorld)
+{
+    WorldStatistics stats;
+    const uint16_t rows = matrixWorld.getColSize();
+    const uint16_t cols = matrixWorld.getRowSize();
+
+    std::vector<bool> labelled(matrixWorld.getTotalCells(), false);
+    std::vector<uint32_t> stack;
+
+    // 4-directional offsets: up, right, down, left
+    std::array<std::array<int, 2>, 4> directions = {{{-1, 0}, {0, 1}, {1, 0}, {0, -1}}};
+
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (uint16_t col = 0; col < cols; col++)
+        {
+            if (!matrixWorld.isUnblocked(row, col))
+            {
+                stats.blockedCells++;
+                continue;
+            }
+
+            stats.freeCells++;
+            uint16_t degree = matrixWorld.countUnblockedNeighbors(row, col);
+            if (degree <= 1)
+            {
+                stats.deadEndCells++;
+            }
+            else if (degree == 2)
+            {
+                stats.corridorCells++;
+            }
+            else
+            {
+                stats.junctionCells++;
+            }
+
+            uint32_t index = (static_cast<uint32_t>(row) * cols) + col;
+            if (labelled[index])
+            {
+                continue;
+            }
+
+            // New component found - flood fill it
+            stats.componentCount++;
+            uint32_t componentSize = 0;
+            labelled[index] = true;
+            stack.push_back(index);
+            while (!stack.empty())
+            {
+                uint32_t current = stack.back();
+                stack.pop_back();
+                componentSize++;
+
+                int currentRow = static_cast<int>(current / cols);
+                int currentCol = static_cast<int>(current % cols);
+                for (auto &direction : directions)
+                {
+                    int newRow = currentRow + direction[0];
+                    int newCol = currentCol + direction[1];
+                    if (newRow < 0 || newRow >= static_cast<int>(rows) || newCol < 0 ||
+                        newCol >= static_cast<int>(cols))
+                    {
+                        continue;
+                    }
+                    uint32_t neighbour = (static_cast<uint32_t>(newRow) * cols) + static_cast<uint32_t>(newCol);
+                    if (!labelled[neighbour] &&
+                        matrixWorld.isUnblocked(static_cast<uint16_t>(newRow), static_cast<uint16_t>(newCol)))
+                    {
+                        labelled[neighbour] = true;
+                        stack.push_back(neighbour);
+                    }
+                }
+            }
+            stats.largestComponentSize = std::max(stats.largestComponentSize, componentSize);
+        }
+    }
+
+    if (stats.freeCells != 0 && stats.blockedCells != 0)
+    {
+        stats.blockedRatio = static_cast<double>(stats.blockedCells) / stats.freeCells;
+    }
+
+    return stats;
+}
+
+/**
+ * @brief Counts the blocked cells of the given world exactly
+ *
+ * Padding bits past the last column are always set, so each row contributes
+ * its popcount minus the padding width.
+ *
+ * @param matrixWorld World to count
+ * @return Blocked cells
+ */
+size_t countBlockedCells(const MatrixWorld &matrixWorld)
+{
+    const size_t words = matrixWorld.getWordsPerRow();
+    const size_t paddingBits = (words * 64) - matrixWorld.getRowSize();
+    size_t blocked = 0;
+    for (uint16_t row = 0; row < matrixWorld.getColSize(); row++)
+    {
+        const uint64_t *rowWords = matrixWorld.getRowWords(row);
+        for (size_t word = 0; word < words; word++)
+        {
+            blocked += static_cast<size_t>(std::popcount(rowWords[word]));
+        }
+        blocked -= paddingBits;
+    }
+    return blocked;
+}
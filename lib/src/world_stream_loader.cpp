@@ -0,0 +1,344 @@
+/**
+ * @file world_stream_loader.cpp
+ * @brief Implementation of the incremental stream loaders
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "world_stream_loader.hpp"
+#include "blocked_cells_loader.hpp"
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+/// Bytes requested per read()
+constexpr size_t READ_BYTES = size_t{64} << 10;
+
+/// Longest image header waited for before giving up
+constexpr size_t MAX_HEADER_BYTES = size_t{64} << 10;
+
+/**
+ * @class StreamBuffer
+ * @brief Growable read buffer over a file descriptor
+ *
+ * Unconsumed bytes are moved to the front before each read, so a line or
+ * row split across reads is completed in place.
+ */
+class StreamBuffer
+{
+    int fd;
+    std::vector<char> buffer;
+    size_t begin = 0;
+    size_t end = 0;
+
+public:
+    explicit StreamBuffer(int fd) : fd(fd), buffer(READ_BYTES) {}
+
+    /**
+     * @brief Reads whatever the producer has written so far (blocking until some data or EOF)
+     * @return false at end of stream
+     * @throws std::runtime_error If read() fails
+     */
+    bool fill()
+    {
+        if (begin != 0)
+        {
+            std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+            end -= begin;
+            begin = 0;
+        }
+        if (buffer.size() - end < READ_BYTES / 2)
+        {
+            buffer.resize(buffer.size() * 2);
+        }
+
+        ssize_t received = 0;
+        do
+        {
+            received = ::read(fd, buffer.data() + end, buffer.size() - end);
+        } while (received < 0 && errno == EINTR);
+        if (received < 0)
+        {
+            throw std::runtime_error(std::string("Can not read input stream: ") + std::strerror(errno));
+        }
+        end += static_cast<size_t>(received);
+        return received != 0;
+    }
+
+    [[nodiscard]] std::string_view pending() const
+    {
+        return {buffer.data() + begin, end - begin};
+    }
+
+    void consume(size_t bytes)
+    {
+        begin += bytes;
+    }
+};
+
+/**
+ * @class RowBand
+ * @brief Staging bitmap of the rows touched by one batch
+ */
+class RowBand
+{
+    MatrixWorld &matrixWorld;
+    std::vector<uint64_t> mask;
+    size_t words;
+    uint16_t firstRow = UINT16_MAX;
+    uint16_t lastRow = 0;
+
+public:
+    explicit RowBand(MatrixWorld &matrixWorld)
+        : matrixWorld(matrixWorld), mask(matrixWorld.getColSize() * matrixWorld.getWordsPerRow(), 0),
+          words(matrixWorld.getWordsPerRow())
+    {
+    }
+
+    void block(uint16_t row, uint16_t col)
+    {
+        mask[(row * words) + (col / 64)] |= uint64_t{1} << (col % 64);
+        firstRow = std::min(firstRow, row);
+        lastRow = std::max(lastRow, row);
+    }
+
+    /**
+     * @brief Applies the touched rows to the world and clears them
+     */
+    void flush()
+    {
+        if (firstRow > lastRow)
+        {
+            return;
+        }
+        uint64_t *band = mask.data() + (firstRow * words);
+        const size_t rowCount = static_cast<size_t>(lastRow - firstRow) + 1;
+        matrixWorld.matrixBlankingRows(firstRow, band, rowCount);
+        std::fill(band, band + (rowCount * words), 0);
+        firstRow = UINT16_MAX;
+        lastRow = 0;
+    }
+};
+
+/**
+ * @brief Streams a blocked cells text
+ */
+size_t streamCells(StreamBuffer &input, MatrixWorld &matrixWorld)
+{
+    const uint16_t rows = matrixWorld.getColSize();
+    const uint16_t cols = matrixWorld.getRowSize();
+    RowBand band(matrixWorld);
+    size_t cells = 0;
+    size_t lineNumber = 0;
+    bool more = true;
+    while (more)
+    {
+        more = input.fill();
+        std::string_view text = input.pending();
+        size_t consumed = 0;
+        while (consumed < text.size())
+        {
+            size_t newline = text.find('\n', consumed);
+            if (newline == std::string_view::npos && more)
+            {
+                break; // Completed by a later read
+            }
+            size_t lineEnd = newline == std::string_view::npos ? text.size() : newline;
+            lineNumber++;
+
+            uint32_t row = 0;
+            uint32_t col = 0;
+            const CellLine parsed = parseBlockedCellLine(text.data() + consumed, text.data() + lineEnd, row, col);
+            if (parsed != CellLine::Skipped)
+            {
+                if (parsed == CellLine::Malformed || row >= rows || col >= cols)
+                {
+                    band.flush();
+                    throw std::invalid_argument(std::string(parsed == CellLine::Cell ? "Blocked cell outside the matrix"
+                                                                                     : "Invalid blocked cell format") +
+                                                " at line " + std::to_string(lineNumber));
+                }
+                band.block(static_cast<uint16_t>(row), static_cast<uint16_t>(col));
+                cells++;
+            }
+            consumed = lineEnd + 1;
+        }
+        input.consume(std::min(consumed, text.size()));
+        band.flush();
+    }
+    return cells;
+}
+
+/**
+ * @brief Streams packed row words
+ */
+size_t streamRows(StreamBuffer &input, MatrixWorld &matrixWorld)
+{
+    const size_t words = matrixWorld.getWordsPerRow();
+    const size_t rowBytes = words * sizeof(uint64_t);
+    std::vector<uint64_t> band;
+    size_t row = 0;
+    bool more = true;
+    while (more)
+    {
+        more = input.fill();
+        std::string_view data = input.pending();
+        const size_t rowCount = data.size() / rowBytes;
+        if (row + rowCount > matrixWorld.getColSize())
+        {
+            throw std::invalid_argument("Stream holds more rows than the matrix (" +
+                                        std::to_string(matrixWorld.getColSize()) + ")");
+        }
+        if (rowCount != 0)
+        {
+            band.resize(rowCount * words);
+            std::memcpy(band.data(), data.data(), rowCount * rowBytes);
+            if constexpr (std::endian::native == std::endian::big)
+            {
+                for (uint64_t &word : band)
+                {
+                    word = __builtin_bswap64(word);
+                }
+            }
+            matrixWorld.matrixBlankingRows(static_cast<uint16_t>(row), band.data(), rowCount);
+            input.consume(rowCount * rowBytes);
+            row += rowCount;
+        }
+    }
+    if (!input.pending().empty())
+    {
+        throw std::invalid_argument("Stream ends inside row " + std::to_string(row));
+    }
+    return row;
+}
+} // namespace
+
+/**
+ * @brief Parses a stream format name
+ * @param name Format name
+ * @return Matching format
+ * @throws std::invalid_argument If the name is unknown
+ */
+StreamFormat parseStreamFormat(std::string_view name)
+{
+    if (name == "cells")
+    {
+        return StreamFormat::Cells;
+    }
+    if (name == "rows")
+    {
+        return StreamFormat::Rows;
+    }
+    if (name == "image")
+    {
+        return StreamFormat::Image;
+    }
+    throw std::invalid_argument("Unknown stream format '" + std::string(name) + "' (expected cells, rows or image)");
+}
+
+/**
+ * @brief Blocks the cells of a cells or rows stream as they arrive
+ *
+ * 1. Reads what is available into the buffer (one blocking read())
+ * 2. Applies the complete lines or rows, keeping a partial one for later
+ * 3. Repeats until end of stream
+ *
+ * @param inputFd Readable file descriptor
+ * @param matrixWorld World to block the cells in
+ * @param format StreamFormat::Cells or StreamFormat::Rows
+ * @return Cell lines or rows read
+ * @throws std::runtime_error If reading fails
+ * @throws std::invalid_argument If the stream is malformed
+ */
+size_t streamBlockedCells(int inputFd, MatrixWorld &matrixWorld, StreamFormat format)
+{
+    StreamBuffer input(inputFd);
+    switch (format)
+    {
+    case StreamFormat::Cells:
+        return streamCells(input, matrixWorld);
+    case StreamFormat::Rows:
+        return streamRows(input, matrixWorld);
+    case StreamFormat::Image:
+        break;
+    }
+    throw std::invalid_argument("Image streams create their own world, use streamWorldImage()");
+}
+
+/**
+ * @brief Decodes a PBM or PGM image stream as it arrives
+ *
+ * parseImageHeader() rejects any header prefix, so the header is retried
+ * after every read until it parses, the stream ends or MAX_HEADER_BYTES
+ * are buffered. Raster rows are then decoded band by band.
+ *
+ * @param inputFd Readable file descriptor
+ * @param occupiedThreshold PGM occupancy above which a pixel is blocked
+ * @return Decoded world
+ * @throws std::runtime_error If reading fails
+ * @throws std::invalid_argument If the stream is not a supported image or is truncated
+ */
+MatrixWorld streamWorldImage(int inputFd, double occupiedThreshold)
+{
+    StreamBuffer input(inputFd);
+    ImageHeader header;
+    bool more = true;
+    while (true)
+    {
+        more = input.fill();
+        try
+        {
+            header = parseImageHeader(input.pending());
+            break;
+        }
+        catch (const std::invalid_argument &)
+        {
+            if (!more || input.pending().size() > MAX_HEADER_BYTES)
+            {
+                throw;
+            }
+        }
+    }
+    const uint32_t cutoff = occupancyCutoff(header, occupiedThreshold);
+    input.consume(header.dataOffset);
+
+    MatrixWorld world(header.height, header.width);
+    const size_t words = world.getWordsPerRow();
+    const size_t rowBytes = header.getRowBytes();
+    std::vector<uint64_t> band;
+    size_t row = 0;
+    while (row < header.height)
+    {
+        std::string_view data = input.pending();
+        const size_t rowCount = std::min(data.size() / rowBytes, header.height - row);
+        if (rowCount != 0)
+        {
+            band.resize(rowCount * words);
+            for (size_t bandRow = 0; bandRow < rowCount; bandRow++)
+            {
+                packImageRow(header, reinterpret_cast<const uint8_t *>(data.data()) + (bandRow * rowBytes), cutoff,
+                             band.data() + (bandRow * words));
+            }
+            world.matrixBlankingRows(static_cast<uint16_t>(row), band.data(), rowCount);
+            input.consume(rowCount * rowBytes);
+            row += rowCount;
+        }
+        if (row < header.height && !more)
+        {
+            throw std::invalid_argument("Truncated image data");
+        }
+        if (row < header.height)
+        {
+            more = input.fill();
+        }
+    }
+    return world;
+}
@@ -0,0 +1,256 @@
+/**
+ * @file world_symmetry.cpp
+ * @brief Implementation of world symmetry detection
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ */
+
+#include "world_symmetry.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+/**
+ * @brief Reverses the bit order of a word
+ */
+uint64_t reverseBits(uint64_t word)
+{
+    word = ((word >> 1) & 0x5555555555555555ULL) | ((word & 0x5555555555555555ULL) << 1);
+    word = ((word >> 2) & 0x3333333333333333ULL) | ((word & 0x3333333333333333ULL) << 2);
+    word = ((word >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((word & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    word = ((word >> 8) & 0x00FF00FF00FF00FFULL) | ((word & 0x00FF00FF00FF00FFULL) << 8);
+    word = ((word >> 16) & 0x0000FFFF0000FFFFULL) | ((word & 0x0000FFFF0000FFFFULL) << 16);
+    return (word >> 32) | (word << 32);
+}
+
+/**
+ * @brief Writes the column-reversed copy of a packed row
+ *
+ * Reversing all words * 64 bits moves the padding to the low end; shifting
+ * it out and re-blocking the high bits yields the reversed row in the same
+ * layout as MatrixWorld rows.
+ *
+ * @param row Packed row words
+ * @param words Words per row
+ * @param cols Columns per row
+ * @param reversed Output, words entries
+ */
+void reverseRow(const uint64_t *row, size_t words, uint16_t cols, uint64_t *reversed)
+{
+    for (size_t word = 0; word < words; word++)
+    {
+        reversed[word] = reverseBits(row[words - 1 - word]);
+    }
+
+    const unsigned padding = static_cast<unsigned>((words * 64) - cols);
+    if (padding == 0)
+    {
+        return;
+    }
+    for (size_t word = 0; word < words; word++)
+    {
+        const uint64_t high = word + 1 < words ? reversed[word + 1] << (64 - padding) : ~uint64_t{0} << (64 - padding);
+        reversed[word] = (reversed[word] >> padding) | high;
+    }
+}
+
+/**
+ * @brief Builds the packed rows of the transposed matrix of a square world
+ * @param matrixWorld Square world
+ * @return n × words packed words, padding blocked
+ */
+std::vector<uint64_t> transposeRows(const MatrixWorld &matrixWorld)
+{
+    const uint16_t size = matrixWorld.getColSize();
+    const size_t words = matrixWorld.getWordsPerRow();
+    std::vector<uint64_t> transposed(size * words, ~uint64_t{0});
+
+    for (uint16_t row = 0; row < size; row++)
+    {
+        const uint64_t *packed = matrixWorld.getRowWords(row);
+        const uint64_t rowBit = uint64_t{1} << (row % 64);
+        for (size_t word = 0; word < words; word++)
+        {
+            for (uint64_t free = ~packed[word]; free != 0; free &= free - 1)
+            {
+                const size_t col = (word * 64) + std::countr_zero(free);
+                transposed[(col * words) + (row / 64)] &= ~rowBit;
+            }
+        }
+    }
+    return transposed;
+}
+} // namespace
+
+/**
+ * @brief Finds every transform that maps the world onto itself
+ *
+ * Each transform is checked row by row against a packed image row and
+ * abandoned at the first mismatch:
+ * - MirrorRows: row r == row rows-1-r
+ * - MirrorCols: row r == reversed row r
+ * - Rotate180: row r == reversed row rows-1-r
+ * - Transpose: row r == transposed row r
+ * - Rotate90/Rotate270: row r == reversed transposed row r (each implies the other)
+ * - AntiTranspose: row r == reversed transposed row n-1-r
+ *
+ * @param matrixWorld World to analyze
+ * @return Symmetries of the world
+ */
+std::vector<CellTransform> detectSymmetries(const MatrixWorld &matrixWorld)
+{
+    std::vector<CellTransform> symmetries;
+    if (matrixWorld.getTotalCells() == 0)
+    {
+        return symmetries;
+    }
+
+    const uint16_t rows = matrixWorld.getColSize();
+    const uint16_t cols = matrixWorld.getRowSize();
+    const size_t words = matrixWorld.getWordsPerRow();
+    std::vector<uint64_t> image(words);
+
+    auto holds = [&](auto imageRow) {
+        for (uint16_t row = 0; row < rows; row++)
+        {
+            const uint64_t *packed = matrixWorld.getRowWords(row);
+            if (!std::equal(packed, packed + words, imageRow(row)))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (holds([&](uint16_t row) { return matrixWorld.getRowWords(rows - 1 - row); }))
+    {
+        symmetries.push_back(CellTransform::MirrorRows);
+    }
+    if (holds([&](uint16_t row) {
+            reverseRow(matrixWorld.getRowWords(row), words, cols, image.data());
+            return image.data();
+        }))
+    {
+        symmetries.push_back(CellTransform::MirrorCols);
+    }
+    if (holds([&](uint16_t row) {
+            reverseRow(matrixWorld.getRowWords(rows - 1 - row), words, cols, image.data());
+            return image.data();
+        }))
+    {
+        symmetries.push_back(CellTransform::Rotate180);
+    }
+
+    if (rows != cols)
+    {
+        return symmetries;
+    }
+
+    const std::vector<uint64_t> transposed = transposeRows(matrixWorld);
+    auto transposedRow = [&](uint16_t row) { return transposed.data() + (row * words); };
+
+    if (holds(transposedRow))
+    {
+        symmetries.push_back(CellTransform::Transpose);
+    }
+    if (holds([&](uint16_t row) {
+            reverseRow(transposedRow(row), words, cols, image.data());
+            return image.data();
+        }))
+    {
+        symmetries.push_back(CellTransform::Rotate90);
+        symmetries.push_back(CellTransform::Rotate270);
+    }
+    if (holds([&](uint16_t row) {
+            reverseRow(transposedRow(rows - 1 - row), words, cols, image.data());
+            return image.data();
+        }))
+    {
+        symmetries.push_back(CellTransform::AntiTranspose);
+    }
+    return symmetries;
+}
+
+/**
+ * @brief Applies a transform to a cell
+ * @param transform Transform to apply
+ * @param cell (row, col) of the cell
+ * @param rows Matrix row count
+ * @param cols Matrix column count
+ * @return (row, col) of the image cell
+ */
+std::pair<uint16_t, uint16_t> applyTransform(CellTransform transform,
+                                             std::pair<uint16_t, uint16_t> cell,
+                                             uint16_t rows,
+                                             uint16_t cols)
+{
+    const auto [row, col] = cell;
+    const auto flippedRow = static_cast<uint16_t>(rows - 1 - row);
+    const auto flippedCol = static_cast<uint16_t>(cols - 1 - col);
+    switch (transform)
+    {
+    case CellTransform::MirrorRows:
+        return {flippedRow, col};
+    case CellTransform::MirrorCols:
+        return {row, flippedCol};
+    case CellTransform::Rotate180:
+        return {flippedRow, flippedCol};
+    case CellTransform::Rotate90:
+        return {col, flippedRow};
+    case CellTransform::Rotate270:
+        return {flippedCol, row};
+    case CellTransform::Transpose:
+        return {col, row};
+    case CellTransform::AntiTranspose:
+        return {flippedCol, flippedRow};
+    }
+    return cell;
+}
+
+/**
+ * @brief Applies a transform to every cell of a path
+ *
+ * Transforms are isometries of the grid, so adjacent cells stay adjacent and
+ * the image is contiguous whenever the path is.
+ *
+ * @param transform Symmetry of the world
+ * @param path Path in the world
+ * @param rows Matrix row count
+ * @param cols Matrix column count
+ * @return Image path
+ */
+Path transformPath(CellTransform transform, const Path &path, uint16_t rows, uint16_t cols)
+{
+    Path image;
+    for (const auto &cell : path)
+    {
+        auto [row, col] = applyTransform(transform, cell, rows, cols);
+        image.addCoordinate(row, col);
+    }
+    return image;
+}
+
+/**
+ * @brief Checks whether a cell represents its orbit under the given symmetries
+ *
+ * The representative is the orbit member with the smallest row-major index.
+ * Since the symmetries form a group, the images of the cell are its whole
+ * orbit.
+ *
+ * @param cell (row, col) of the cell
+ * @param symmetries Symmetry group of the world
+ * @param rows Matrix row count
+ * @param cols Matrix column count
+ * @return true if no image of the cell has a smaller row-major index
+ */
+bool isOrbitRepresentative(std::pair<uint16_t, uint16_t> cell,
+                           const std::vector<CellTransform> &symmetries,
+                           uint16_t rows,
+                           uint16_t cols)
+{
+    return std::all_of(symmetries.begin(), symmetries.end(), [&](CellTransform transform) {
+        return applyTransform(transform, cell, rows, cols) >= cell;
+    });
+}
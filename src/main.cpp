@@ -10,12 +10,29 @@
  * the selected path finding algorithm with visualization output.
  */
 
+#include "algorithm_registry.hpp"
+#include "batch_runner.hpp"
+#include "blocked_cells_loader.hpp"
 #include "cli_utils.hpp"
-#include "dfs_algorithm.hpp"
+#include "feasibility_oracle.hpp"
 #include "matrix_utils.hpp"
+#include "moving_ai.hpp"
 #include "path.hpp"
+#include "path_service.hpp"
+#include "performance_guard.hpp"
+#include "result_output.hpp"
+#include "world_image_loader.hpp"
+#include "world_pipeline.hpp"
+#include "world_statistics.hpp"
+#include "world_stream_loader.hpp"
+#include <chrono>
+#include <csignal>
 #include <cstddef>
 #include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <unistd.h>
 
 /**
  * @brief Main entry point for is-wireless path finding application
@@ -25,15 +42,31 @@
  * 
  * Application workflow:
  * 1. Converts C-style argv to std::vector<std::string> for type safety
- * 2. Parses command line arguments using CLIParser
- * 3. Creates MatrixWorld with specified dimensions
- * 4. Blocks specified cells in the matrix
- * 5. Executes DFS algorithm to find viable path
- * 6. Outputs path coordinates or reports failure
+ * 2. Parses command line arguments using CLIParser; in batch mode runs the
+ *    job file and prints one result line per job, in service mode serves the
+ *    socket until SIGINT or SIGTERM, instead of the steps below
+ * 3. Creates MatrixWorld with specified dimensions, or decodes it from an
+ *    image streamed on stdin, the MovingAI map or the PBM/PGM world image
+ * 4. Blocks specified cells in the matrix, then the cells of the blocked
+ *    cells file (parallel memory-mapped load), then the cells or rows
+ *    streamed on stdin, read, parsed, merged and scored in overlapping
+ *    pipeline stages so the candidate ranking is ready when the input ends
+ * 5. With a scenario file, runs every query and reports throughput and
+ *    latency percentiles instead of the steps below
+ * 6. Rejects provably infeasible requests with a reason (linear time)
+ * 7. Executes the selected algorithm (DFS by default) to find viable path
+ * 8. Outputs path coordinates or reports failure; with --output json or csv
+ *    the echo of steps 2-4 is suppressed and a single record with the status,
+ *    path and phase timings is written instead
  * 
  * Error handling:
  * - Invalid CLI parameters: CLIParser throws exceptions (program terminates)
  * - Cell blocking failures: Returns error code 1
+ * - Unreadable or malformed blocked cells file, world image, map, scenario file, stdin stream or job file:
+ *   Returns error code 1 (failed batch jobs are reported on their result line)
+ * - Unknown algorithm name: Returns error code 1
+ * - Service socket cannot be bound: Returns error code 1
+ * - Infeasible request: Reports the reason without running any search
  * - Path finding failures: Reports empty path gracefully
  * 
  * @note Uses type-safe parameter structures (PathLength, MaxStartingPoints)
@@ -52,24 +85,147 @@ int main(int argc, char *argv[])
 
     // Parse command line arguments (may throw exceptions for invalid input)
     CLIParameters params = CLIParser(argc_size, args);
+
+    // Batch mode: every job carries its own world and query
+    if (!params.batchFile.empty())
+    {
+        std::vector<BatchJob> jobs;
+        try
+        {
+            jobs = loadBatchJobFile(params.batchFile, params.algorithm, params.maxStartingPoints);
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Error: " << e.what() << " in " << params.batchFile << std::endl;
+            return 1;
+        }
+        if (params.outputFormat == OutputFormat::Csv)
+        {
+            std::string header;
+            appendCsvHeader(header);
+            std::cout << header;
+        }
+        runBatch(jobs, params.threads, [&](size_t index, const BatchResult &result) {
+            if (params.outputFormat == OutputFormat::Text)
+            {
+                printBatchResult(index, jobs[index], result);
+            }
+            else
+            {
+                writeRecord(std::cout, makeBatchRecord(index, jobs[index], result), params.outputFormat,
+                            params.pathEncoding);
+            }
+        });
+        std::cout.flush();
+        return 0;
+    }
+
+    // Service mode: worlds and queries arrive over the socket
+    if (!params.serveSocket.empty())
+    {
+        // Block the stop signals in every thread, then wait for them here
+        sigset_t stopSignals;
+        sigemptyset(&stopSignals);
+        sigaddset(&stopSignals, SIGINT);
+        sigaddset(&stopSignals, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &stopSignals, nullptr);
+
+        PathService service(params.serveSocket, params.threads);
+        try
+        {
+            service.start();
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+        std::cout << "Serving on " << params.serveSocket << std::endl;
+        int signal = 0;
+        sigwait(&stopSignals, &signal);
+        service.stop();
+        return 0;
+    }
+
+    // Structured output replaces the echo below with one record per query
+    using Clock = std::chrono::steady_clock;
+    auto microsSince = [](Clock::time_point start) {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    };
+    const bool verbose = params.outputFormat == OutputFormat::Text;
+    const auto queryStart = Clock::now();
+    QueryRecord record;
+    record.algorithm = params.algorithm;
+    record.pathLength = params.pathLength;
+
     // Output parsed parameters for verification and debugging
-    std::cout << "Rows: " << params.rows << std::endl;
-    std::cout << "Cols: " << params.cols << std::endl;
-    std::cout << "Path Length: " << params.pathLength.value << std::endl;
-    std::cout << "Max Starting Points: " << params.maxStartingPoints.value << std::endl;
-    std::cout << "Blocked Cells: ";
-    for (auto iterator = params.blockedCells.begin();
-         // limit output to first 100 blocked cells to avoid flooding console
-         iterator != params.blockedCells.end() &&
-         std::distance(params.blockedCells.begin(), iterator) < MAX_PATH_PRINT_LENGTH;
-         ++iterator)
+    const bool imageOnStdin = params.stdinFormat == StreamFormat::Image;
+    if (verbose)
     {
-        std::cout << "{" << iterator->first << "," << iterator->second << "} ";
+        if (params.worldImage.empty() && params.mapFile.empty() && !imageOnStdin)
+        {
+            std::cout << "Rows: " << params.rows << std::endl;
+            std::cout << "Cols: " << params.cols << std::endl;
+        }
+        std::cout << "Path Length: " << params.pathLength.value << std::endl;
+        std::cout << "Max Starting Points: " << params.maxStartingPoints.value << std::endl;
+        std::cout << "Algorithm: " << params.algorithm << std::endl;
+        std::cout << "Blocked Cells: ";
+        for (auto iterator = params.blockedCells.begin();
+             // limit output to first 100 blocked cells to avoid flooding console
+             iterator != params.blockedCells.end() &&
+             std::distance(params.blockedCells.begin(), iterator) < MAX_PATH_PRINT_LENGTH;
+             ++iterator)
+        {
+            std::cout << "{" << iterator->first << "," << iterator->second << "} ";
+        }
+        std::cout << std::endl;
     }
-    std::cout << std::endl;
 
-    // Create matrix world with specified dimensions
-    MatrixWorld matrix(params.rows, params.cols);
+    // Create matrix world with specified dimensions, or from the image stream, MovingAI map or world image
+    MatrixWorld matrix;
+    if (imageOnStdin)
+    {
+        try
+        {
+            matrix = streamWorldImage(STDIN_FILENO, params.occupiedThreshold);
+            record.world = "stdin";
+            if (verbose)
+            {
+                std::cout << "World Stream: stdin (" << matrix.getColSize() << "x" << matrix.getRowSize() << ")"
+                          << std::endl;
+            }
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Error: " << e.what() << " in stdin" << std::endl;
+            return 1;
+        }
+    }
+    else if (params.worldImage.empty() && params.mapFile.empty())
+    {
+        matrix = MatrixWorld(params.rows, params.cols);
+    }
+    else
+    {
+        const std::string &worldFile = params.mapFile.empty() ? params.worldImage : params.mapFile;
+        try
+        {
+            matrix = params.mapFile.empty() ? loadWorldImageFile(worldFile, params.occupiedThreshold)
+                                            : loadMovingAiMapFile(worldFile);
+            record.world = worldFile;
+            if (verbose)
+            {
+                std::cout << "World File: " << worldFile << " (" << matrix.getColSize() << "x" << matrix.getRowSize()
+                          << ")" << std::endl;
+            }
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Error: " << e.what() << " in " << worldFile << std::endl;
+            return 1;
+        }
+    }
 
     // Block specified cells (validate success)
     if (!matrix.matrixBlanking(params.blockedCells))
@@ -78,12 +234,142 @@ int main(int argc, char *argv[])
         return 1;
     }
 
-    // Execute DFS path finding algorithm
-    DFSAlgorithm dfs;
-    Path path = dfs.findViablePath(matrix, params.pathLength, params.maxStartingPoints);
+    if (!params.blockedCellsFile.empty())
+    {
+        try
+        {
+            size_t loadedCells = loadBlockedCellsFile(params.blockedCellsFile, matrix);
+            if (verbose)
+            {
+                std::cout << "Blocked Cells File: " << params.blockedCellsFile << " (" << loadedCells << " cells)"
+                          << std::endl;
+            }
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Error: " << e.what() << " in " << params.blockedCellsFile << std::endl;
+            return 1;
+        }
+    }
+
+    if (params.stdinFormat.has_value() && !imageOnStdin)
+    {
+        try
+        {
+            PipelineResult loaded = loadWorldPipelined(STDIN_FILENO, matrix, *params.stdinFormat);
+            if (verbose)
+            {
+                std::cout << "World Stream: stdin (" << loaded.items
+                          << (*params.stdinFormat == StreamFormat::Cells ? " cells" : " rows")
+                          << (loaded.ranking ? ", ranked while loading)" : ")") << std::endl;
+            }
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Error: " << e.what() << " in stdin" << std::endl;
+            return 1;
+        }
+    }
+
+    record.timings.loadMicros = microsSince(queryStart);
+
+    // Writes the record of the single query (structured output only)
+    auto emitRecord = [&](const char *status) {
+        record.status = status;
+        record.rows = matrix.getColSize();
+        record.cols = matrix.getRowSize();
+        record.blockedCells = countBlockedCells(matrix);
+        record.timings.totalMicros = microsSince(queryStart);
+        if (params.outputFormat == OutputFormat::Csv)
+        {
+            std::string header;
+            appendCsvHeader(header);
+            std::cout << header;
+        }
+        writeRecord(std::cout, record, params.outputFormat, params.pathEncoding);
+    };
+
+    // Benchmark mode: run every scenario query instead of a single search
+    if (!params.scenarioFile.empty())
+    {
+        try
+        {
+            std::vector<ScenarioEntry> scenarios = loadScenarioFile(params.scenarioFile);
+            std::unique_ptr<PathAlgorithm> algorithm = AlgorithmRegistry::instance().create(params.algorithm);
+            printScenarioReport(runScenarios(matrix, scenarios, *algorithm, params.maxStartingPoints));
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Error: " << e.what() << " in " << params.scenarioFile << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    // Create the requested path finding engine (an unknown name is an error even for infeasible requests)
+    std::unique_ptr<PathAlgorithm> algorithm;
+    try
+    {
+        algorithm = AlgorithmRegistry::instance().create(params.algorithm);
+    }
+    catch (const std::invalid_argument &e)
+    {
+        std::cerr << "Error: " << e.what() << ". Use --listAlgorithms to see available engines." << std::endl;
+        return 1;
+    }
+
+    // Reject impossible requests before any (possibly exponential) search
+    const auto feasibilityStart = Clock::now();
+    FeasibilityResult feasibility = checkPathFeasibility(matrix, params.pathLength);
+    record.timings.feasibilityMicros = microsSince(feasibilityStart);
+    if (!feasibility.isFeasible)
+    {
+        if (verbose)
+        {
+            std::cout << "No viable path exists: " << feasibility.reason << "." << std::endl;
+        }
+        else
+        {
+            record.reason = feasibility.reason;
+            emitRecord("infeasible");
+        }
+        return 0;
+    }
+
+    // Execute path finding algorithm
+    // With --enableMeasurement the guard reports the counters of the search as
+    // text; structured output measures quietly and adds them to the record
+    const bool measureQuietly = !verbose && PerformanceMeasureGuard::isMeasurementEnabled;
+    const auto searchStart = Clock::now();
+    Path path;
+    {
+        std::optional<PerformanceMeasureGuard> measurement;
+        if (verbose)
+        {
+            measurement.emplace(algorithm.get());
+        }
+        else if (measureQuietly)
+        {
+            algorithm->setProgressMessages(false);
+            algorithm->measureStart();
+        }
+        path = algorithm->findViablePath(matrix, params.pathLength, params.maxStartingPoints);
+    }
+    if (measureQuietly)
+    {
+        algorithm->measureStop();
+        record.counters = algorithm->saveMeasures();
+    }
+    record.timings.searchMicros = microsSince(searchStart);
 
     // Output results
-    if (path.isEmpty())
+    if (!verbose)
+    {
+        const bool found = !path.isEmpty();
+        record.path = std::move(path);
+        emitRecord(found ? "found" : "not_found");
+    }
+    else if (path.isEmpty())
     {
         std::cout << "No viable path found with the specified parameters." << std::endl;
         std::cout << "Try reducing path length or increasing max starting points." << std::endl;
@@ -0,0 +1,175 @@
+/**
+ * @file test_algorithm_registry.cpp
+ * @brief Unit tests for the algorithm registry and automatic engine selection
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - World statistics collection (components, degree classes)
+ * - Engine creation by name and unknown name handling
+ * - Applicability filtering and cost ordering
+ * - Automatic engine selection end to end
+ */
+
+#include "../test_main.hpp"
+#include "algorithm_registry.hpp"
+#include "auto_algorithm.hpp"
+#include "dfs_algorithm.hpp"
+#include "world_statistics.hpp"
+#include <cassert>
+#include <iostream>
+
+/**
+ * @brief Tests world statistics on a world split into two components
+ *
+ * Blocks the middle column of a 3x5 world, leaving two 3x2 components.
+ */
+void testWorldStatistics()
+{
+    std::cout << "Testing world statistics..." << std::endl;
+
+    MatrixWorld world(3, 5);
+    world.setCell(0, 2, true);
+    world.setCell(1, 2, true);
+    world.setCell(2, 2, true);
+
+    WorldStatistics stats = computeWorldStatistics(world);
+
+    assert(stats.freeCells == 12);
+    assert(stats.blockedCells == 3);
+    assert(stats.componentCount == 2);
+    assert(stats.largestComponentSize == 6);
+    assert(stats.deadEndCells + stats.corridorCells + stats.junctionCells == stats.freeCells);
+    assert(stats.blockedRatio > 0.24 && stats.blockedRatio < 0.26);
+
+    std::cout << "✓ World statistics test passed" << std::endl;
+}
+
+/**
+ * @brief Tests engine creation by name
+ *
+ * Built-in engines must be creatable, unknown names must throw.
+ */
+void testCreateByName()
+{
+    std::cout << "Testing engine creation by name..." << std::endl;
+
+    AlgorithmRegistry &registry = AlgorithmRegistry::instance();
+    assert(registry.contains("dfs"));
+    assert(registry.contains("auto"));
+
+    auto dfs = registry.create("dfs");
+    assert(dfs != nullptr);
+    assert(dfs->getAlgorithmName() == "Depth-First Search (DFS) Algorithm");
+
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(registry.create("no-such-engine"));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ Engine creation test passed" << std::endl;
+}
+
+/**
+ * @brief Tests applicability filtering and cost ordering
+ *
+ * Registers a cheap engine applicable only to open worlds and checks that it
+ * is ranked before DFS there and filtered out on cluttered worlds.
+ */
+void testEngineSelection()
+{
+    std::cout << "Testing engine selection..." << std::endl;
+
+    AlgorithmRegistry &registry = AlgorithmRegistry::instance();
+    registry.registerAlgorithm({"test-open-only",
+                                "Test engine for open worlds",
+                                1,
+                                false,
+                                [](const WorldStatistics &stats, PathLength) { return stats.blockedRatio < 0.1; },
+                                [] { return std::make_unique<DFSAlgorithm>(); }});
+
+    WorldStatistics open;
+    open.blockedRatio = 0.0;
+    auto engines = registry.selectEngines(open, {4});
+    assert(!engines.empty());
+    assert(engines.front().name == "test-open-only");
+    for (const auto &engine : engines)
+    {
+        assert(engine.name != "auto"); // Meta engines are never selected
+    }
+
+    WorldStatistics cluttered;
+    cluttered.blockedRatio = 1.0;
+    engines = registry.selectEngines(cluttered, {4});
+    for (const auto &engine : engines)
+    {
+        assert(engine.name != "test-open-only");
+    }
+
+    std::cout << "✓ Engine selection test passed" << std::endl;
+}
+
+/**
+ * @brief Tests the automatic selection end to end
+ *
+ * Finds a path in an open world and rejects a request longer than the largest
+ * component without running any engine.
+ */
+void testAutoSelection()
+{
+    std::cout << "Testing automatic selection..." << std::endl;
+
+    MatrixWorld world(4, 4);
+    AutoSelectAlgorithm autoSelect;
+    Path path = autoSelect.findViablePath(world, {6}, {5});
+    assert(path.getLength() == 6);
+    assert(path.isContiguous());
+    assert(!autoSelect.getLastSelectedEngine().empty());
+
+    // Two components of 6 cells each - a path of 7 is impossible
+    MatrixWorld split(3, 5);
+    split.setCell(0, 2, true);
+    split.setCell(1, 2, true);
+    split.setCell(2, 2, true);
+    Path impossible = autoSelect.findViablePath(split, {7}, {5});
+    assert(impossible.isEmpty());
+    assert(autoSelect.getLastSelectedEngine().empty());
+
+    std::cout << "✓ Automatic selection test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the algorithm registry
+ */
+int main()
+{
+    std::cout << "=== Algorithm Registry Test Suite ===" << std::endl;
+
+    try
+    {
+        testWorldStatistics();
+        testCreateByName();
+        testEngineSelection();
+        testAutoSelection();
+
+        std::cout << "\n✅ All Algorithm Registry tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,184 @@
+/**
+ * @file test_batch_runner.cpp
+ * @brief Unit tests for the batch query mode
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Job file parsing, defaults and errors
+ * - World references and the load-once world cache
+ * - Results arrive in job order with valid paths, failures do not stop the batch
+ */
+
+#include "../test_main.hpp"
+#include "batch_runner.hpp"
+#include "path_validation.hpp"
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Tests job file parsing
+ */
+void testJobParsing()
+{
+    std::cout << "Testing job parsing..." << std::endl;
+
+    std::vector<BatchJob> jobs = loadBatchJobs("# jobs\n10x10 20\n\n  arena.map 5 auto # comment\n"
+                                               "4x4 3 dfs 9\r\n",
+                                               "dfs", {7});
+    assert(jobs.size() == 3);
+    assert(jobs[0].world == "10x10" && jobs[0].pathLength.value == 20);
+    assert(jobs[0].algorithm == "dfs" && jobs[0].maxStartingPoints.value == 7 && jobs[0].lineNumber == 2);
+    assert(jobs[1].world == "arena.map" && jobs[1].algorithm == "auto" && jobs[1].lineNumber == 4);
+    assert(jobs[2].maxStartingPoints.value == 9);
+
+    for (const char *text : {"10x10\n", "10x10 x\n", "10x10 70000\n", "10x10 5 dfs -1\n", "10x10 5 dfs 1 2\n"})
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            UNUSED(loadBatchJobs(text, "dfs", {5}));
+        }
+        catch (const std::invalid_argument &e)
+        {
+            exceptionThrown = std::string(e.what()).find("line 1") != std::string::npos;
+        }
+        assert(exceptionThrown);
+    }
+
+    std::cout << "✓ Job parsing test passed" << std::endl;
+}
+
+/**
+ * @brief Tests world references and the world cache
+ */
+void testWorldCache()
+{
+    std::cout << "Testing world cache..." << std::endl;
+
+    MatrixWorld open = loadWorldReference("3x70");
+    assert(open.getColSize() == 3 && open.getRowSize() == 70 && open.getNoOfBlockedCells() == 0);
+
+    const std::filesystem::path mapPath = std::filesystem::temp_directory_path() / "test_batch_runner.map";
+    {
+        std::ofstream file(mapPath);
+        file << "type octile\nheight 2\nwidth 3\nmap\n.@.\n...\n";
+    }
+    MatrixWorld map = loadWorldReference(mapPath.string());
+    assert(map.getNoOfBlockedCells() == 1);
+
+    for (const char *reference : {"0x4", "4x", "world.txt", "70000x2"})
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            UNUSED(loadWorldReference(reference));
+        }
+        catch (const std::invalid_argument &)
+        {
+            exceptionThrown = true;
+        }
+        assert(exceptionThrown);
+    }
+
+    // Concurrent first uses share one load
+    WorldCache cache;
+    std::vector<std::shared_ptr<const CachedWorld>> loaded(8);
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < loaded.size(); thread++)
+    {
+        threads.emplace_back([&, thread]() { loaded[thread] = cache.get(mapPath.string()); });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    std::filesystem::remove(mapPath);
+    for (const auto &world : loaded)
+    {
+        assert(world == loaded[0]);
+    }
+    assert(loaded[0]->feasibilityBound == 5);
+    assert(cache.get(mapPath.string()) == loaded[0]); // Served from memory after deletion
+    assert(cache.size() == 1);
+
+    std::cout << "✓ World cache test passed" << std::endl;
+}
+
+/**
+ * @brief Tests ordered result delivery
+ */
+void testRunBatch()
+{
+    std::cout << "Testing batch run..." << std::endl;
+
+    std::string text;
+    for (int job = 0; job < 200; job++)
+    {
+        text += (job % 2 == 0 ? "8x8 " : "5x9 ") + std::to_string(1 + (job % 20)) + "\n";
+    }
+    text += "8x8 65\n";        // Above the feasibility bound
+    text += "8x8 5 missing\n"; // Unknown engine
+    text += "8x8 5\n";
+    std::vector<BatchJob> jobs = loadBatchJobs(text, "dfs", {5});
+
+    size_t expectedIndex = 0;
+    runBatch(jobs, 4, [&](size_t index, const BatchResult &result) {
+        assert(index == expectedIndex);
+        expectedIndex++;
+        if (index < 200 || index == 202)
+        {
+            assert(result.status == BatchStatus::Found);
+            assert(isViablePath(loadWorldReference(jobs[index].world), result.path, jobs[index].pathLength));
+        }
+        else if (index == 200)
+        {
+            assert(result.status == BatchStatus::Infeasible && !result.message.empty());
+        }
+        else
+        {
+            assert(result.status == BatchStatus::Failed && result.message.find("missing") != std::string::npos);
+        }
+    });
+    assert(expectedIndex == jobs.size());
+
+    // Empty batches return at once
+    runBatch({}, 4, [](size_t, const BatchResult &) { assert(false); });
+
+    std::cout << "✓ Batch run test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the batch mode
+ */
+int main()
+{
+    std::cout << "=== Batch Runner Test Suite ===" << std::endl;
+
+    try
+    {
+        testJobParsing();
+        testWorldCache();
+        testRunBatch();
+
+        std::cout << "\n✅ All Batch Runner tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,167 @@
+/**
+ * @file test_blocked_cells_loader.cpp
+ * @brief Unit tests for the parallel blocked cells loader
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Line format handling (comments, blanks, CRLF, missing final newline)
+ * - Errors name the offending line and leave the world untouched
+ * - Parallel chunked parsing matches single-threaded parsing
+ * - Files are mapped and loaded, missing files are reported
+ */
+
+#include "../test_main.hpp"
+#include "blocked_cells_loader.hpp"
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Tests the accepted line formats
+ */
+void testLineFormats()
+{
+    std::cout << "Testing line formats..." << std::endl;
+
+    MatrixWorld world(4, 70);
+    size_t lines = loadBlockedCells("# header\n0,1\r\n\n  1 , 69 \n\t# indented comment\n3,64", world, 1);
+    assert(lines == 3);
+    assert(world.getNoOfBlockedCells() == 3);
+    assert(!world.isUnblocked(0, 1));
+    assert(!world.isUnblocked(1, 69));
+    assert(!world.isUnblocked(3, 64));
+
+    // Duplicates count as lines but block once
+    assert(loadBlockedCells("0,1\n0,1\n2,2\n", world, 1) == 3);
+    assert(world.getNoOfBlockedCells() == 4);
+
+    // Empty input changes nothing, not even the version
+    uint64_t version = world.getVersion();
+    assert(loadBlockedCells("", world, 1) == 0);
+    assert(world.getVersion() == version);
+
+    std::cout << "✓ Line formats test passed" << std::endl;
+}
+
+/**
+ * @brief Tests error reporting
+ */
+void testErrors()
+{
+    std::cout << "Testing errors..." << std::endl;
+
+    MatrixWorld world(4, 4);
+    const std::vector<std::pair<std::string, std::string>> cases = {
+        {"0,1\n# c\n1;2\n", "line 3"},
+        {"0,1\n1,2,3\n", "line 2"},
+        {"x,1\n", "line 1"},
+        {"0,1\n4,0\n", "outside the matrix at line 2"},
+        {"0,99999999999\n", "line 1"},
+        {"-1,0\n", "line 1"}};
+    for (const auto &[text, expected] : cases)
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            UNUSED(loadBlockedCells(text, world, 1));
+        }
+        catch (const std::invalid_argument &e)
+        {
+            exceptionThrown = std::string(e.what()).find(expected) != std::string::npos;
+        }
+        assert(exceptionThrown);
+    }
+    assert(world.getNoOfBlockedCells() == 0);
+
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(loadBlockedCellsFile("/nonexistent/blocked_cells.txt", world));
+    }
+    catch (const std::runtime_error &)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ Errors test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that a multi-chunk parallel load matches a sequential one
+ */
+void testParallelFileLoad()
+{
+    std::cout << "Testing parallel file load..." << std::endl;
+
+    const uint16_t rows = 1000;
+    const uint16_t cols = 900;
+    std::mt19937 generator(66);
+    std::uniform_int_distribution<int> rowDistribution(0, rows - 1);
+    std::uniform_int_distribution<int> colDistribution(0, cols - 1);
+
+    // Large enough for several chunks
+    std::string text = "# generated\n";
+    for (int cell = 0; cell < 400000; cell++)
+    {
+        text += std::to_string(rowDistribution(generator)) + "," + std::to_string(colDistribution(generator)) + "\n";
+    }
+
+    const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "test_blocked_cells_loader.txt";
+    {
+        std::ofstream file(filePath, std::ios::binary);
+        file << text;
+    }
+
+    MatrixWorld sequential(rows, cols);
+    MatrixWorld parallel(rows, cols);
+    assert(loadBlockedCells(text, sequential, 1) == 400000);
+    assert(loadBlockedCellsFile(filePath.string(), parallel, 4) == 400000);
+    std::filesystem::remove(filePath);
+
+    assert(parallel.getNoOfBlockedCells() == sequential.getNoOfBlockedCells());
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (size_t word = 0; word < parallel.getWordsPerRow(); word++)
+        {
+            assert(parallel.getRowWords(row)[word] == sequential.getRowWords(row)[word]);
+        }
+    }
+
+    std::cout << "✓ Parallel file load test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the blocked cells loader
+ */
+int main()
+{
+    std::cout << "=== Blocked Cells Loader Test Suite ===" << std::endl;
+
+    try
+    {
+        testLineFormats();
+        testErrors();
+        testParallelFileLoad();
+
+        std::cout << "\n✅ All Blocked Cells Loader tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
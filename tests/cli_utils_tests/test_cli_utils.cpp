@@ -6,9 +6,12 @@
  * @version 1.0
  */
 
+#include "../test_main.hpp"
+#include "blocked_cells_loader.hpp"
 #include "cli_utils.hpp"
 #include <cassert>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -143,19 +146,20 @@ void testCompleteParameterSet()
 /**
  * @brief Tests blocked cells file parameter parsing functionality
  * 
- * Validates parsing of blocked cell coordinates from file using --blockedCellsFile parameter.
- * Tests the file reading logic, comment handling, and coordinate extraction.
- * Uses a test file with known coordinates to verify correct parsing.
+ * Validates parsing of the --blockedCellsFile parameter. The parser only
+ * records the path; the cells are loaded into the world afterwards with
+ * loadBlockedCellsFile(), which must handle comments and block the listed cells.
  * 
  * Test case: --blockedCellsFile test_blocked_cells.txt
- * Expected: 3 blocked cells parsed from file (0,1), (1,0), (2,2)
+ * Expected: 3 blocked cells loaded from file (0,1), (1,0), (2,2)
  */
 void testBlockedCellsFileParsing()
 {
     std::cout << "Testing blocked cells file parsing..." << std::endl;
 
+    const std::string filePath = std::string(TEST_DATA_DIR) + "/test_blocked_cells.txt";
     const std::vector<std::string> args = {"pathFinder", "--rows", "4", "--cols", "4", "--pathLength", "6", 
-                                           "--blockedCellsFile", "/home/marcel/Code/is-wireless/tests/cli_utils_tests/test_blocked_cells.txt"};
+                                           "--blockedCellsFile", filePath};
     size_t argc = args.size();
 
     CLIParameters params = CLIParser(argc, args);
@@ -163,14 +167,91 @@ void testBlockedCellsFileParsing()
     assert(params.rows == 4);
     assert(params.cols == 4);
     assert(params.pathLength.value == 6);
-    assert(params.blockedCells.size() == 3);
-    assert(params.blockedCells[0].first == 0 && params.blockedCells[0].second == 1);
-    assert(params.blockedCells[1].first == 1 && params.blockedCells[1].second == 0);
-    assert(params.blockedCells[2].first == 2 && params.blockedCells[2].second == 2);
+    assert(params.blockedCells.empty());
+    assert(params.blockedCellsFile == filePath);
+
+    MatrixWorld world(params.rows, params.cols);
+    assert(loadBlockedCellsFile(params.blockedCellsFile, world) == 3);
+    assert(world.getNoOfBlockedCells() == 3);
+    assert(!world.isUnblocked(0, 1));
+    assert(!world.isUnblocked(1, 0));
+    assert(!world.isUnblocked(2, 2));
 
     std::cout << "✓ Blocked cells file parsing test passed" << std::endl;
 }
 
+/**
+ * @brief Tests the blocked cell token parser and its error reporting
+ * 
+ * Validates that:
+ * - Braced and brace-less tokens parse to the same cell
+ * - Malformed and out-of-range tokens throw with the token index in the message
+ * - Out-of-range numeric flag values are rejected
+ * - Long cell lists are parsed completely and in order
+ */
+void testBlockedCellTokenParsing()
+{
+    std::cout << "Testing blocked cell token parsing..." << std::endl;
+
+    assert((parseBlockedCell("{12,345}", 0) == std::pair<uint16_t, uint16_t>{12, 345}));
+    assert((parseBlockedCell("12,345", 0) == std::pair<uint16_t, uint16_t>{12, 345}));
+    assert((parseBlockedCell("{65535,0}", 0) == std::pair<uint16_t, uint16_t>{65535, 0}));
+
+    for (const char *token : {"{1,2", "1,2}", "{1;2}", "{,2}", "{1,}", "{}", "{", "", "1", "{-1,2}", "{1,2,3}",
+                              "{+1,2}", "{65536,0}", "{0,99999999999999999999}", "{1, 2}"})
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            UNUSED(parseBlockedCell(token, 7));
+        }
+        catch (const std::invalid_argument &e)
+        {
+            exceptionThrown = std::string(e.what()).find("token 7") != std::string::npos;
+        }
+        assert(exceptionThrown);
+    }
+
+    std::vector<std::string> args = {"pathFinder", "--rows", "4", "--cols", "4", "--pathLength", "6",
+                                     "--blockedCells", "{1,0}", "{2,x}"};
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(CLIParser(args.size(), args));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = std::string(e.what()).find("token 9") != std::string::npos;
+    }
+    assert(exceptionThrown);
+
+    args = {"pathFinder", "--rows", "70000", "--cols", "4", "--pathLength", "6"};
+    exceptionThrown = false;
+    try
+    {
+        UNUSED(CLIParser(args.size(), args));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = std::string(e.what()).find("--rows") != std::string::npos;
+    }
+    assert(exceptionThrown);
+
+    args = {"pathFinder", "--rows", "200", "--cols", "200", "--blockedCells"};
+    for (uint16_t cell = 0; cell < 20000; cell++)
+    {
+        args.push_back("{" + std::to_string(cell / 200) + "," + std::to_string(cell % 200) + "}");
+    }
+    args.emplace_back("--pathLength");
+    args.emplace_back("6");
+    CLIParameters params = CLIParser(args.size(), args);
+    assert(params.blockedCells.size() == 20000);
+    assert((params.blockedCells[19999] == std::pair<uint16_t, uint16_t>{99, 199}));
+    assert(params.pathLength.value == 6);
+
+    std::cout << "✓ Blocked cell token parsing test passed" << std::endl;
+}
+
 /**
  * @brief Main test runner for CLI utilities test suite
  * 
@@ -189,6 +270,7 @@ int main()
     testBlockedCellsParsing();
     testCompleteParameterSet();
     testBlockedCellsFileParsing();
+    testBlockedCellTokenParsing();
 
     std::cout << "\n✓ All CLI Utils tests passed!" << std::endl;
     return 0;
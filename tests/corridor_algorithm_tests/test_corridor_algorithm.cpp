@@ -0,0 +1,211 @@
+/**
+ * @file test_corridor_algorithm.cpp
+ * @brief Unit tests for corridor contraction and the junction graph search
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Degree-2 chains are contracted into single edges
+ * - Pure cycles get a promoted node and a self-loop
+ * - Expanded paths are simple, contiguous and of the requested length
+ * - The search agrees with the exhaustive cell DFS on random worlds
+ * - Invalid parameters are rejected
+ */
+
+#include "../test_main.hpp"
+#include "corridor_algorithm.hpp"
+#include "corridor_graph.hpp"
+#include "dfs_algorithm.hpp"
+#include "path_validation.hpp"
+#include <cassert>
+#include <iostream>
+#include <random>
+
+/**
+ * @brief Tests contraction of a single straight corridor
+ */
+void testStraightCorridor()
+{
+    std::cout << "Testing straight corridor contraction..." << std::endl;
+
+    MatrixWorld world(1, 10);
+    CorridorGraph graph(world);
+    assert(graph.getNodeCount() == 2);
+    assert(graph.getEdgeCount() == 1);
+    assert(graph.getEdge(0).cells.size() == 8);
+    assert(graph.getIncidentEdges(0).size() == 1);
+    assert(graph.getIncidentEdges(1).size() == 1);
+
+    CorridorAlgorithm corridor;
+    Path path = corridor.findViablePath(world, {10}, {});
+    assert(isViablePath(world, path, {10}));
+    path = corridor.findViablePath(world, {4}, {});
+    assert(isViablePath(world, path, {4}));
+
+    std::cout << "✓ Straight corridor contraction test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that a ring of degree-2 cells becomes a self-loop
+ */
+void testPureCycle()
+{
+    std::cout << "Testing pure cycle contraction..." << std::endl;
+
+    MatrixWorld world(3, 3);
+    world.setCell(1, 1, true);
+
+    CorridorGraph graph(world);
+    assert(graph.getNodeCount() == 1);
+    assert(graph.getEdgeCount() == 1);
+    assert(graph.getEdge(0).from == graph.getEdge(0).to);
+    assert(graph.getEdge(0).cells.size() == 7);
+
+    CorridorAlgorithm corridor;
+    Path path = corridor.findViablePath(world, {8}, {});
+    assert(isViablePath(world, path, {8}));
+
+    std::cout << "✓ Pure cycle contraction test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that every free cell is a node or interior to exactly one edge
+ */
+void testCellPartition()
+{
+    std::cout << "Testing cell partition..." << std::endl;
+
+    // Two rooms joined by a long corridor
+    MatrixWorld world(5, 12);
+    for (uint16_t row = 0; row < 5; row++)
+    {
+        for (uint16_t col = 3; col < 9; col++)
+        {
+            if (row != 2)
+            {
+                world.setCell(row, col, true);
+            }
+        }
+    }
+
+    CorridorGraph graph(world);
+    size_t coveredCells = graph.getNodeCount();
+    for (uint32_t edgeId = 0; edgeId < graph.getEdgeCount(); edgeId++)
+    {
+        coveredCells += graph.getEdge(edgeId).cells.size();
+    }
+    assert(coveredCells == world.getNoOfUnblockedCells());
+
+    // The corridor cells in row 2 collapse into a single edge
+    bool hasCorridorEdge = false;
+    for (uint32_t edgeId = 0; edgeId < graph.getEdgeCount(); edgeId++)
+    {
+        hasCorridorEdge = hasCorridorEdge || graph.getEdge(edgeId).cells.size() >= 6;
+    }
+    assert(hasCorridorEdge);
+
+    std::cout << "✓ Cell partition test passed" << std::endl;
+}
+
+/**
+ * @brief Tests agreement with the cell-level DFS on random small worlds
+ *
+ * The cell DFS is exhaustive, so both engines must agree on whether a path
+ * of each length exists.
+ */
+void testAgreesWithDFS()
+{
+    std::cout << "Testing agreement with DFS..." << std::endl;
+
+    std::mt19937 generator(57);
+    std::bernoulli_distribution isBlocked(0.35);
+    for (int round = 0; round < 30; round++)
+    {
+        MatrixWorld world(5, 5);
+        for (uint16_t row = 0; row < 5; row++)
+        {
+            for (uint16_t col = 0; col < 5; col++)
+            {
+                world.setCell(row, col, isBlocked(generator));
+            }
+        }
+
+        for (uint16_t length = 1; length <= 25; length++)
+        {
+            DFSAlgorithm dfs;
+            CorridorAlgorithm corridor;
+            Path expected = dfs.findViablePath(world, {length}, {});
+            Path actual = corridor.findViablePath(world, {length}, {});
+            assert(expected.isEmpty() == actual.isEmpty());
+            assert(actual.isEmpty() || isViablePath(world, actual, {length}));
+        }
+    }
+
+    std::cout << "✓ Agreement with DFS test passed" << std::endl;
+}
+
+/**
+ * @brief Tests parameter validation
+ */
+void testInvalidParameters()
+{
+    std::cout << "Testing invalid parameters..." << std::endl;
+
+    MatrixWorld world(3, 3);
+    CorridorAlgorithm corridor;
+
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(corridor.findViablePath(world, {0}, {}));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    exceptionThrown = false;
+    try
+    {
+        UNUSED(corridor.findViablePath(world, {10}, {}));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ Invalid parameters test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the corridor algorithm
+ */
+int main()
+{
+    std::cout << "=== Corridor Algorithm Test Suite ===" << std::endl;
+
+    try
+    {
+        testStraightCorridor();
+        testPureCycle();
+        testCellPartition();
+        testAgreesWithDFS();
+        testInvalidParameters();
+
+        std::cout << "\n✅ All Corridor Algorithm tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,204 @@
+/**
+ * @file test_csr_graph.cpp
+ * @brief Unit tests for the CSR graph builder
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Node and cell mappings are inverse permutations of the free cells
+ * - Adjacency is symmetric and matches the 4-connected grid
+ * - Orderings have their defining properties
+ * - Shared graphs are reused per world version
+ */
+
+#include "../test_main.hpp"
+#include "csr_graph.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+/**
+ * @brief Builds a deterministic random world
+ * @param rows Number of rows
+ * @param cols Number of columns
+ * @param seed Random seed
+ */
+static MatrixWorld makeRandomWorld(uint16_t rows, uint16_t cols, unsigned seed)
+{
+    MatrixWorld world(rows, cols);
+    std::mt19937 generator(seed);
+    std::bernoulli_distribution isBlocked(0.3);
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (uint16_t col = 0; col < cols; col++)
+        {
+            world.setCell(row, col, isBlocked(generator));
+        }
+    }
+    return world;
+}
+
+/**
+ * @brief Largest node id difference over all edges
+ * @param graph Graph to measure
+ */
+static uint32_t bandwidth(const CsrGraph &graph)
+{
+    uint32_t result = 0;
+    for (uint32_t node = 0; node < graph.getNodeCount(); node++)
+    {
+        for (uint32_t entry = graph.getOffsets()[node]; entry < graph.getOffsets()[node + 1]; entry++)
+        {
+            uint32_t neighbour = graph.getAdjacency()[entry];
+            result = std::max(result, neighbour > node ? neighbour - node : node - neighbour);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Tests structural invariants for every ordering
+ */
+void testStructure()
+{
+    std::cout << "Testing graph structure..." << std::endl;
+
+    MatrixWorld world = makeRandomWorld(17, 23, 58);
+    for (CellOrdering ordering : {CellOrdering::RowMajor, CellOrdering::BFS, CellOrdering::Hilbert,
+                                  CellOrdering::ReverseCuthillMcKee})
+    {
+        CsrGraph graph(world, ordering);
+        assert(graph.getNodeCount() == world.getNoOfUnblockedCells());
+        assert(graph.getOffsets().size() == graph.getNodeCount() + 1);
+        assert(graph.getOffsets().back() == graph.getAdjacencySize());
+
+        size_t expectedEntries = 0;
+        for (uint16_t row = 0; row < 17; row++)
+        {
+            for (uint16_t col = 0; col < 23; col++)
+            {
+                uint32_t node = graph.getNode(row, col);
+                if (!world.isUnblocked(row, col))
+                {
+                    assert(node == CsrGraph::NO_NODE);
+                    continue;
+                }
+                assert(graph.getCell(node) == std::make_pair(row, col));
+                assert(graph.getDegree(node) == world.countUnblockedNeighbors(row, col));
+                expectedEntries += world.countUnblockedNeighbors(row, col);
+            }
+        }
+        assert(graph.getAdjacencySize() == expectedEntries);
+
+        for (uint32_t node = 0; node < graph.getNodeCount(); node++)
+        {
+            auto first = graph.getAdjacency().begin() + graph.getOffsets()[node];
+            auto last = graph.getAdjacency().begin() + graph.getOffsets()[node + 1];
+            assert(std::is_sorted(first, last));
+            for (auto entry = first; entry != last; ++entry)
+            {
+                // Grid neighbours, and the edge is stored in both directions
+                auto [row, col] = graph.getCell(node);
+                auto [otherRow, otherCol] = graph.getCell(*entry);
+                assert(std::abs(row - otherRow) + std::abs(col - otherCol) == 1);
+                auto backFirst = graph.getAdjacency().begin() + graph.getOffsets()[*entry];
+                auto backLast = graph.getAdjacency().begin() + graph.getOffsets()[*entry + 1];
+                assert(std::binary_search(backFirst, backLast, node));
+            }
+        }
+    }
+
+    std::cout << "✓ Graph structure test passed" << std::endl;
+}
+
+/**
+ * @brief Tests the defining properties of the orderings
+ */
+void testOrderings()
+{
+    std::cout << "Testing orderings..." << std::endl;
+
+    // Row-major keeps scan order
+    MatrixWorld world(4, 60);
+    world.setCell(0, 0, true);
+    CsrGraph rowMajor(world, CellOrdering::RowMajor);
+    assert((rowMajor.getCell(0) == std::pair<uint16_t, uint16_t>{0, 1}));
+    assert(bandwidth(rowMajor) == 60);
+
+    // BFS visits the first free cell first and its neighbours right after
+    CsrGraph breadthFirst(world, CellOrdering::BFS);
+    assert((breadthFirst.getCell(0) == std::pair<uint16_t, uint16_t>{0, 1}));
+    assert(breadthFirst.getNode(0, 2) <= 2 && breadthFirst.getNode(1, 1) <= 2);
+
+    // Hilbert order: consecutive nodes of an open square are grid neighbours
+    MatrixWorld square(16, 16);
+    CsrGraph hilbert(square, CellOrdering::Hilbert);
+    for (uint32_t node = 1; node < hilbert.getNodeCount(); node++)
+    {
+        auto [row, col] = hilbert.getCell(node - 1);
+        auto [nextRow, nextCol] = hilbert.getCell(node);
+        assert(std::abs(row - nextRow) + std::abs(col - nextCol) == 1);
+    }
+
+    // Reverse Cuthill-McKee shrinks the bandwidth of a wide strip
+    CsrGraph reverseCuthillMcKee(world, CellOrdering::ReverseCuthillMcKee);
+    assert(bandwidth(reverseCuthillMcKee) < 10);
+
+    std::cout << "✓ Orderings test passed" << std::endl;
+}
+
+/**
+ * @brief Tests sharing of graphs per world version
+ */
+void testSharedGraphs()
+{
+    std::cout << "Testing shared graphs..." << std::endl;
+
+    MatrixWorld world = makeRandomWorld(10, 10, 7);
+    auto first = CsrGraph::getShared(world);
+    auto second = CsrGraph::getShared(world);
+    assert(first == second);
+    assert(first->getWorldVersion() == world.getVersion());
+
+    auto hilbert = CsrGraph::getShared(world, CellOrdering::Hilbert);
+    assert(hilbert != first);
+    assert(hilbert->getOrdering() == CellOrdering::Hilbert);
+
+    world.setCell(0, 0, world.isUnblocked(0, 0)); // Toggle the cell
+    auto rebuilt = CsrGraph::getShared(world);
+    assert(rebuilt != first);
+    assert(rebuilt->getWorldVersion() == world.getVersion());
+
+    std::cout << "✓ Shared graphs test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the CSR graph builder
+ */
+int main()
+{
+    std::cout << "=== CSR Graph Test Suite ===" << std::endl;
+
+    try
+    {
+        testStructure();
+        testOrderings();
+        testSharedGraphs();
+
+        std::cout << "\n✅ All CSR Graph tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
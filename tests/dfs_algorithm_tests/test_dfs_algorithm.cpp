@@ -7,9 +7,12 @@
  */
 
 #include "../test_main.hpp"
+#include "algorithm_registry.hpp"
 #include "dfs_algorithm.hpp"
+#include "parallel_dfs_algorithm.hpp"
 #include <cassert>
 #include <iostream>
+#include <utility>
 
 /**
  * @brief Tests basic DFS path finding in simple unblocked matrix
@@ -166,6 +169,43 @@ void testExceptionHandling()
     std::cout << "✓ Exception handling test passed" << std::endl;
 }
 
+/**
+ * @brief Tests that the start scoring weights decide the first start tried
+ *
+ * Blocking (1,0) leaves (0,0) as the only dead end of a 4x4 world. The
+ * default ranking tries a degree-4 cell first, the endpoints preset tries
+ * the dead end first. A path of length 3 exists from either, so the first
+ * start tried is the first cell of the returned path.
+ */
+void testStartWeights()
+{
+    std::cout << "Testing start weights..." << std::endl;
+
+    MatrixWorld world(4, 4);
+    world.setCell(1, 0, true);
+    const std::pair<uint16_t, uint16_t> deadEnd{0, 0};
+
+    DFSAlgorithm byDegree;
+    Path degreeFirst = byDegree.findViablePath(world, {3}, {1});
+    assert(degreeFirst.getLength() == 3 && *degreeFirst.begin() != deadEnd);
+
+    DFSAlgorithm byEndpoints(StartScoringWeights::endpoints());
+    Path endpointsFirst = byEndpoints.findViablePath(world, {3}, {1});
+    assert(endpointsFirst.getLength() == 3 && *endpointsFirst.begin() == deadEnd);
+
+    // The parallel engine and the registry entries rank the same way
+    ParallelDFSAlgorithm parallel(1, StartScoringWeights::endpoints());
+    Path parallelFirst = parallel.findViablePath(world, {3});
+    assert(parallelFirst.getLength() == 3 && *parallelFirst.begin() == deadEnd);
+
+    auto registered = AlgorithmRegistry::instance().create("dfs-endpoints");
+    Path registeredFirst = registered->findViablePath(world, {3}, {1});
+    assert(registeredFirst.getLength() == 3 && *registeredFirst.begin() == deadEnd);
+    UNUSED(deadEnd);
+
+    std::cout << "✓ Start weights test passed" << std::endl;
+}
+
 /**
  * @brief Main test runner for DFS algorithm test suite
  * 
@@ -179,6 +219,7 @@ void testExceptionHandling()
  * 2. Path finding with blocked cells (obstacle avoidance)
  * 3. Impossible path scenarios (graceful failure)
  * 4. Exception handling (input validation)
+ * 5. Start scoring weights (first start tried)
  * 
  * @return 0 on success (all tests passed), 1 on failure
  */
@@ -190,6 +231,7 @@ int main()
         testPathFindingWithBlockedCells();
         testImpossiblePath();
         testExceptionHandling();
+        testStartWeights();
 
         std::cout << "\n✅ All DFS Algorithm tests passed successfully!" << std::endl;
         return 0;
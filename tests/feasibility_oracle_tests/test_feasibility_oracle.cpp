@@ -0,0 +1,163 @@
+/**
+ * @file test_feasibility_oracle.cpp
+ * @brief Unit tests for the feasibility oracle
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Feasible requests pass with an empty reason
+ * - Free cell, component, parity and dead-end bounds reject impossible requests
+ * - Engines return empty paths for infeasible requests without searching
+ */
+
+#include "../test_main.hpp"
+#include "auto_algorithm.hpp"
+#include "dfs_algorithm.hpp"
+#include "feasibility_oracle.hpp"
+#include <cassert>
+#include <iostream>
+
+/**
+ * @brief Tests that an open world accepts every length up to its size
+ */
+void testOpenWorldFeasible()
+{
+    std::cout << "Testing open world feasibility..." << std::endl;
+
+    MatrixWorld world(4, 4);
+    FeasibilityResult result = checkPathFeasibility(world, {16});
+    assert(result.isFeasible);
+    assert(result.reason.empty());
+    assert(result.upperBound == 16);
+
+    std::cout << "✓ Open world feasibility test passed" << std::endl;
+}
+
+/**
+ * @brief Tests the free cell and largest component bounds
+ */
+void testComponentBounds()
+{
+    std::cout << "Testing component bounds..." << std::endl;
+
+    // Column 2 blocked: two 3x2 components of 6 cells each
+    MatrixWorld world(3, 5);
+    world.matrixBlanking({{0, 2}, {1, 2}, {2, 2}});
+
+    FeasibilityResult tooManyCells = checkPathFeasibility(world, {13});
+    assert(!tooManyCells.isFeasible);
+    assert(tooManyCells.reason.find("free cells") != std::string::npos);
+
+    FeasibilityResult tooLargeComponent = checkPathFeasibility(world, {7});
+    assert(!tooLargeComponent.isFeasible);
+    assert(tooLargeComponent.reason.find("component") != std::string::npos);
+
+    assert(checkPathFeasibility(world, {6}).isFeasible);
+
+    std::cout << "✓ Component bounds test passed" << std::endl;
+}
+
+/**
+ * @brief Tests the checkerboard parity bound
+ *
+ * A plus-shaped component has four arms of the same colour around a centre
+ * of the other colour: 4 against 1, so at most 3 cells fit in a path.
+ */
+void testParityBound()
+{
+    std::cout << "Testing parity bound..." << std::endl;
+
+    MatrixWorld world(3, 3);
+    world.matrixBlanking({{0, 0}, {0, 2}, {2, 0}, {2, 2}});
+
+    FeasibilityResult result = checkPathFeasibility(world, {4});
+    assert(!result.isFeasible);
+    assert(result.reason.find("parity") != std::string::npos);
+    assert(checkPathFeasibility(world, {3}).isFeasible);
+
+    std::cout << "✓ Parity bound test passed" << std::endl;
+}
+
+/**
+ * @brief Tests the dead-end bound
+ *
+ * A T-shaped component with three arms of two cells: colours are balanced
+ * enough for the parity bound, but only two of the three arm tips can be path
+ * ends, so at most 6 of the 7 cells fit in a path.
+ */
+void testDeadEndBound()
+{
+    std::cout << "Testing dead-end bound..." << std::endl;
+
+    // row 0: # # . # #
+    // row 1: # # . # #
+    // row 2: . . . . .
+    MatrixWorld world(3, 5);
+    world.matrixBlanking({{0, 0}, {0, 1}, {0, 3}, {0, 4}, {1, 0}, {1, 1}, {1, 3}, {1, 4}});
+
+    FeasibilityResult result = checkPathFeasibility(world, {7});
+    assert(!result.isFeasible);
+    assert(result.reason.find("dead-end") != std::string::npos);
+    assert(result.upperBound == 6);
+    assert(checkPathFeasibility(world, {6}).isFeasible);
+
+    std::cout << "✓ Dead-end bound test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that engines short-circuit infeasible requests
+ */
+void testEnginesRejectInfeasible()
+{
+    std::cout << "Testing engines on infeasible requests..." << std::endl;
+
+    // Checkerboard blocking leaves only isolated cells - DFS would try them all
+    MatrixWorld world(20, 20);
+    for (uint16_t row = 0; row < 20; row++)
+    {
+        for (uint16_t col = static_cast<uint16_t>(row % 2); col < 20; col += 2)
+        {
+            world.setCell(row, col, true);
+        }
+    }
+
+    DFSAlgorithm dfs;
+    assert(dfs.findViablePath(world, {2}, {}).isEmpty());
+
+    AutoSelectAlgorithm autoSelect;
+    assert(autoSelect.findViablePath(world, {2}, {}).isEmpty());
+    assert(autoSelect.getLastSelectedEngine().empty());
+
+    std::cout << "✓ Engines on infeasible requests test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the feasibility oracle
+ */
+int main()
+{
+    std::cout << "=== Feasibility Oracle Test Suite ===" << std::endl;
+
+    try
+    {
+        testOpenWorldFeasible();
+        testComponentBounds();
+        testParityBound();
+        testDeadEndBound();
+        testEnginesRejectInfeasible();
+
+        std::cout << "\n✅ All Feasibility Oracle tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
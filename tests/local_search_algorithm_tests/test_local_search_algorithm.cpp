@@ -0,0 +1,165 @@
+/**
+ * @file test_local_search_algorithm.cpp
+ * @brief Unit tests for the detour insertion local search
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Extension of a straight seed with U-shaped detours
+ * - End extension when no detour applies
+ * - Stuck searches returning an empty path
+ * - Seed validation and greedy seed construction
+ * - findViablePath() end to end
+ */
+
+#include "../test_main.hpp"
+#include "local_search_algorithm.hpp"
+#include "path_validation.hpp"
+#include <cassert>
+#include <iostream>
+
+/**
+ * @brief Tests growing a straight seed with detours
+ *
+ * A straight seed along the first row of an open 4x4 world can only grow
+ * through detours into the rows below.
+ */
+void testDetourExtension()
+{
+    std::cout << "Testing detour extension..." << std::endl;
+
+    MatrixWorld world(4, 4);
+    Path seed;
+    for (uint16_t col = 0; col < 4; col++)
+    {
+        seed.addCoordinate(0, col);
+    }
+
+    LocalSearchAlgorithm localSearch;
+    Path path = localSearch.extendPath(world, seed, {14});
+    assert(isViablePath(world, path, {14}));
+
+    std::cout << "✓ Detour extension test passed" << std::endl;
+}
+
+/**
+ * @brief Tests end extension in a one-cell wide corridor
+ *
+ * Detours are impossible in a 1xN world; the path must grow at its ends.
+ */
+void testEndExtension()
+{
+    std::cout << "Testing end extension..." << std::endl;
+
+    MatrixWorld world(1, 9);
+    Path seed;
+    seed.addCoordinate(0, 4);
+
+    LocalSearchAlgorithm localSearch;
+    Path path = localSearch.extendPath(world, seed, {9});
+    assert(isViablePath(world, path, {9}));
+
+    std::cout << "✓ End extension test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that a stuck search returns an empty path
+ */
+void testStuckSearch()
+{
+    std::cout << "Testing stuck search..." << std::endl;
+
+    MatrixWorld world(1, 5);
+    world.setCell(0, 2, true);
+    Path seed;
+    seed.addCoordinate(0, 0);
+
+    LocalSearchAlgorithm localSearch;
+    Path path = localSearch.extendPath(world, seed, {3});
+    assert(path.isEmpty());
+
+    std::cout << "✓ Stuck search test passed" << std::endl;
+}
+
+/**
+ * @brief Tests seed validation and greedy seed construction
+ */
+void testSeeds()
+{
+    std::cout << "Testing seeds..." << std::endl;
+
+    MatrixWorld world(3, 3);
+    Path broken;
+    broken.addCoordinate(0, 0);
+    broken.addCoordinate(2, 2);
+
+    LocalSearchAlgorithm localSearch;
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(localSearch.extendPath(world, broken, {4}));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    // Warnsdorff walk covers the whole open 3x3 world from a corner
+    Path greedy = LocalSearchAlgorithm::buildGreedySeed(world, 0, 0, 9);
+    assert(isViablePath(world, greedy, {9}));
+
+    std::cout << "✓ Seeds test passed" << std::endl;
+}
+
+/**
+ * @brief Tests findViablePath() on a world with obstacles
+ */
+void testFindViablePath()
+{
+    std::cout << "Testing findViablePath..." << std::endl;
+
+    MatrixWorld world(10, 10);
+    for (uint16_t row = 0; row < 8; row++)
+    {
+        world.setCell(row, 3, true);
+        world.setCell(static_cast<uint16_t>(row + 2), 6, true);
+    }
+
+    LocalSearchAlgorithm localSearch;
+    Path path = localSearch.findViablePath(world, {70}, {5});
+    assert(isViablePath(world, path, {70}));
+
+    std::cout << "✓ findViablePath test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the local search algorithm
+ */
+int main()
+{
+    std::cout << "=== Local Search Algorithm Test Suite ===" << std::endl;
+
+    try
+    {
+        testDetourExtension();
+        testEndExtension();
+        testStuckSearch();
+        testSeeds();
+        testFindViablePath();
+
+        std::cout << "\n✅ All Local Search Algorithm tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
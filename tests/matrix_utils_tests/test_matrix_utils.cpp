@@ -10,6 +10,7 @@
  * - Exception handling for invalid inputs
  * - Cell state management and operations
  * - Neighbor counting algorithms
+ * - Content versioning
  */
 
 #include <cassert>
@@ -282,6 +283,116 @@ void testSetCellSameState() {
     std::cout << "✓ testSetCellSameState passed\n";
 }
 
+/**
+ * @brief Tests the content version of the matrix
+ * 
+ * Validates that:
+ * - Distinct worlds never share a version
+ * - Every mutation yields a new version, no-op writes keep it
+ * - Copies keep the version of their source
+ */
+void testVersion() {
+    std::cout << "Running testVersion...\n";
+    
+    MatrixWorld first(3, 3);
+    MatrixWorld second(3, 3);
+    assert(first.getVersion() != second.getVersion());
+    
+    uint64_t version = first.getVersion();
+    assert(first.setCell(1, 1, false) == true);   // No change - same version
+    assert(first.getVersion() == version);
+    
+    assert(first.setCell(1, 1, true) == true);    // Blocked - new version
+    assert(first.getVersion() != version);
+    
+    MatrixWorld copy = first;
+    assert(copy.getVersion() == first.getVersion());
+    
+    version = first.getVersion();
+    assert(first.clearMatrix() == true);
+    assert(first.getVersion() != version);
+    
+    version = first.getVersion();
+    assert(first.matrixResize(4, 4) == true);
+    assert(first.getVersion() != version);
+    
+    std::cout << "✓ testVersion passed\n";
+}
+
+/**
+ * @brief Tests the packed row words
+ * 
+ * Validates that:
+ * - Rows take (cols + 63) / 64 words
+ * - Blocked cells set their bit, padding bits read as blocked
+ * - Clearing and resizing restore the padding
+ */
+void testRowWords() {
+    std::cout << "Running testRowWords...\n";
+    
+    MatrixWorld world(3, 70);
+    assert(world.getWordsPerRow() == 2);
+    const uint64_t padding = ~uint64_t{0} << 6;
+    assert(world.getRowWords(1)[0] == 0);
+    assert(world.getRowWords(1)[1] == padding);
+    
+    world.setCell(1, 0, true);
+    world.setCell(1, 69, true);
+    assert(world.getRowWords(1)[0] == 1);
+    assert(world.getRowWords(1)[1] == (padding | (uint64_t{1} << 5)));
+    assert(world.getRowWords(0)[0] == 0);
+    assert(world.getRowWords(2)[1] == padding);
+    
+    world.clearMatrix();
+    assert(world.getRowWords(1)[1] == padding);
+    
+    world.matrixResize(2, 64);
+    assert(world.getWordsPerRow() == 1);
+    assert(world.getRowWords(1)[0] == 0);
+    
+    bool exceptionThrown = false;
+    try {
+        UNUSED(world.getRowWords(2));
+    } catch (const std::invalid_argument&) {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+    
+    std::cout << "✓ testRowWords passed\n";
+}
+
+/**
+ * @brief Tests blocking a band of rows from packed words
+ * 
+ * Validates that:
+ * - Only the band's rows change, padding bits are ignored
+ * - Counters and version follow the newly blocked cells only
+ * - Bands past the last row are rejected
+ */
+void testBlankingRows() {
+    std::cout << "Running testBlankingRows...\n";
+    
+    MatrixWorld world(4, 70);
+    world.setCell(2, 0, true);
+    const std::vector<uint64_t> band = {1, ~uint64_t{0}, 0b11, 0};
+    uint64_t version = world.getVersion();
+    assert(world.matrixBlankingRows(1, band.data(), 2));
+    assert(world.getNoOfBlockedCells() == 1 + 1 + 6 + 1);
+    assert(world.getVersion() != version);
+    assert(!world.isUnblocked(1, 69) && !world.isUnblocked(2, 1));
+    assert(world.isUnblocked(0, 0) && world.isUnblocked(3, 0));
+    
+    // Nothing new: no version change
+    version = world.getVersion();
+    assert(world.matrixBlankingRows(1, band.data(), 2));
+    assert(world.getVersion() == version);
+    
+    assert(!world.matrixBlankingRows(3, band.data(), 2));
+    assert(world.getNoOfBlockedCells() == 9);
+    
+    std::cout << "✓ testBlankingRows passed\n";
+}
+
 /**
  * @brief Main test runner - executes all MatrixWorld test cases
  * 
@@ -303,6 +414,9 @@ int main() {
     testCountUnblockedNeighbors();
     testErrorHandling();
     testSetCellSameState();
+    testVersion();
+    testRowWords();
+    testBlankingRows();
     
     std::cout << "All MatrixUtils tests passed!\n";
     return 0;
@@ -0,0 +1,216 @@
+/**
+ * @file test_moving_ai.cpp
+ * @brief Unit tests for the MovingAI .map/.scen loaders and scenario runner
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - .map terrain decoding and header/grid errors
+ * - .scen parsing, version line, CRLF and range errors
+ * - Scenario runs: validity counts, percentiles, map mismatch
+ */
+
+#include "../test_main.hpp"
+#include "dfs_algorithm.hpp"
+#include "moving_ai.hpp"
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Engine answering every query with the same fixed path
+ */
+class FixedPathAlgorithm : public PathAlgorithm
+{
+    Path answer;
+
+public:
+    explicit FixedPathAlgorithm(Path answer) : answer(std::move(answer)) {}
+
+    Path findViablePath(const MatrixWorld &, PathLength, MaxStartingPoints) override
+    {
+        return answer;
+    }
+
+    [[nodiscard]] std::string getAlgorithmName() const override
+    {
+        return "Fixed";
+    }
+};
+
+const std::string SAMPLE_MAP = "type octile\r\nheight 3\r\nwidth 5\r\nmap\r\n"
+                               ".G@S.\r\n"
+                               "TTW..\r\n"
+                               "O....\r\n";
+
+/**
+ * @brief Tests .map decoding
+ */
+void testMapDecoding()
+{
+    std::cout << "Testing map decoding..." << std::endl;
+
+    MatrixWorld world = loadMovingAiMap(SAMPLE_MAP);
+    assert(world.getColSize() == 3);
+    assert(world.getRowSize() == 5);
+    assert(world.isUnblocked(0, 0) && world.isUnblocked(0, 1) && world.isUnblocked(0, 3));
+    assert(!world.isUnblocked(0, 2));
+    assert(!world.isUnblocked(1, 0) && !world.isUnblocked(1, 1) && !world.isUnblocked(1, 2));
+    assert(!world.isUnblocked(2, 0) && world.isUnblocked(2, 4));
+    assert(world.getNoOfBlockedCells() == 5);
+
+    const std::vector<std::pair<std::string, std::string>> cases = {
+        {"type octile\nheight 2\nwidth 2\n..\n..\n", "line 4"},
+        {"type octile\nwidth 2\nmap\n..\n", "line 3"},
+        {"type octile\nheight 2\nwidth 2\nmap\n..\n...\n", "line 6"},
+        {"type octile\nheight 3\nwidth 2\nmap\n..\n..\n", "fewer rows"},
+        {"type octile\nheight 70000\nwidth 2\nmap\n", "height and width"}};
+    for (const auto &[text, expected] : cases)
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            UNUSED(loadMovingAiMap(text));
+        }
+        catch (const std::invalid_argument &e)
+        {
+            exceptionThrown = std::string(e.what()).find(expected) != std::string::npos;
+        }
+        assert(exceptionThrown);
+    }
+
+    std::cout << "✓ Map decoding test passed" << std::endl;
+}
+
+/**
+ * @brief Tests .scen parsing
+ */
+void testScenarioParsing()
+{
+    std::cout << "Testing scenario parsing..." << std::endl;
+
+    std::vector<ScenarioEntry> scenarios =
+        loadScenarios("version 1\r\n0\tsample.map\t5\t3\t0\t0\t4\t2\t5.82842712\r\n\n"
+                      "1\tsample.map\t5\t3\t3\t0\t4\t1\t1.41421356");
+    assert(scenarios.size() == 2);
+    assert(scenarios[0].bucket == 0 && scenarios[0].mapName == "sample.map");
+    assert(scenarios[0].mapWidth == 5 && scenarios[0].mapHeight == 3);
+    assert(scenarios[0].goalX == 4 && scenarios[0].goalY == 2);
+    assert(scenarios[1].startX == 3 && scenarios[1].bucket == 1);
+    assert(scenarioPathLength(scenarios[0]).value == 6);
+    assert(scenarioPathLength(scenarios[1]).value == 2);
+
+    const std::vector<std::pair<std::string, std::string>> cases = {
+        {"version 1\n0 m 5 3 0 0 4 2\n", "line 2"},
+        {"0 m 5 3 0 0 4 2 1.0 extra\n", "line 1"},
+        {"0 m 5 3 0 0 5 2 1.0\n", "outside the map at line 1"},
+        {"0 m 5 -3 0 0 4 2 1.0\n", "line 1"}};
+    for (const auto &[text, expected] : cases)
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            UNUSED(loadScenarios(text));
+        }
+        catch (const std::invalid_argument &e)
+        {
+            exceptionThrown = std::string(e.what()).find(expected) != std::string::npos;
+        }
+        assert(exceptionThrown);
+    }
+
+    std::cout << "✓ Scenario parsing test passed" << std::endl;
+}
+
+/**
+ * @brief Tests scenario runs and their report
+ */
+void testScenarioRun()
+{
+    std::cout << "Testing scenario run..." << std::endl;
+
+    MatrixWorld world = loadMovingAiMap(SAMPLE_MAP);
+    std::vector<ScenarioEntry> scenarios;
+    for (int query = 0; query < 10; query++)
+    {
+        ScenarioEntry entry;
+        entry.mapWidth = 5;
+        entry.mapHeight = 3;
+        entry.optimalLength = query % 4;
+        scenarios.push_back(entry);
+    }
+
+    DFSAlgorithm dfs;
+    ScenarioReport report = runScenarios(world, scenarios, dfs, {5});
+    assert(report.queries == 10);
+    assert(report.solved == 10);
+    assert(report.invalid == 0);
+    assert(report.p50Micros <= report.p90Micros && report.p90Micros <= report.p99Micros);
+    assert(report.p99Micros <= report.maxMicros);
+    assert(report.queriesPerSecond > 0.0);
+
+    // A path through a blocked cell is counted as invalid, an empty one as unsolved
+    Path blockedPath;
+    blockedPath.addCoordinate(0, 1);
+    blockedPath.addCoordinate(0, 2);
+    FixedPathAlgorithm blocked(blockedPath);
+    scenarios.resize(2);
+    scenarios[0].optimalLength = 1.0;
+    scenarios[1].optimalLength = 1.0;
+    report = runScenarios(world, scenarios, blocked, {5});
+    assert(report.solved == 0 && report.invalid == 2);
+
+    FixedPathAlgorithm empty{Path()};
+    report = runScenarios(world, scenarios, empty, {5});
+    assert(report.solved == 0 && report.invalid == 0);
+
+    // Empty runs report zeros
+    report = runScenarios(world, {}, dfs, {5});
+    assert(report.queries == 0 && report.maxMicros == 0.0);
+
+    // Queries for another map are rejected before anything runs
+    scenarios[1].mapWidth = 6;
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(runScenarios(world, scenarios, dfs, {5}));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = std::string(e.what()).find("Scenario 2") != std::string::npos;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ Scenario run test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the MovingAI benchmark support
+ */
+int main()
+{
+    std::cout << "=== MovingAI Benchmark Test Suite ===" << std::endl;
+
+    try
+    {
+        testMapDecoding();
+        testScenarioParsing();
+        testScenarioRun();
+
+        std::cout << "\n✅ All MovingAI Benchmark tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
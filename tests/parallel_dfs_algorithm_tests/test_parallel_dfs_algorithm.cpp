@@ -0,0 +1,159 @@
+/**
+ * @file test_parallel_dfs_algorithm.cpp
+ * @brief Unit tests for the multi-threaded DFS
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Found paths are viable
+ * - The parallel search agrees with the sequential DFS on random worlds
+ * - Cancellation stops all workers
+ * - Invalid parameters are rejected
+ */
+
+#include "../test_main.hpp"
+#include "dfs_algorithm.hpp"
+#include "parallel_dfs_algorithm.hpp"
+#include "path_validation.hpp"
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <random>
+
+/**
+ * @brief Tests a simple search on an open world
+ */
+void testOpenWorld()
+{
+    std::cout << "Testing open world search..." << std::endl;
+
+    MatrixWorld world(6, 6);
+    ParallelDFSAlgorithm parallelDfs(4);
+    assert(parallelDfs.getThreadCount() == 4);
+
+    Path path = parallelDfs.findViablePath(world, {20}, {});
+    assert(isViablePath(world, path, {20}));
+
+    ParallelDFSAlgorithm defaultThreads;
+    assert(defaultThreads.getThreadCount() >= 1);
+
+    std::cout << "✓ Open world search test passed" << std::endl;
+}
+
+/**
+ * @brief Tests agreement with the sequential DFS on random small worlds
+ */
+void testAgreesWithDFS()
+{
+    std::cout << "Testing agreement with DFS..." << std::endl;
+
+    std::mt19937 generator(60);
+    std::bernoulli_distribution isBlocked(0.35);
+    for (int round = 0; round < 20; round++)
+    {
+        MatrixWorld world(5, 5);
+        for (uint16_t row = 0; row < 5; row++)
+        {
+            for (uint16_t col = 0; col < 5; col++)
+            {
+                world.setCell(row, col, isBlocked(generator));
+            }
+        }
+
+        for (uint16_t length = 1; length <= 25; length += 3)
+        {
+            DFSAlgorithm dfs;
+            ParallelDFSAlgorithm parallelDfs(3);
+            Path expected = dfs.findViablePath(world, {length}, {});
+            Path actual = parallelDfs.findViablePath(world, {length}, {});
+            assert(expected.isEmpty() == actual.isEmpty());
+            assert(actual.isEmpty() || isViablePath(world, actual, {length}));
+        }
+    }
+
+    std::cout << "✓ Agreement with DFS test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that a raised cancellation flag ends the search
+ *
+ * Workers check the engine flag before claiming a starting point, so a flag
+ * raised up front yields an empty path even though one exists.
+ */
+void testCancellation()
+{
+    std::cout << "Testing cancellation..." << std::endl;
+
+    MatrixWorld world(12, 12);
+    std::atomic<bool> cancelled{true};
+    ParallelDFSAlgorithm parallelDfs(2);
+    parallelDfs.setCancellationFlag(&cancelled);
+    assert(parallelDfs.findViablePath(world, {144}, {}).isEmpty());
+
+    std::cout << "✓ Cancellation test passed" << std::endl;
+}
+
+/**
+ * @brief Tests parameter validation
+ */
+void testInvalidParameters()
+{
+    std::cout << "Testing invalid parameters..." << std::endl;
+
+    MatrixWorld world(3, 3);
+    ParallelDFSAlgorithm parallelDfs(2);
+
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(parallelDfs.findViablePath(world, {0}, {}));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    exceptionThrown = false;
+    try
+    {
+        UNUSED(parallelDfs.findViablePath(world, {10}, {}));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ Invalid parameters test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the parallel DFS
+ */
+int main()
+{
+    std::cout << "=== Parallel DFS Algorithm Test Suite ===" << std::endl;
+
+    try
+    {
+        testOpenWorld();
+        testAgreesWithDFS();
+        testCancellation();
+        testInvalidParameters();
+
+        std::cout << "\n✅ All Parallel DFS Algorithm tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -7,15 +7,23 @@
  * 
  * Comprehensive test suite validating PathFinderUtils class operations including:
  * - Starting point candidate selection and scoring
- * - Priority queue state management and exhaustion handling
+ * - Ranking cursor state management and exhaustion handling
  * - Exception handling for invalid inputs and edge cases
- * - Multi-call scenarios with stateful priority queue
+ * - Multi-call scenarios with stateful cursor
+ * - Bucket-sorted CandidateRanking order and sharing per world version
+ * - Weighted multi-criteria start scoring
+ * - Incremental ranking patches after world mutations
+ * - Lazy candidate ranges and the shared atomic cursor
  */
 
 #include "../test_main.hpp"
 #include "path_finder_utils.hpp"
+#include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <random>
+#include <set>
+#include <thread>
 #include <vector>
 
 /**
@@ -311,6 +319,374 @@ void testGetIsExhausted()
     std::cout << "✓ getIsExhausted test passed" << std::endl;
 }
 
+/**
+ * @brief Tests the bucket order of CandidateRanking
+ * 
+ * Validates that:
+ * - Scores never increase along the ranking
+ * - Ties keep row-major order
+ * - Bucket starts delimit the scores
+ */
+void testCandidateRankingOrder()
+{
+    std::cout << "Testing candidate ranking order..." << std::endl;
+
+    MatrixWorld world(4, 5);
+    world.setCell(1, 1, true);
+    world.setCell(2, 3, true);
+
+    CandidateRanking ranking(world);
+    assert(ranking.size() == 18);
+    assert(ranking.getBucketStart(CandidateRanking::MAX_SCORE) == 0);
+
+    for (size_t rank = 1; rank < ranking.size(); rank++)
+    {
+        auto [row, col] = ranking.getCell(rank);
+        auto [previousRow, previousCol] = ranking.getCell(rank - 1);
+        uint16_t score = world.countUnblockedNeighbors(row, col);
+        uint16_t previousScore = world.countUnblockedNeighbors(previousRow, previousCol);
+        assert(score <= previousScore);
+        if (score == previousScore)
+        {
+            assert(ranking.getIndex(rank) > ranking.getIndex(rank - 1));
+        }
+        assert(rank >= ranking.getBucketStart(static_cast<uint8_t>(score)));
+    }
+
+    // No cell keeps four neighbours; (0,2) is the first cell with three
+    assert(ranking.getBucketStart(3) == 0);
+    assert((ranking.getCell(0) == std::pair<uint16_t, uint16_t>{0, 2}));
+
+    std::cout << "✓ Candidate ranking order test passed" << std::endl;
+}
+
+/**
+ * @brief Tests the word-parallel, banded scoring on a large world
+ * 
+ * The world is large enough to be scored on several threads and its row
+ * width is not a multiple of 64, so the ranking must match a scalar
+ * row-major counting sort exactly.
+ */
+void testLargeWorldRanking()
+{
+    std::cout << "Testing large world ranking..." << std::endl;
+
+    const uint16_t rows = 300;
+    const uint16_t cols = 301;
+    MatrixWorld world(rows, cols);
+    std::mt19937 generator(61);
+    std::bernoulli_distribution isBlocked(0.3);
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (uint16_t col = 0; col < cols; col++)
+        {
+            world.setCell(row, col, isBlocked(generator));
+        }
+    }
+
+    std::vector<std::vector<uint32_t>> buckets(CandidateRanking::MAX_SCORE + 1);
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (uint16_t col = 0; col < cols; col++)
+        {
+            if (world.isUnblocked(row, col))
+            {
+                buckets[world.countUnblockedNeighbors(row, col)].push_back((row * cols) + col);
+            }
+        }
+    }
+
+    CandidateRanking ranking(world);
+    assert(ranking.size() == world.getNoOfUnblockedCells());
+    size_t rank = 0;
+    for (int score = CandidateRanking::MAX_SCORE; score >= 0; score--)
+    {
+        assert(ranking.getBucketStart(static_cast<uint8_t>(score)) == rank);
+        for (uint32_t index : buckets[score])
+        {
+            assert(ranking.getIndex(rank++) == index);
+        }
+    }
+
+    std::cout << "✓ Large world ranking test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that rankings are shared per world version
+ */
+void testSharedRanking()
+{
+    std::cout << "Testing shared ranking..." << std::endl;
+
+    MatrixWorld world(6, 6);
+    auto first = CandidateRanking::getShared(world);
+    auto second = CandidateRanking::getShared(world);
+    assert(first == second);
+
+    world.setCell(3, 3, true);
+    auto rebuilt = CandidateRanking::getShared(world);
+    assert(rebuilt != first);
+    assert(rebuilt->getWorldVersion() == world.getVersion());
+    assert(rebuilt->size() == 35);
+
+    // Independent cursors over the same shared ranking
+    PathFinderUtils firstQuery;
+    PathFinderUtils secondQuery;
+    auto firstBatch = firstQuery.findStartingPointCandidates(world, 3);
+    auto secondBatch = secondQuery.findStartingPointCandidates(world, 3);
+    assert(firstBatch == secondBatch);
+
+    std::cout << "✓ Shared ranking test passed" << std::endl;
+}
+
+/**
+ * @brief Tests lazy batches larger than 255 candidates
+ * 
+ * Validates that:
+ * - Batch sizes above 255 are honoured (no 8-bit wrap-around)
+ * - Lazy ranges and vector batches return the same candidates
+ */
+void testLargeLazyBatches()
+{
+    std::cout << "Testing large lazy batches..." << std::endl;
+
+    MatrixWorld world(30, 30);
+    PathFinderUtils lazyFinder;
+    CandidateRange batch = lazyFinder.nextCandidates(world, 300);
+    assert(batch.size() == 300);
+    assert(!lazyFinder.getIsExhausted());
+
+    PathFinderUtils vectorFinder;
+    auto candidates = vectorFinder.findStartingPointCandidates(world, 300);
+    assert(candidates.size() == 300);
+    assert(std::equal(batch.begin(), batch.end(), candidates.begin()));
+
+    CandidateRange rest = lazyFinder.nextCandidates(world, 900);
+    assert(rest.size() == 600);
+    assert(lazyFinder.getIsExhausted());
+
+    std::cout << "✓ Large lazy batches test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that concurrent claims hand out every candidate exactly once
+ */
+void testSharedCandidateCursor()
+{
+    std::cout << "Testing shared candidate cursor..." << std::endl;
+
+    MatrixWorld world(40, 40);
+    world.setCell(5, 5, true);
+    SharedCandidateCursor cursor(CandidateRanking::getShared(world));
+
+    std::vector<std::vector<std::pair<uint16_t, uint16_t>>> claimed(4);
+    std::vector<std::thread> workers;
+    for (auto &own : claimed)
+    {
+        workers.emplace_back([&cursor, &own] {
+            while (auto cell = cursor.claim())
+            {
+                own.push_back(*cell);
+            }
+        });
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    std::set<std::pair<uint16_t, uint16_t>> unique;
+    size_t total = 0;
+    for (const auto &own : claimed)
+    {
+        unique.insert(own.begin(), own.end());
+        total += own.size();
+    }
+    assert(total == 1599);
+    assert(unique.size() == 1599);
+    assert(!cursor.claim());
+
+    // Limited cursor
+    SharedCandidateCursor limited(CandidateRanking::getShared(world), 2);
+    assert(limited.claim() && limited.claim() && !limited.claim());
+
+    std::cout << "✓ Shared candidate cursor test passed" << std::endl;
+}
+
+/**
+ * @brief Tests weighted start scoring on a closet next to a hall
+ * 
+ * A plus-shaped closet of five cells is walled off from an open 7x8 hall.
+ * Its centre has four neighbours like any hall cell, so the neighbour count
+ * ranks it first; component size and local area must rank the hall first.
+ */
+void testWeightedScoring()
+{
+    std::cout << "Testing weighted scoring..." << std::endl;
+
+    MatrixWorld world(7, 12);
+    for (uint16_t row = 0; row < 7; row++)
+    {
+        for (uint16_t col = 0; col < 4; col++)
+        {
+            world.setCell(row, col, true);
+        }
+    }
+    for (auto [row, col] : std::vector<std::pair<uint16_t, uint16_t>>{{0, 1}, {1, 0}, {1, 1}, {1, 2}, {2, 1}})
+    {
+        world.setCell(row, col, false);
+    }
+
+    PathFinderUtils byDegree;
+    assert((byDegree.findStartingPointCandidates(world, 1)[0] == std::pair<uint16_t, uint16_t>{1, 1}));
+
+    PathFinderUtils byOpenArea(StartScoringWeights::openArea());
+    auto candidates = byOpenArea.findStartingPointCandidates(world, 10);
+    for (const auto &candidate : candidates)
+    {
+        assert(candidate.second >= 4);
+    }
+
+    auto ranking = CandidateRanking::getShared(world, StartScoringWeights::openArea());
+    assert(ranking != CandidateRanking::getShared(world));
+    assert(ranking->getMaxScore() == 24);
+    assert(ranking->size() == world.getNoOfUnblockedCells());
+    assert(ranking->getBucketStart(0) <= ranking->size());
+
+    // Dead-end distance alone: arms are dead ends, the centre is one step away
+    std::vector<uint8_t> degrees(world.getTotalCells(), CandidateRanking::MAX_SCORE + 1);
+    for (uint16_t row = 0; row < 7; row++)
+    {
+        for (uint16_t col = 0; col < 12; col++)
+        {
+            if (world.isUnblocked(row, col))
+            {
+                degrees[(row * 12) + col] = static_cast<uint8_t>(world.countUnblockedNeighbors(row, col));
+            }
+        }
+    }
+    StartScoringWeights deadEnds{0, 0, 0, 1, 0};
+    auto scores = computeStartScores(world, degrees, deadEnds);
+    assert(scores[1] == 0);
+    assert(scores[13] == 1);
+    assert(scores[(3 * 12) + 8] == StartScoringWeights::FEATURE_LEVELS);
+    assert(scores[0] == NO_START_SCORE);
+
+    // Endpoint bonus goes to degree-1 cells only
+    auto endpointScores = computeStartScores(world, degrees, {0, 0, 0, 0, 1});
+    assert(endpointScores[1] == StartScoringWeights::FEATURE_LEVELS);
+    assert(endpointScores[13] == 0);
+
+    std::cout << "✓ Weighted scoring test passed" << std::endl;
+}
+
+/**
+ * @brief Tests patching a ranking after cells change state
+ * 
+ * Validates that:
+ * - A patched ranking equals a ranking rebuilt from scratch
+ * - The patched ranking is the one shared for the new world version
+ * - Weighted rankings are rebuilt instead of patched
+ */
+void testPatchedRanking()
+{
+    std::cout << "Testing patched ranking..." << std::endl;
+
+    MatrixWorld world(40, 70);
+    std::mt19937 generator(63);
+    std::bernoulli_distribution isBlocked(0.25);
+    std::uniform_int_distribution<int> rowDistribution(0, 39);
+    std::uniform_int_distribution<int> colDistribution(0, 69);
+    for (uint16_t row = 0; row < 40; row++)
+    {
+        for (uint16_t col = 0; col < 70; col++)
+        {
+            world.setCell(row, col, isBlocked(generator));
+        }
+    }
+
+    auto ranking = CandidateRanking::getShared(world);
+    for (int round = 0; round < 5; round++)
+    {
+        std::vector<std::pair<uint16_t, uint16_t>> changedCells;
+        for (int change = 0; change < 6; change++)
+        {
+            auto row = static_cast<uint16_t>(rowDistribution(generator));
+            auto col = static_cast<uint16_t>(colDistribution(generator));
+            world.setCell(row, col, world.isUnblocked(row, col));
+            changedCells.emplace_back(row, col);
+        }
+
+        auto patched = CandidateRanking::getPatched(world, *ranking, changedCells);
+        assert(patched->getWorldVersion() == world.getVersion());
+        assert(CandidateRanking::getShared(world) == patched);
+
+        CandidateRanking rebuilt(world);
+        assert(patched->size() == rebuilt.size());
+        for (size_t rank = 0; rank < rebuilt.size(); rank++)
+        {
+            assert(patched->getIndex(rank) == rebuilt.getIndex(rank));
+        }
+        for (uint8_t score = 0; score <= CandidateRanking::MAX_SCORE; score++)
+        {
+            assert(patched->getBucketStart(score) == rebuilt.getBucketStart(score));
+        }
+        ranking = patched;
+    }
+
+    // Pruned rankings filter the patched order with the new world's symmetries
+    MatrixWorld mirrored(12, 16);
+    auto unpruned = CandidateRanking::getShared(mirrored);
+    const std::vector<std::vector<std::pair<uint16_t, uint16_t>>> mirroredChanges = {
+        {{2, 3}, {2, 12}, {9, 3}, {9, 12}}, // Keeps both mirrors
+        {{5, 5}, {5, 10}},                  // Keeps the vertical mirror only
+        {{0, 0}}};                          // Breaks every symmetry
+    for (const auto &changedCells : mirroredChanges)
+    {
+        for (const auto &[row, col] : changedCells)
+        {
+            mirrored.setCell(row, col, true);
+        }
+
+        auto pruned = CandidateRanking::getPatched(mirrored, *unpruned, changedCells, StartPruning::Symmetry);
+        assert(pruned->getPruning() == StartPruning::Symmetry);
+        assert(CandidateRanking::getShared(mirrored, {}, StartPruning::Symmetry) == pruned);
+
+        CandidateRanking rebuilt(mirrored, {}, StartPruning::Symmetry);
+        assert(pruned->size() == rebuilt.size());
+        for (size_t rank = 0; rank < rebuilt.size(); rank++)
+        {
+            assert(pruned->getIndex(rank) == rebuilt.getIndex(rank));
+        }
+        for (uint8_t score = 0; score <= CandidateRanking::MAX_SCORE; score++)
+        {
+            assert(pruned->getBucketStart(score) == rebuilt.getBucketStart(score));
+        }
+        unpruned = CandidateRanking::getShared(mirrored);
+        assert(unpruned->getPruning() == StartPruning::None && unpruned->size() >= pruned->size());
+    }
+
+    auto weighted = CandidateRanking::getShared(world, StartScoringWeights::openArea());
+    world.setCell(0, 0, world.isUnblocked(0, 0));
+    auto rebuiltWeighted = CandidateRanking::getPatched(world, *weighted, {{0, 0}});
+    assert(rebuiltWeighted->getWeights() == StartScoringWeights::openArea());
+    assert(rebuiltWeighted->getWorldVersion() == world.getVersion());
+
+    MatrixWorld other(10, 10);
+    bool exceptionThrown = false;
+    try
+    {
+        CandidateRanking mismatched(*ranking, other, {});
+    }
+    catch (const std::invalid_argument &)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ Patched ranking test passed" << std::endl;
+}
+
 /**
  * @brief Main test runner for PathFinderUtils
  * 
@@ -330,6 +706,13 @@ int main()
         testExceptionHandling();
         testScoringAlgorithm();
         testGetIsExhausted();
+        testCandidateRankingOrder();
+        testSharedRanking();
+        testWeightedScoring();
+        testPatchedRanking();
+        testLargeWorldRanking();
+        testLargeLazyBatches();
+        testSharedCandidateCursor();
 
         std::cout << "\n✅ All PathFinderUtils tests passed successfully!" << std::endl;
         return 0;
@@ -0,0 +1,218 @@
+/**
+ * @file test_path_repair.cpp
+ * @brief Unit tests for local path repair
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Untouched paths are returned unchanged
+ * - Blocked path cells are bridged locally keeping the required length
+ * - Unbridgeable gaps fall back to the longer segment plus re-extension
+ * - Failure within budget yields an empty path
+ * - Out of bounds changed cells do not cut aliased path cells
+ * - Exception handling for invalid lengths
+ */
+
+#include "../test_main.hpp"
+#include "path_repair.hpp"
+#include "path_validation.hpp"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+
+/**
+ * @brief Builds a boustrophedon path covering the first 'rows' rows of a world
+ * @param rows Number of rows to cover
+ * @param cols Number of columns of the world
+ * @return Snake path visiting every cell of the covered rows
+ */
+static Path buildSnakePath(uint16_t rows, uint16_t cols)
+{
+    Path path;
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (uint16_t step = 0; step < cols; step++)
+        {
+            uint16_t col = (row % 2 == 0) ? step : static_cast<uint16_t>(cols - 1 - step);
+            path.addCoordinate(row, col);
+        }
+    }
+    return path;
+}
+
+/**
+ * @brief Tests that a path unaffected by the mutations is kept as is
+ */
+void testUnaffectedPath()
+{
+    std::cout << "Testing unaffected path..." << std::endl;
+
+    MatrixWorld world(6, 6);
+    Path previous = buildSnakePath(2, 6);
+    world.setCell(5, 5, true); // Far away from the path
+
+    PathRepair repair;
+    Path repaired = repair.repairPath(world, previous, {{5, 5}}, {12});
+    assert(isViablePath(world, repaired, {12}));
+    assert(std::equal(repaired.begin(), repaired.end(), previous.begin()));
+    assert(repair.getLastExpansions() == 0);
+
+    std::cout << "✓ Unaffected path test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that out of bounds changed cells are ignored
+ *
+ * (0, cols + 1) would index the in-bounds path cell (1, 1) if it were not
+ * skipped, cutting a path that is still valid.
+ */
+void testOutOfBoundsChangedCell()
+{
+    std::cout << "Testing out of bounds changed cell..." << std::endl;
+
+    MatrixWorld world(6, 6);
+    Path previous = buildSnakePath(2, 6);
+
+    PathRepair repair;
+    Path repaired = repair.repairPath(world, previous, {{0, 7}, {9, 0}}, {12});
+    assert(isViablePath(world, repaired, {12}));
+    assert(std::equal(repaired.begin(), repaired.end(), previous.begin()));
+    assert(repair.getLastExpansions() == 0);
+
+    std::cout << "✓ Out of bounds changed cell test passed" << std::endl;
+}
+
+/**
+ * @brief Tests bridging around a single newly blocked cell
+ *
+ * Blocks a cell in the middle of the first row of a snake path. The repair
+ * must produce a valid path of the same length using only a local search.
+ */
+void testBridgeAroundBlockedCell()
+{
+    std::cout << "Testing bridge around blocked cell..." << std::endl;
+
+    MatrixWorld world(8, 8);
+    Path previous = buildSnakePath(2, 8);
+    world.setCell(0, 4, true);
+
+    PathRepair repair;
+    Path repaired = repair.repairPath(world, previous, {{0, 4}}, {16});
+    assert(isViablePath(world, repaired, {16}));
+    assert(repair.getLastExpansions() < 200);
+
+    std::cout << "✓ Bridge around blocked cell test passed" << std::endl;
+}
+
+/**
+ * @brief Tests the fallback when a gap cannot be bridged
+ *
+ * A full wall splits the world; the shorter side is dropped and the longer
+ * side is re-extended to the required length.
+ */
+void testUnbridgeableGap()
+{
+    std::cout << "Testing unbridgeable gap..." << std::endl;
+
+    MatrixWorld world(4, 8);
+    Path previous = buildSnakePath(1, 8); // (0,0) .. (0,7)
+    std::vector<std::pair<uint16_t, uint16_t>> wall = {{0, 2}, {1, 2}, {2, 2}, {3, 2}};
+    world.matrixBlanking(wall);
+
+    PathRepair repair;
+    Path repaired = repair.repairPath(world, previous, wall, {8});
+    assert(isViablePath(world, repaired, {8}));
+    for (const auto &[row, col] : repaired)
+    {
+        UNUSED(row);
+        assert(col > 2); // Only the larger side of the wall is used
+    }
+
+    std::cout << "✓ Unbridgeable gap test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that an impossible repair returns an empty path
+ */
+void testRepairFailure()
+{
+    std::cout << "Testing repair failure..." << std::endl;
+
+    MatrixWorld world(1, 6);
+    Path previous = buildSnakePath(1, 6);
+    world.setCell(0, 3, true);
+
+    PathRepair repair;
+    Path repaired = repair.repairPath(world, previous, {{0, 3}}, {6});
+    assert(repaired.isEmpty());
+
+    std::cout << "✓ Repair failure test passed" << std::endl;
+}
+
+/**
+ * @brief Tests exception handling for invalid path lengths
+ */
+void testExceptionHandling()
+{
+    std::cout << "Testing exception handling..." << std::endl;
+
+    MatrixWorld world(3, 3);
+    Path previous = buildSnakePath(1, 3);
+    PathRepair repair;
+
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(repair.repairPath(world, previous, {}, {0}));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    exceptionThrown = false;
+    try
+    {
+        UNUSED(repair.repairPath(world, previous, {}, {10}));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ Exception handling test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for path repair
+ */
+int main()
+{
+    std::cout << "=== Path Repair Test Suite ===" << std::endl;
+
+    try
+    {
+        testUnaffectedPath();
+        testOutOfBoundsChangedCell();
+        testBridgeAroundBlockedCell();
+        testUnbridgeableGap();
+        testRepairFailure();
+        testExceptionHandling();
+
+        std::cout << "\n✅ All Path Repair tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,255 @@
+/**
+ * @file test_path_service.cpp
+ * @brief Unit tests for the path service and its client
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Request and response frames survive a round trip, malformed payloads are rejected
+ * - Resident worlds: load, query, mutate with copy-on-write versions, errors
+ * - Deadlines, Cancel requests and concurrent clients
+ */
+
+#include "../test_main.hpp"
+#include "path_client.hpp"
+#include "path_service.hpp"
+#include "path_validation.hpp"
+#include <cassert>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+/// World and length no engine finishes quickly; the feasibility bound does not rule it out
+constexpr const char *SLOW_WORLD = "31x31";
+constexpr PathLength SLOW_LENGTH{961};
+
+/**
+ * @brief Gets a socket path unique to this process
+ */
+std::string socketPath()
+{
+    return (std::filesystem::temp_directory_path() / ("test_path_service_" + std::to_string(getpid()) + ".sock"))
+        .string();
+}
+
+/**
+ * @brief Strips the length prefix of a frame
+ */
+std::string_view payloadOf(const std::string &frame)
+{
+    return std::string_view(frame).substr(sizeof(uint32_t));
+}
+} // namespace
+
+/**
+ * @brief Tests frame encoding and decoding
+ */
+void testProtocol()
+{
+    std::cout << "Testing protocol..." << std::endl;
+
+    ServiceRequest mutate;
+    mutate.type = RequestType::MutateCells;
+    mutate.requestId = 70000;
+    mutate.world = "arena";
+    mutate.blocked = false;
+    mutate.cells = {{1, 2}, {65535, 0}};
+    std::string frame = encodeRequest(mutate);
+    assert(frame.size() == sizeof(uint32_t) + 1 + 4 + 2 + 5 + 1 + 4 + 8);
+    assert(static_cast<uint8_t>(frame[0]) == frame.size() - sizeof(uint32_t) && frame[1] == 0);
+    ServiceRequest decoded = decodeRequest(payloadOf(frame));
+    assert(decoded.type == RequestType::MutateCells && decoded.requestId == 70000 && decoded.world == "arena");
+    assert(!decoded.blocked && decoded.cells == mutate.cells);
+
+    ServiceRequest query;
+    query.requestId = 3;
+    query.world = "w";
+    query.pathLength = {12};
+    query.algorithm = "auto";
+    query.maxStartingPoints = {9};
+    query.deadlineMillis = 250;
+    decoded = decodeRequest(payloadOf(encodeRequest(query)));
+    assert(decoded.type == RequestType::QueryPath && decoded.pathLength.value == 12 && decoded.algorithm == "auto");
+    assert(decoded.maxStartingPoints.value == 9 && decoded.deadlineMillis == 250);
+
+    ServiceResponse response;
+    response.requestId = 3;
+    response.status = ResponseStatus::Found;
+    response.micros = 42;
+    response.worldVersion = uint64_t{1} << 40;
+    response.path.addCoordinate(0, 0);
+    response.path.addCoordinate(0, 1);
+    ServiceResponse decodedResponse = decodeResponse(payloadOf(encodeResponse(response)));
+    assert(decodedResponse.status == ResponseStatus::Found && decodedResponse.micros == 42);
+    assert(decodedResponse.worldVersion == response.worldVersion && decodedResponse.path.getLength() == 2);
+    assert(std::string(responseStatusName(ResponseStatus::TimedOut)) == "timed_out");
+
+    std::string valid(payloadOf(encodeRequest(query)));
+    for (const std::string &bad : {valid.substr(0, valid.size() - 1), valid + "x", std::string("\x09\0\0\0\0", 5)})
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            UNUSED(decodeRequest(bad));
+        }
+        catch (const std::invalid_argument &)
+        {
+            exceptionThrown = true;
+        }
+        assert(exceptionThrown);
+    }
+
+    std::cout << "✓ Protocol test passed" << std::endl;
+}
+
+/**
+ * @brief Tests resident worlds through a client
+ */
+void testResidentWorlds()
+{
+    std::cout << "Testing resident worlds..." << std::endl;
+
+    const std::string path = socketPath();
+    PathService service(path, 2);
+    service.start();
+    PathClient client(path);
+
+    ServiceResponse loaded = client.loadWorld("grid", "8x8");
+    ServiceResponse badLoad = client.loadWorld("bad", "world.txt");
+    assert(loaded.status == ResponseStatus::Ok && loaded.worldVersion != 0);
+    assert(badLoad.status == ResponseStatus::Error && service.getWorldCount() == 1);
+
+    ServiceResponse found = client.queryPath("grid", {20});
+    assert(found.status == ResponseStatus::Found && found.worldVersion == loaded.worldVersion);
+    assert(isViablePath(MatrixWorld(8, 8), found.path, {20}));
+    ServiceResponse tooLong = client.queryPath("grid", {65});
+    ServiceResponse unknownWorld = client.queryPath("missing", {5});
+    ServiceResponse unknownEngine = client.queryPath("grid", {5}, "missing");
+    assert(tooLong.status == ResponseStatus::Infeasible);
+    assert(unknownWorld.status == ResponseStatus::Error && unknownEngine.status == ResponseStatus::Error);
+
+    // Mutations publish a new version; queries see the blocked cells
+    ServiceResponse mutated = client.mutateCells("grid", {{0, 0}, {0, 1}, {0, 2}});
+    ServiceResponse afterMutation = client.queryPath("grid", {40});
+    ServiceResponse aboveBound = client.queryPath("grid", {62});
+    assert(mutated.status == ResponseStatus::Ok && mutated.worldVersion != loaded.worldVersion);
+    assert(afterMutation.status == ResponseStatus::Found && afterMutation.worldVersion == mutated.worldVersion);
+    assert(aboveBound.status == ResponseStatus::Infeasible);
+
+    // No-op mutations keep the version, invalid ones change nothing
+    ServiceResponse noOp = client.mutateCells("grid", {{0, 0}});
+    ServiceResponse outside = client.mutateCells("grid", {{1, 1}, {8, 0}});
+    ServiceResponse unchanged = client.queryPath("grid", {5});
+    assert(noOp.worldVersion == mutated.worldVersion && outside.status == ResponseStatus::Error);
+    assert(unchanged.worldVersion == mutated.worldVersion);
+    ServiceResponse unblocked = client.mutateCells("grid", {{0, 0}}, false);
+    ServiceResponse widerBound = client.queryPath("grid", {62}, "dfs", {}, 1);
+    assert(unblocked.status == ResponseStatus::Ok && widerBound.status != ResponseStatus::Infeasible);
+
+    service.stop();
+    assert(!std::filesystem::exists(path));
+
+    std::cout << "✓ Resident worlds test passed" << std::endl;
+}
+
+/**
+ * @brief Tests deadlines, cancellation and concurrent clients
+ */
+void testCancellation()
+{
+    std::cout << "Testing deadlines and cancellation..." << std::endl;
+
+    const std::string path = socketPath();
+    PathService service(path, 2);
+    service.start();
+    PathClient client(path);
+    ServiceResponse loaded = client.loadWorld("slow", SLOW_WORLD);
+    assert(loaded.status == ResponseStatus::Ok);
+
+    ServiceResponse timedOut = client.queryPath("slow", SLOW_LENGTH, "dfs", {961}, 50);
+    assert(timedOut.status == ResponseStatus::TimedOut);
+
+    // Answered queries drop their deadline long before it passes
+    ServiceResponse quick = client.queryPath("slow", {30}, "dfs", {}, 600000);
+    assert(quick.status == ResponseStatus::Found && service.getPendingDeadlineCount() == 0);
+
+    // Cancel a running query; responses arrive by id, not in order
+    ServiceRequest query;
+    query.world = "slow";
+    query.pathLength = SLOW_LENGTH;
+    query.maxStartingPoints = {961};
+    uint32_t running = client.submit(query);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ServiceResponse cancelled = client.cancel(running);
+    ServiceResponse answer = client.receive(running);
+    ServiceResponse cancelledTwice = client.cancel(running);
+    assert(cancelled.status == ResponseStatus::Ok && answer.status == ResponseStatus::Cancelled);
+    assert(cancelledTwice.status == ResponseStatus::Error);
+
+    // Other clients keep being served while a query runs
+    uint32_t background = client.submit(query);
+    std::vector<std::thread> clients;
+    std::vector<int> served(4, 0);
+    for (size_t index = 0; index < served.size(); index++)
+    {
+        clients.emplace_back([&, index]() {
+            PathClient other(path);
+            served[index] = other.queryPath("slow", {30}).status == ResponseStatus::Found ? 1 : 0;
+        });
+    }
+    for (auto &thread : clients)
+    {
+        thread.join();
+    }
+    for (int result : served)
+    {
+        assert(result == 1);
+        UNUSED(result);
+    }
+    cancelled = client.cancel(background);
+    answer = client.receive(background);
+    assert(cancelled.status == ResponseStatus::Ok && answer.status == ResponseStatus::Cancelled);
+
+    // Stopping cancels whatever still runs
+    PathClient abandoned(path);
+    abandoned.submit(query);
+    service.stop();
+
+    std::cout << "✓ Deadlines and cancellation test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the path service
+ */
+int main()
+{
+    std::cout << "=== Path Service Test Suite ===" << std::endl;
+
+    try
+    {
+        testProtocol();
+        testResidentWorlds();
+        testCancellation();
+
+        std::cout << "\n✅ All Path Service tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
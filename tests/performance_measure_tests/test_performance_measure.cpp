@@ -0,0 +1,207 @@
+/**
+ * @file test_performance_measure.cpp
+ * @brief Unit tests for the perf event group measures
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Derived metrics (IPC, miss rates, MPKI) and their unavailable cases
+ * - The measure summary, including counters the machine does not support
+ * - Copies never share counters
+ * - Live measurements at every tier never fail and report their tier
+ */
+
+#include "../test_main.hpp"
+#include "performance_measure.hpp"
+#include <cassert>
+#include <cerrno>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace
+{
+using Counter = PerformanceMeasure::Counter;
+
+/**
+ * @brief Builds measures with the given counters counted
+ */
+PerformanceMeasure::Measures makeMeasures(std::initializer_list<std::pair<Counter, uint64_t>> values)
+{
+    PerformanceMeasure::Measures measures = {};
+    measures.runningShare = 1.0;
+    for (const auto &[counter, value] : values)
+    {
+        measures.counters[static_cast<size_t>(counter)] = value;
+        measures.counted[static_cast<size_t>(counter)] = true;
+    }
+    measures.cycleCount = measures.get(Counter::Cycles).value_or(0);
+    return measures;
+}
+
+/**
+ * @brief Compares doubles to a small tolerance
+ */
+bool near(std::optional<double> value, double expected)
+{
+    return value.has_value() && std::fabs(*value - expected) < 1e-9;
+}
+} // namespace
+
+/**
+ * @brief Tests the derived metrics
+ */
+void testDerivedMetrics()
+{
+    std::cout << "Testing derived metrics..." << std::endl;
+
+    PerformanceMeasure::Measures measures =
+        makeMeasures({{Counter::Cycles, 2000}, {Counter::Instructions, 5000}, {Counter::CacheReferences, 400},
+                      {Counter::CacheMisses, 100}, {Counter::BranchMisses, 25}, {Counter::L1dReadMisses, 150}});
+    assert(near(measures.getInstructionsPerCycle(), 2.5));
+    assert(near(measures.getCacheMissRate(), 0.25));
+    assert(near(measures.getBranchMissesPerKiloInstruction(), 5.0));
+    assert(near(measures.getL1dMissesPerKiloInstruction(), 30.0));
+    assert(measures.get(Counter::Cycles) == 2000U && !measures.get(Counter::PageFaults));
+
+    // Missing counters or zero denominators give no metric
+    PerformanceMeasure::Measures partial = makeMeasures({{Counter::Instructions, 5000}, {Counter::CacheReferences, 0}});
+    assert(!partial.getInstructionsPerCycle() && !partial.getCacheMissRate());
+    assert(!partial.getBranchMissesPerKiloInstruction());
+
+    std::cout << "✓ Derived metrics test passed" << std::endl;
+}
+
+/**
+ * @brief Tests the measure summary
+ */
+void testSummary()
+{
+    std::cout << "Testing measure summary..." << std::endl;
+
+    PerformanceMeasure::Measures measures =
+        makeMeasures({{Counter::Cycles, 3000}, {Counter::Instructions, 1500}, {Counter::TaskClock, 800000}});
+    measures.timeCount = 1000;
+    std::ostringstream stream;
+    PerformanceMeasure::printMeasures(stream, measures);
+    const std::string summary = stream.str();
+    assert(summary.rfind("=== MEASURE SUMMARY ===\nMeasurement tier: perf counters\nTime taken(uS): 1000\nCycles: 3000\n",
+                         0) == 0);
+    assert(summary.find("L1D read misses: n/a\n") != std::string::npos);
+    assert(summary.find("IPC: 0.50\n") != std::string::npos);
+    assert(summary.find("Cache miss rate: n/a\n") != std::string::npos);
+    assert(summary.find("CPU utilization: 80.00%\n") != std::string::npos);
+    assert(summary.find("scaled") == std::string::npos);
+
+    // A multiplexed group is flagged
+    measures.runningShare = 0.5;
+    stream.str("");
+    PerformanceMeasure::printMeasures(stream, measures);
+    assert(stream.str().find("group counted: 50.00% of the time") != std::string::npos);
+
+    // Lower tiers name the perf_event_open failure and show TSC ticks
+    measures.tier = PerformanceMeasure::Tier::ThreadClock;
+    measures.fallbackError = EACCES;
+    measures.tscTicks = 4200;
+    stream.str("");
+    PerformanceMeasure::printMeasures(stream, measures);
+    assert(stream.str().find("Measurement tier: thread CPU clock and TSC (perf_event_open: ") != std::string::npos);
+    assert(stream.str().find("TSC ticks: 4200\n") != std::string::npos);
+
+    std::cout << "✓ Measure summary test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that copies start without counters
+ */
+void testCopies()
+{
+    std::cout << "Testing copies..." << std::endl;
+
+    PerformanceMeasure original;
+    PerformanceMeasure copy(original);
+    copy = original;
+    PerformanceMeasure::Measures saved = copy.saveMeasures();
+    assert(saved.timeCount == 0 && !saved.get(Counter::Cycles));
+    UNUSED(saved);
+
+    std::cout << "✓ Copies test passed" << std::endl;
+}
+
+/**
+ * @brief Tests live measurements at every tier
+ */
+void testTiers()
+{
+    std::cout << "Testing measurement tiers..." << std::endl;
+
+    using Tier = PerformanceMeasure::Tier;
+    for (Tier limit : {Tier::PerfCounters, Tier::UserSpaceCounters, Tier::ThreadClock, Tier::WallTime})
+    {
+        PerformanceMeasure measure;
+        measure.setTierLimit(limit);
+        measure.measureStart();
+        volatile uint64_t sink = 0;
+        for (uint64_t step = 0; step < 2000000; step++)
+        {
+            sink = sink + step;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        measure.measureStop();
+
+        // Never more detailed than the limit; the saved measures carry the tier
+        const Tier tier = measure.getTier();
+        const PerformanceMeasure::Measures saved = measure.saveMeasures();
+        assert(tier >= limit && saved.tier == tier);
+        assert(saved.timeCount >= 20);
+        if (limit == Tier::ThreadClock)
+        {
+            // The thread clock counts the busy loop, not the sleep
+            assert(tier == Tier::ThreadClock && saved.get(Counter::TaskClock));
+            assert(*saved.get(Counter::TaskClock) < saved.timeCount * 1000000);
+        }
+        if (tier == Tier::WallTime)
+        {
+            assert(!saved.get(Counter::TaskClock) && !saved.tscTicks);
+        }
+        std::ostringstream stream;
+        PerformanceMeasure::printMeasures(stream, saved);
+        assert(stream.str().find(std::string("Measurement tier: ") + PerformanceMeasure::tierName(tier)) !=
+               std::string::npos);
+        UNUSED(saved);
+    }
+
+    std::cout << "✓ Measurement tiers test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the performance measures
+ */
+int main()
+{
+    std::cout << "=== Performance Measure Test Suite ===" << std::endl;
+
+    try
+    {
+        testDerivedMetrics();
+        testSummary();
+        testCopies();
+        testTiers();
+
+        std::cout << "\n✅ All Performance Measure tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
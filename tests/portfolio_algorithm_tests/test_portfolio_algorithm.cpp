@@ -0,0 +1,230 @@
+/**
+ * @file test_portfolio_algorithm.cpp
+ * @brief Unit tests for the concurrent engine portfolio
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Result validation with isViablePath()
+ * - Racing engines and returning the first valid path
+ * - Cancellation of engines that lost the race
+ * - Proven infeasibility from complete engines
+ * - Win recording in the AlgorithmRegistry
+ */
+
+#include "../test_main.hpp"
+#include "algorithm_registry.hpp"
+#include "path_validation.hpp"
+#include "portfolio_algorithm.hpp"
+#include "world_statistics.hpp"
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+/**
+ * @class SpinUntilCancelledAlgorithm
+ * @brief Test engine that never finds anything and only returns when cancelled
+ */
+class SpinUntilCancelledAlgorithm : public PathAlgorithm
+{
+public:
+    Path findViablePath(const MatrixWorld &, PathLength, MaxStartingPoints) override
+    {
+        while (!isCancelled())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return {};
+    }
+
+    [[nodiscard]] std::string getAlgorithmName() const override
+    {
+        return "Spin Until Cancelled";
+    }
+};
+
+/**
+ * @brief Tests path validation against a world
+ *
+ * Checks length, contiguity, blocked cells and revisits.
+ */
+void testPathValidation()
+{
+    std::cout << "Testing path validation..." << std::endl;
+
+    MatrixWorld world(3, 3);
+    world.setCell(1, 1, true);
+
+    Path valid;
+    valid.addCoordinate(0, 0);
+    valid.addCoordinate(0, 1);
+    valid.addCoordinate(0, 2);
+    assert(isViablePath(world, valid, {3}));
+    assert(!isViablePath(world, valid, {4})); // Wrong length
+
+    Path throughBlocked;
+    throughBlocked.addCoordinate(0, 1);
+    throughBlocked.addCoordinate(1, 1);
+    assert(!isViablePath(world, throughBlocked, {2}));
+
+    Path revisiting;
+    revisiting.addCoordinate(0, 0);
+    revisiting.addCoordinate(0, 1);
+    revisiting.addCoordinate(0, 0);
+    assert(!isViablePath(world, revisiting, {3}));
+
+    std::cout << "✓ Path validation test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that the race returns a valid path and cancels the loser
+ *
+ * Races DFS against an engine that spins until cancelled. The call must
+ * return (proving the loser was cancelled) with DFS as the winner.
+ */
+void testRaceCancelsLosers()
+{
+    std::cout << "Testing race cancellation..." << std::endl;
+
+    AlgorithmRegistry::instance().registerAlgorithm({"test-spin",
+                                                     "Spins until cancelled",
+                                                     50,
+                                                     false,
+                                                     nullptr,
+                                                     [] { return std::make_unique<SpinUntilCancelledAlgorithm>(); }});
+
+    MatrixWorld world(5, 5);
+    PortfolioAlgorithm portfolio({"test-spin", "dfs"});
+    Path path = portfolio.findViablePath(world, {10}, {5});
+
+    assert(isViablePath(world, path, {10}));
+    assert(portfolio.getLastWinner() == "dfs");
+
+    std::cout << "✓ Race cancellation test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that a complete engine ends the race on impossible requests
+ *
+ * A plus shape with arms of two cells passes the feasibility oracle for
+ * length 6, but its longest path has 5 cells; DFS proves that no path
+ * exists and the spinning engine must be cancelled. Requests the oracle
+ * already rejects end before any engine is started.
+ */
+void testProvenInfeasible()
+{
+    std::cout << "Testing proven infeasibility..." << std::endl;
+
+    MatrixWorld world(5, 5);
+    for (uint16_t row = 0; row < 5; row++)
+    {
+        for (uint16_t col = 0; col < 5; col++)
+        {
+            if (row != 2 && col != 2)
+            {
+                world.setCell(row, col, true);
+            }
+        }
+    }
+
+    PortfolioAlgorithm portfolio({"test-spin", "dfs"});
+    Path path = portfolio.findViablePath(world, {6}, {5});
+    assert(path.isEmpty());
+    assert(portfolio.getLastWinner() == "dfs");
+
+    path = portfolio.findViablePath(world, {8}, {5});
+    assert(path.isEmpty());
+    assert(portfolio.getLastWinner().empty());
+
+    std::cout << "✓ Proven infeasibility test passed" << std::endl;
+}
+
+/**
+ * @brief Tests win recording for the automatic selection
+ *
+ * Every decided race must increment the winner's count for the density
+ * class of the world.
+ */
+void testWinRecording()
+{
+    std::cout << "Testing win recording..." << std::endl;
+
+    MatrixWorld world(4, 4);
+    WorldStatistics stats = computeWorldStatistics(world);
+    AlgorithmRegistry &registry = AlgorithmRegistry::instance();
+    uint32_t winsBefore = registry.getWinCount("dfs", stats);
+
+    PortfolioAlgorithm portfolio({"dfs"});
+    Path path = portfolio.findViablePath(world, {6}, {5});
+    assert(isViablePath(world, path, {6}));
+    assert(registry.getWinCount("dfs", stats) == winsBefore + 1);
+
+    std::cout << "✓ Win recording test passed" << std::endl;
+}
+
+/**
+ * @brief Tests constructor and input validation
+ */
+void testExceptionHandling()
+{
+    std::cout << "Testing exception handling..." << std::endl;
+
+    bool exceptionThrown = false;
+    try
+    {
+        PortfolioAlgorithm selfRacing({"dfs", "portfolio"});
+        UNUSED(selfRacing);
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    MatrixWorld world(3, 3);
+    PortfolioAlgorithm portfolio({"no-such-engine"});
+    exceptionThrown = false;
+    try
+    {
+        UNUSED(portfolio.findViablePath(world, {3}, {5}));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ Exception handling test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the portfolio algorithm
+ */
+int main()
+{
+    std::cout << "=== Portfolio Algorithm Test Suite ===" << std::endl;
+
+    try
+    {
+        testPathValidation();
+        testRaceCancelsLosers();
+        testProvenInfeasible();
+        testWinRecording();
+        testExceptionHandling();
+
+        std::cout << "\n✅ All Portfolio Algorithm tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,224 @@
+/**
+ * @file test_result_output.cpp
+ * @brief Unit tests for the JSON lines and CSV result writers
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - JSON records with inline and compact paths, escaping, optional keys
+ * - CSV header and rows, quoting, compact paths
+ * - Measured counters in both formats, uncounted ones as null or empty
+ * - Format names, move encoding and exact blocked cell counts
+ */
+
+#include "../test_main.hpp"
+#include "batch_runner.hpp"
+#include "result_output.hpp"
+#include "world_statistics.hpp"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Builds a record with a three cell path
+ */
+QueryRecord sampleRecord()
+{
+    QueryRecord record;
+    record.status = "found";
+    record.algorithm = "dfs";
+    record.world = "arena.map";
+    record.rows = 4;
+    record.cols = 5;
+    record.blockedCells = 3;
+    record.pathLength = {3};
+    record.path.addCoordinate(1, 1);
+    record.path.addCoordinate(0, 1);
+    record.path.addCoordinate(0, 2);
+    record.timings = {1.25, 2.0, 30.04, 40.0};
+    return record;
+}
+} // namespace
+
+/**
+ * @brief Tests JSON records
+ */
+void testJsonRecord()
+{
+    std::cout << "Testing JSON records..." << std::endl;
+
+    QueryRecord record = sampleRecord();
+    std::string line;
+    appendJsonRecord(line, record, PathEncoding::Inline);
+    assert(line == "{\"status\":\"found\",\"algorithm\":\"dfs\",\"world\":\"arena.map\",\"rows\":4,\"cols\":5,"
+                   "\"blocked_cells\":3,\"path_length\":3,\"length\":3,\"timings_us\":{\"load\":1.3,"
+                   "\"feasibility\":2.0,\"search\":30.0,\"total\":40.0},\"path\":[[1,1],[0,1],[0,2]]}\n");
+
+    line.clear();
+    appendJsonRecord(line, record, PathEncoding::Compact);
+    assert(line.find(",\"path\":{\"start\":[1,1],\"moves\":\"UR\"}}\n") != std::string::npos);
+
+    // Batch index, empty path and escaped reason
+    record.job = 7;
+    record.status = "failed";
+    record.path = Path();
+    record.reason = "Bad \"file\"\n\x01";
+    line.clear();
+    appendJsonRecord(line, record, PathEncoding::Inline);
+    assert(line.rfind("{\"job\":7,\"status\":\"failed\"", 0) == 0);
+    assert(line.find("\"length\":0") != std::string::npos);
+    assert(line.find("\"path\":null,\"reason\":\"Bad \\\"file\\\"\\n\\u0001\"}\n") != std::string::npos);
+
+    std::cout << "✓ JSON records test passed" << std::endl;
+}
+
+/**
+ * @brief Tests CSV rows
+ */
+void testCsvRecord()
+{
+    std::cout << "Testing CSV records..." << std::endl;
+
+    std::string output;
+    appendCsvHeader(output);
+    const size_t columns = static_cast<size_t>(std::count(output.begin(), output.end(), ',')) + 1;
+    assert(output.rfind("job,status,", 0) == 0 && columns == 26);
+
+    output.clear();
+    appendCsvRecord(output, sampleRecord());
+    assert(output == ",found,dfs,arena.map,4,5,3,3,3,1.3,2.0,30.0,40.0,1,1,UR,,,,,,,,,,\n");
+
+    QueryRecord record = sampleRecord();
+    record.job = 0;
+    record.status = "infeasible";
+    record.path = Path();
+    record.reason = "Path length 9, \"too long\"";
+    output.clear();
+    appendCsvRecord(output, record);
+    assert(output == "0,infeasible,dfs,arena.map,4,5,3,3,0,1.3,2.0,30.0,40.0,,,,\"Path length 9, \"\"too long\"\"\",,,,,,,,,\n");
+
+    // writeRecord emits the same bytes, and nothing in text mode
+    std::ostringstream stream;
+    writeRecord(stream, sampleRecord(), OutputFormat::Csv, PathEncoding::Inline);
+    writeRecord(stream, sampleRecord(), OutputFormat::Text, PathEncoding::Inline);
+    assert(stream.str() == ",found,dfs,arena.map,4,5,3,3,3,1.3,2.0,30.0,40.0,1,1,UR,,,,,,,,,,\n");
+
+    std::cout << "✓ CSV records test passed" << std::endl;
+}
+
+/**
+ * @brief Tests measured counters in JSON and CSV records
+ */
+void testCounters()
+{
+    std::cout << "Testing counters..." << std::endl;
+
+    PerformanceMeasure::Measures measures = {};
+    measures.tier = PerformanceMeasure::Tier::ThreadClock;
+    measures.counters[static_cast<size_t>(PerformanceMeasure::Counter::TaskClock)] = 5000;
+    measures.counted[static_cast<size_t>(PerformanceMeasure::Counter::TaskClock)] = true;
+    QueryRecord record = sampleRecord();
+    record.counters = measures;
+
+    std::string line;
+    appendJsonRecord(line, record, PathEncoding::Compact);
+    assert(line.find(",\"counters\":{\"tier\":\"thread CPU clock and TSC\",\"cycles\":null,") != std::string::npos);
+    assert(line.find("\"l1d_read_misses\":null,\"task_clock_ns\":5000,\"page_faults\":null}}\n") !=
+           std::string::npos);
+
+    line.clear();
+    appendCsvRecord(line, record);
+    assert(line == ",found,dfs,arena.map,4,5,3,3,3,1.3,2.0,30.0,40.0,1,1,UR,,thread CPU clock and TSC,,,,,,,5000,\n");
+
+    std::cout << "✓ Counters test passed" << std::endl;
+}
+
+/**
+ * @brief Tests names, moves, blocked cell counts and batch records
+ */
+void testHelpers()
+{
+    std::cout << "Testing output helpers..." << std::endl;
+
+    assert(parseOutputFormat("json") == OutputFormat::Json && parseOutputFormat("csv") == OutputFormat::Csv);
+    assert(parseOutputFormat("text") == OutputFormat::Text);
+    assert(parsePathEncoding("compact") == PathEncoding::Compact);
+    for (const char *name : {"xml", ""})
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            UNUSED(parseOutputFormat(name));
+        }
+        catch (const std::invalid_argument &)
+        {
+            exceptionThrown = true;
+        }
+        assert(exceptionThrown);
+    }
+
+    Path path;
+    assert(encodeMoves(path).empty());
+    for (const auto &[row, col] : {std::pair<uint16_t, uint16_t>{2, 2}, {2, 3}, {3, 3}, {3, 2}, {2, 2}, {0, 0}})
+    {
+        path.addCoordinate(row, col);
+    }
+    assert(encodeMoves(path) == "RDLU?");
+
+    // Exact counts beyond the 16-bit getters
+    MatrixWorld world(300, 300);
+    assert(countBlockedCells(world) == 0);
+    std::vector<uint64_t> mask(300 * world.getWordsPerRow(), ~uint64_t{0});
+    world.matrixBlankingMask(mask);
+    assert(countBlockedCells(world) == 90000);
+    world.setCell(299, 299, false);
+    assert(countBlockedCells(world) == 89999);
+
+    BatchJob job{"3x3", {4}, "dfs", {5}, 1};
+    BatchResult result;
+    result.status = BatchStatus::Infeasible;
+    result.message = "too long";
+    result.rows = 3;
+    result.cols = 3;
+    QueryRecord record = makeBatchRecord(2, job, result);
+    assert(record.job == 2 && record.status == "infeasible" && record.world == "3x3" && record.rows == 3);
+    assert(record.reason == "too long" && record.pathLength.value == 4);
+
+    std::cout << "✓ Output helpers test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the result writers
+ */
+int main()
+{
+    std::cout << "=== Result Output Test Suite ===" << std::endl;
+
+    try
+    {
+        testJsonRecord();
+        testCsvRecord();
+        testCounters();
+        testHelpers();
+
+        std::cout << "\n✅ All Result Output tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
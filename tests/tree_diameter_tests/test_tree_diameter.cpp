@@ -0,0 +1,148 @@
+/**
+ * @file test_tree_diameter.cpp
+ * @brief Unit tests for the spanning tree diameter stage
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Diameter paths are simple contiguous paths
+ * - Open worlds yield a near Hamiltonian diameter
+ * - The largest component is chosen in split worlds
+ * - findViablePath() truncates or rejects based on the diameter
+ */
+
+#include "../test_main.hpp"
+#include "csr_graph.hpp"
+#include "path_validation.hpp"
+#include "tree_diameter.hpp"
+#include <cassert>
+#include <iostream>
+
+/**
+ * @brief Tests the diameter on an open world
+ *
+ * The depth-first tree of an open grid snakes through the rows, so the
+ * diameter covers every cell.
+ */
+void testOpenWorldDiameter()
+{
+    std::cout << "Testing open world diameter..." << std::endl;
+
+    MatrixWorld world(6, 7);
+    Path diameter = TreeDiameterAlgorithm::computeDiameterPath(world);
+    assert(diameter.getLength() == 42);
+    assert(isViablePath(world, diameter, {42}));
+
+    // The passes run on the shared graph of the world version
+    std::shared_ptr<const CsrGraph> graph = CsrGraph::getShared(world);
+    Path again = TreeDiameterAlgorithm::computeDiameterPath(world);
+    assert(CsrGraph::getShared(world) == graph && again.getLength() == 42);
+
+    std::cout << "✓ Open world diameter test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that the largest component provides the diameter
+ */
+void testSplitWorldDiameter()
+{
+    std::cout << "Testing split world diameter..." << std::endl;
+
+    // Column 1 blocked: a 4x1 strip on the left, a 4x3 block on the right
+    MatrixWorld world(4, 5);
+    for (uint16_t row = 0; row < 4; row++)
+    {
+        world.setCell(row, 1, true);
+    }
+
+    Path diameter = TreeDiameterAlgorithm::computeDiameterPath(world);
+    uint16_t length = static_cast<uint16_t>(diameter.getLength());
+    assert(length > 4);
+    assert(isViablePath(world, diameter, {length}));
+    for (const auto &[row, col] : diameter)
+    {
+        UNUSED(row);
+        assert(col >= 2);
+    }
+
+    std::cout << "✓ Split world diameter test passed" << std::endl;
+}
+
+/**
+ * @brief Tests the diameter of a fully blocked world
+ */
+void testBlockedWorld()
+{
+    std::cout << "Testing blocked world..." << std::endl;
+
+    MatrixWorld world(2, 2);
+    world.matrixBlanking({{0, 0}, {0, 1}, {1, 0}, {1, 1}});
+    assert(TreeDiameterAlgorithm::computeDiameterPath(world).isEmpty());
+
+    std::cout << "✓ Blocked world test passed" << std::endl;
+}
+
+/**
+ * @brief Tests findViablePath() against the diameter length
+ */
+void testFindViablePath()
+{
+    std::cout << "Testing findViablePath..." << std::endl;
+
+    // Plus-shaped world: the corners are blocked, so the tree has four arms
+    MatrixWorld world(5, 5);
+    world.matrixBlanking({{0, 0}, {0, 1}, {1, 0}, {0, 3}, {0, 4}, {1, 4}, {3, 0}, {4, 0}, {4, 1}, {3, 4}, {4, 3}, {4, 4}});
+
+    TreeDiameterAlgorithm diameterAlgorithm;
+    Path shortPath = diameterAlgorithm.findViablePath(world, {8}, {});
+    assert(isViablePath(world, shortPath, {8}));
+
+    // One cell beyond the diameter is left to the other engines
+    uint16_t diameterLength = static_cast<uint16_t>(TreeDiameterAlgorithm::computeDiameterPath(world).getLength());
+    assert(diameterLength < world.getNoOfUnblockedCells());
+    Path tooLong = diameterAlgorithm.findViablePath(world, {static_cast<uint16_t>(diameterLength + 1)}, {});
+    assert(tooLong.isEmpty());
+
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(diameterAlgorithm.findViablePath(world, {0}, {}));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ findViablePath test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the tree diameter stage
+ */
+int main()
+{
+    std::cout << "=== Tree Diameter Test Suite ===" << std::endl;
+
+    try
+    {
+        testOpenWorldDiameter();
+        testSplitWorldDiameter();
+        testBlockedWorld();
+        testFindViablePath();
+
+        std::cout << "\n✅ All Tree Diameter tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
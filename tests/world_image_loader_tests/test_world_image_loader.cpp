@@ -0,0 +1,260 @@
+/**
+ * @file test_world_image_loader.cpp
+ * @brief Unit tests for the PBM/PGM world loaders
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - PBM rows are packed straight into row words, padding stays blocked
+ * - PGM pixels are blocked by the occupancy threshold (8 and 16 bit)
+ * - The vectorized PGM row packer matches a per-pixel reference
+ * - Malformed images and thresholds are rejected
+ */
+
+#include "../test_main.hpp"
+#include "world_image_loader.hpp"
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Builds a PBM image whose black pixels satisfy isBlack
+ */
+std::string makePbm(uint16_t rows, uint16_t cols, const std::function<bool(uint16_t, uint16_t)> &isBlack)
+{
+    std::string image = "P4\n# test image\n" + std::to_string(cols) + " " + std::to_string(rows) + "\n";
+    const size_t rowBytes = (cols + 7) / 8;
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        std::string bytes(rowBytes, '\0');
+        for (uint16_t col = 0; col < cols; col++)
+        {
+            if (isBlack(row, col))
+            {
+                bytes[col / 8] = static_cast<char>(bytes[col / 8] | (0x80 >> (col % 8)));
+            }
+        }
+        image += bytes;
+    }
+    return image;
+}
+
+/**
+ * @brief Tests PBM decoding
+ */
+void testPbmDecoding()
+{
+    std::cout << "Testing PBM decoding..." << std::endl;
+
+    auto isBlack = [](uint16_t row, uint16_t col) { return (row * 7 + col * 3) % 5 == 0 || col == 69; };
+    MatrixWorld world = loadWorldImage(makePbm(3, 70, isBlack));
+    assert(world.getColSize() == 3);
+    assert(world.getRowSize() == 70);
+
+    uint16_t blocked = 0;
+    for (uint16_t row = 0; row < 3; row++)
+    {
+        for (uint16_t col = 0; col < 70; col++)
+        {
+            assert(world.isUnblocked(row, col) == !isBlack(row, col));
+            blocked += isBlack(row, col) ? 1 : 0;
+        }
+        // Padding bits past the last column stay set
+        assert((world.getRowWords(row)[1] >> 6) == (~uint64_t{0} >> 6));
+    }
+    assert(world.getNoOfBlockedCells() == blocked);
+
+    std::cout << "✓ PBM decoding test passed" << std::endl;
+}
+
+/**
+ * @brief Tests PGM thresholding for 8 and 16 bit images
+ */
+void testPgmThreshold()
+{
+    std::cout << "Testing PGM threshold..." << std::endl;
+
+    // Grey value 2 × col: dark on the left
+    std::string image = "P5 100\t2 #comment\n255\n";
+    for (int row = 0; row < 2; row++)
+    {
+        for (int col = 0; col < 100; col++)
+        {
+            image += static_cast<char>(2 * col);
+        }
+    }
+
+    // Blocked below ceil(255 × 0.5) = 128, i.e. columns 0-63
+    MatrixWorld half = loadWorldImage(image, 0.5);
+    for (uint16_t col = 0; col < 100; col++)
+    {
+        assert(half.isUnblocked(1, col) == (col >= 64));
+    }
+    assert(half.getNoOfBlockedCells() == 128);
+
+    // Only white is free at threshold 0, nothing is blocked at threshold 1
+    assert(loadWorldImage(image, 0.0).getNoOfBlockedCells() == 200);
+    assert(loadWorldImage(image, 1.0).getNoOfBlockedCells() == 0);
+
+    // 16 bit big-endian samples
+    std::string wide = "P5\n3 1\n1000\n";
+    for (uint16_t value : {uint16_t{0}, uint16_t{499}, uint16_t{500}})
+    {
+        wide += static_cast<char>(value >> 8);
+        wide += static_cast<char>(value & 0xFF);
+    }
+    MatrixWorld wideWorld = loadWorldImage(wide, 0.5);
+    assert(!wideWorld.isUnblocked(0, 0));
+    assert(!wideWorld.isUnblocked(0, 1));
+    assert(wideWorld.isUnblocked(0, 2));
+
+    std::cout << "✓ PGM threshold test passed" << std::endl;
+}
+
+/**
+ * @brief Tests the PGM row packer against a per-pixel reference
+ */
+void testPackPgmRow()
+{
+    std::cout << "Testing PGM row packing..." << std::endl;
+
+    std::mt19937 generator(67);
+    std::uniform_int_distribution<int> pixelDistribution(0, 255);
+    for (uint16_t cols : {uint16_t{1}, uint16_t{15}, uint16_t{16}, uint16_t{63}, uint16_t{64}, uint16_t{130}})
+    {
+        std::vector<uint8_t> pixels(cols);
+        for (auto &pixel : pixels)
+        {
+            pixel = static_cast<uint8_t>(pixelDistribution(generator));
+        }
+        for (uint16_t cutoff : {uint16_t{0}, uint16_t{1}, uint16_t{127}, uint16_t{128}, uint16_t{200},
+                                uint16_t{255}, uint16_t{256}})
+        {
+            std::vector<uint64_t> words((cols + 63) / 64, ~uint64_t{0});
+            packPgmRow(pixels.data(), cols, cutoff, words.data());
+            for (size_t col = 0; col < words.size() * 64; col++)
+            {
+                bool expected = col < cols && pixels[col] < cutoff;
+                assert(((words[col / 64] >> (col % 64)) & 1U) == (expected ? 1U : 0U));
+            }
+        }
+    }
+
+    std::cout << "✓ PGM row packing test passed" << std::endl;
+}
+
+/**
+ * @brief Tests rejection of bad images, thresholds and files
+ */
+void testErrors()
+{
+    std::cout << "Testing errors..." << std::endl;
+
+    const std::vector<std::string> badImages = {"",
+                                                "P2\n1 1\n255\n0",
+                                                "P4\n8 x\n",
+                                                "P4\n0 1\n",
+                                                "P4\n70000 1\n",
+                                                "P4\n16 2\n\xff\xff\xff",
+                                                "P5\n2 1\n0\n\x01\x02",
+                                                "P5\n2 1\n255",
+                                                "P5 2 2 255X\x01\x02\x03\x04",
+                                                "P4\n8 1X\xff"};
+    for (const std::string &image : badImages)
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            UNUSED(loadWorldImage(image));
+        }
+        catch (const std::invalid_argument &)
+        {
+            exceptionThrown = true;
+        }
+        assert(exceptionThrown);
+    }
+
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(loadWorldImage("P5\n1 1\n255\n\x01", 1.5));
+    }
+    catch (const std::invalid_argument &)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    exceptionThrown = false;
+    try
+    {
+        UNUSED(loadWorldImageFile("/nonexistent/world.pgm"));
+    }
+    catch (const std::runtime_error &)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ Errors test passed" << std::endl;
+}
+
+/**
+ * @brief Tests loading an image file
+ */
+void testFileLoad()
+{
+    std::cout << "Testing file load..." << std::endl;
+
+    auto isBlack = [](uint16_t row, uint16_t col) { return row == col; };
+    const std::filesystem::path filePath = std::filesystem::temp_directory_path() / "test_world_image_loader.pbm";
+    {
+        std::ofstream file(filePath, std::ios::binary);
+        file << makePbm(10, 10, isBlack);
+    }
+
+    MatrixWorld world = loadWorldImageFile(filePath.string());
+    std::filesystem::remove(filePath);
+    assert(world.getNoOfBlockedCells() == 10);
+    assert(!world.isUnblocked(4, 4));
+    assert(world.isUnblocked(4, 5));
+
+    std::cout << "✓ File load test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the world image loader
+ */
+int main()
+{
+    std::cout << "=== World Image Loader Test Suite ===" << std::endl;
+
+    try
+    {
+        testPbmDecoding();
+        testPgmThreshold();
+        testPackPgmRow();
+        testErrors();
+        testFileLoad();
+
+        std::cout << "\n✅ All World Image Loader tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,397 @@
+/**
+ * @file test_world_pipeline.cpp
+ * @brief Unit tests for the pipelined world loader and prescored rankings
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Bounded queues hand items over in order and stop on close
+ * - Rankings built from band-by-band scores match the regular build
+ * - Sorted cell and row streams load the same world and seed its ranking
+ * - Unsorted cell streams load correctly and fall back to a regular ranking
+ * - Malformed, truncated and oversized streams are rejected
+ */
+
+#include "../test_main.hpp"
+#include "blocked_cells_loader.hpp"
+#include "bounded_queue.hpp"
+#include "world_pipeline.hpp"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Runs a loader on the read end of a pipe fed with data in small pieces
+ * @param data Bytes written by the producer thread
+ * @param piece Bytes per write()
+ * @param loader Callable taking the read descriptor
+ * @return Result of the loader
+ */
+template <typename Loader>
+auto throughPipe(const std::string &data, size_t piece, Loader loader)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        throw std::runtime_error("Can not create pipe");
+    }
+    std::thread producer([&data, piece, writeFd = fds[1]]() {
+        for (size_t offset = 0; offset < data.size(); offset += piece)
+        {
+            if (write(writeFd, data.data() + offset, std::min(piece, data.size() - offset)) < 0)
+            {
+                break; // Reader gave up
+            }
+        }
+        close(writeFd);
+    });
+
+    struct Closer
+    {
+        int fd;
+        std::thread &producer;
+        ~Closer()
+        {
+            close(fd);
+            producer.join();
+        }
+    } closer{fds[0], producer};
+    return loader(fds[0]);
+}
+
+/**
+ * @brief Checks that two worlds hold the same cells
+ */
+bool sameWorld(const MatrixWorld &left, const MatrixWorld &right)
+{
+    if (left.getColSize() != right.getColSize() || left.getRowSize() != right.getRowSize())
+    {
+        return false;
+    }
+    for (uint16_t row = 0; row < left.getColSize(); row++)
+    {
+        for (size_t word = 0; word < left.getWordsPerRow(); word++)
+        {
+            if (left.getRowWords(row)[word] != right.getRowWords(row)[word])
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks that two rankings list the same cells in the same buckets
+ */
+bool sameRanking(const CandidateRanking &left, const CandidateRanking &right)
+{
+    if (left.size() != right.size() || left.getMaxScore() != right.getMaxScore())
+    {
+        return false;
+    }
+    for (uint16_t score = 0; score <= left.getMaxScore(); score++)
+    {
+        if (left.getBucketStart(score) != right.getBucketStart(score))
+        {
+            return false;
+        }
+    }
+    for (size_t rank = 0; rank < left.size(); rank++)
+    {
+        if (left.getIndex(rank) != right.getIndex(rank))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Generates blocked cells text, sorted by row or not
+ */
+std::string cellsText(uint16_t rows, uint16_t cols, size_t count, bool sorted)
+{
+    std::mt19937 generator(73);
+    std::vector<std::pair<int, int>> cells;
+    for (size_t cell = 0; cell < count; cell++)
+    {
+        cells.emplace_back(static_cast<int>(generator() % rows), static_cast<int>(generator() % cols));
+    }
+    if (sorted)
+    {
+        std::sort(cells.begin(), cells.end());
+    }
+    std::string text = "# generated\n";
+    for (const auto &[row, col] : cells)
+    {
+        text += std::to_string(row) + "," + std::to_string(col) + "\n";
+    }
+    return text;
+}
+} // namespace
+
+/**
+ * @brief Tests the bounded queue
+ */
+void testBoundedQueue()
+{
+    std::cout << "Testing bounded queue..." << std::endl;
+
+    BoundedQueue<int> queue(2);
+    const bool first = queue.tryPush(1);
+    const bool second = queue.tryPush(2);
+    const bool full = queue.tryPush(3);
+    assert(first && second && !full);
+
+    // A blocked producer resumes once the consumer pops
+    std::thread producer([&queue] {
+        for (int item = 3; item <= 100; item++)
+        {
+            queue.push(item);
+        }
+        queue.close();
+    });
+    int expected = 1;
+    int item = 0;
+    while (queue.pop(item))
+    {
+        assert(item == expected);
+        expected++;
+    }
+    producer.join();
+    assert(expected == 101);
+
+    const bool pushedAfterClose = queue.push(1);
+    const bool poppedAfterClose = queue.pop(item);
+    assert(!pushedAfterClose && !poppedAfterClose);
+
+    std::cout << "✓ Bounded queue test passed" << std::endl;
+}
+
+/**
+ * @brief Tests rankings built from band-by-band scores
+ */
+void testPrescoredRanking()
+{
+    std::cout << "Testing prescored rankings..." << std::endl;
+
+    // Large enough for the regular build to use several bands
+    MatrixWorld world(300, 260);
+    std::mt19937 generator(73);
+    for (int cell = 0; cell < 20000; cell++)
+    {
+        world.setCell(static_cast<uint16_t>(generator() % 300), static_cast<uint16_t>(generator() % 260), true);
+    }
+
+    for (const StartScoringWeights &weights : {StartScoringWeights{}, StartScoringWeights::openArea()})
+    {
+        for (uint16_t band : {uint16_t{1}, uint16_t{7}, uint16_t{300}})
+        {
+            DegreeScores scores(world);
+            for (uint16_t row = band; scores.getScoredRows() < 300; row = std::min<uint16_t>(300, row + band))
+            {
+                scores.scoreRows(world, row);
+            }
+            CandidateRanking prescored(world, std::move(scores), weights, StartPruning::Symmetry);
+            CandidateRanking regular(world, weights, StartPruning::Symmetry);
+            assert(sameRanking(prescored, regular));
+        }
+    }
+
+    // Incomplete scores, or scores of another world, are rejected
+    MatrixWorld other(300, 261);
+    for (int attempt = 0; attempt < 3; attempt++)
+    {
+        DegreeScores scores(world);
+        bool exceptionThrown = false;
+        try
+        {
+            if (attempt == 0)
+            {
+                scores.scoreRows(world, 301);
+            }
+            else if (attempt == 1)
+            {
+                scores.scoreRows(world, 299);
+                CandidateRanking incomplete(world, std::move(scores));
+            }
+            else
+            {
+                scores.scoreRows(other, 10);
+            }
+        }
+        catch (const std::invalid_argument &)
+        {
+            exceptionThrown = true;
+        }
+        assert(exceptionThrown);
+    }
+
+    std::cout << "✓ Prescored rankings test passed" << std::endl;
+}
+
+/**
+ * @brief Tests sorted and unsorted cell streams
+ */
+void testCellsPipeline()
+{
+    std::cout << "Testing cells pipeline..." << std::endl;
+
+    const std::string sorted = cellsText(400, 300, 30000, true);
+    MatrixWorld expected(400, 300);
+    const size_t expectedCells = loadBlockedCells(sorted, expected, 1);
+    assert(expectedCells == 30000);
+
+    for (size_t chunkBytes : {size_t{64}, size_t{256} << 10})
+    {
+        MatrixWorld world(400, 300);
+        PipelineOptions options;
+        options.chunkBytes = chunkBytes;
+        options.queueDepth = 2;
+        PipelineResult result =
+            throughPipe(sorted, 1000, [&](int fd) { return loadWorldPipelined(fd, world, StreamFormat::Cells, options); });
+        assert(result.items == 30000 && result.chunks != 0);
+        assert(sameWorld(world, expected));
+
+        // The seeded ranking is current and served to the first query
+        assert(result.ranking && result.ranking->getWorldVersion() == world.getVersion());
+        assert(CandidateRanking::getShared(world, {}, StartPruning::Symmetry) == result.ranking);
+        assert(sameRanking(*result.ranking, CandidateRanking(world, {}, StartPruning::Symmetry)));
+    }
+
+    // Going back to scored rows abandons the overlapped scores, not the load
+    const std::string unsorted = cellsText(400, 300, 30000, false);
+    MatrixWorld unsortedExpected(400, 300);
+    UNUSED(loadBlockedCells(unsorted, unsortedExpected, 1));
+    MatrixWorld world(400, 300);
+    PipelineOptions options;
+    options.chunkBytes = 64;
+    PipelineResult result =
+        throughPipe(unsorted, 512, [&](int fd) { return loadWorldPipelined(fd, world, StreamFormat::Cells, options); });
+    assert(result.items == 30000 && !result.ranking);
+    assert(sameWorld(world, unsortedExpected));
+
+    // Errors name the line; earlier cells stay blocked
+    MatrixWorld small(4, 4);
+    std::string message;
+    try
+    {
+        UNUSED(throughPipe("0,1\n# c\n1,9\n", 3,
+                           [&](int fd) { return loadWorldPipelined(fd, small, StreamFormat::Cells); }));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        message = e.what();
+    }
+    assert(message.find("outside the matrix at line 3") != std::string::npos);
+    assert(!small.isUnblocked(0, 1));
+
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(loadWorldPipelined(STDIN_FILENO, small, StreamFormat::Image));
+    }
+    catch (const std::invalid_argument &)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ Cells pipeline test passed" << std::endl;
+}
+
+/**
+ * @brief Tests packed row streams
+ */
+void testRowsPipeline()
+{
+    std::cout << "Testing rows pipeline..." << std::endl;
+
+    const uint16_t rows = 300;
+    const uint16_t cols = 250;
+    MatrixWorld expected(rows, cols);
+    std::mt19937_64 generator(73);
+    std::vector<uint64_t> mask(rows * expected.getWordsPerRow());
+    for (uint64_t &word : mask)
+    {
+        word = generator() & generator() & generator();
+    }
+    const bool applied = expected.matrixBlankingMask(mask);
+    assert(applied);
+
+    std::string data(mask.size() * sizeof(uint64_t), '\0');
+    for (size_t word = 0; word < mask.size(); word++)
+    {
+        for (size_t byte = 0; byte < sizeof(uint64_t); byte++)
+        {
+            data[(word * sizeof(uint64_t)) + byte] = static_cast<char>(mask[word] >> (8 * byte));
+        }
+    }
+
+    MatrixWorld world(rows, cols);
+    PipelineOptions options;
+    options.chunkBytes = 100; // Rows split across chunks
+    options.weights = StartScoringWeights::openArea();
+    options.pruning = StartPruning::None;
+    PipelineResult result =
+        throughPipe(data, 777, [&](int fd) { return loadWorldPipelined(fd, world, StreamFormat::Rows, options); });
+    assert(result.items == rows && sameWorld(world, expected));
+    assert(result.ranking && sameRanking(*result.ranking, CandidateRanking(world, options.weights)));
+
+    // A partial row or an extra row is rejected
+    for (const std::string &bad : {data.substr(0, 20), data + std::string(32, '\0')})
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            MatrixWorld target(rows, cols);
+            UNUSED(throughPipe(bad, 64, [&](int fd) { return loadWorldPipelined(fd, target, StreamFormat::Rows); }));
+        }
+        catch (const std::invalid_argument &)
+        {
+            exceptionThrown = true;
+        }
+        assert(exceptionThrown);
+    }
+
+    std::cout << "✓ Rows pipeline test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the pipelined loader
+ */
+int main()
+{
+    std::cout << "=== World Pipeline Test Suite ===" << std::endl;
+
+    try
+    {
+        testBoundedQueue();
+        testPrescoredRanking();
+        testCellsPipeline();
+        testRowsPipeline();
+
+        std::cout << "\n✅ All World Pipeline tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
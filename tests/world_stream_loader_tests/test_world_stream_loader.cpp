@@ -0,0 +1,292 @@
+/**
+ * @file test_world_stream_loader.cpp
+ * @brief Unit tests for the incremental stream loaders
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Cell, row and image streams split at arbitrary points match the
+ *   whole-buffer loaders
+ * - Malformed, truncated and oversized streams are rejected
+ * - Stream format names
+ */
+
+#include "../test_main.hpp"
+#include "blocked_cells_loader.hpp"
+#include "world_stream_loader.hpp"
+#include <cassert>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+/**
+ * @brief Runs a loader on the read end of a pipe fed with data in small pieces
+ * @param data Bytes written by the producer thread
+ * @param piece Bytes per write()
+ * @param loader Callable taking the read descriptor
+ * @return Result of the loader
+ */
+template <typename Loader>
+auto throughPipe(const std::string &data, size_t piece, Loader loader)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        throw std::runtime_error("Can not create pipe");
+    }
+    std::thread producer([&data, piece, writeFd = fds[1]]() {
+        for (size_t offset = 0; offset < data.size(); offset += piece)
+        {
+            if (write(writeFd, data.data() + offset, std::min(piece, data.size() - offset)) < 0)
+            {
+                break; // Reader gave up
+            }
+        }
+        close(writeFd);
+    });
+
+    struct Closer
+    {
+        int fd;
+        std::thread &producer;
+        ~Closer()
+        {
+            close(fd);
+            producer.join();
+        }
+    } closer{fds[0], producer};
+    return loader(fds[0]);
+}
+
+/**
+ * @brief Checks that two worlds hold the same cells
+ */
+void assertSameWorld(const MatrixWorld &left, const MatrixWorld &right)
+{
+    assert(left.getColSize() == right.getColSize());
+    assert(left.getRowSize() == right.getRowSize());
+    assert(left.getNoOfBlockedCells() == right.getNoOfBlockedCells());
+    for (uint16_t row = 0; row < left.getColSize(); row++)
+    {
+        for (size_t word = 0; word < left.getWordsPerRow(); word++)
+        {
+            assert(left.getRowWords(row)[word] == right.getRowWords(row)[word]);
+        }
+    }
+}
+
+/**
+ * @brief Tests a blocked cells stream
+ */
+void testCellsStream()
+{
+    std::cout << "Testing cells stream..." << std::endl;
+
+    std::mt19937 generator(69);
+    std::uniform_int_distribution<int> rowDistribution(0, 99);
+    std::uniform_int_distribution<int> colDistribution(0, 129);
+    std::string text = "# generated\r\n\n";
+    for (int cell = 0; cell < 3000; cell++)
+    {
+        text += std::to_string(rowDistribution(generator)) + " , " + std::to_string(colDistribution(generator)) +
+                (cell % 3 == 0 ? "\r\n" : "\n");
+    }
+    text += "7,7"; // No final newline
+
+    MatrixWorld expected(100, 130);
+    assert(loadBlockedCells(text, expected, 1) == 3001);
+    for (size_t piece : {size_t{5}, size_t{4096}})
+    {
+        MatrixWorld streamed(100, 130);
+        size_t cells = throughPipe(text, piece, [&](int fd) {
+            return streamBlockedCells(fd, streamed, StreamFormat::Cells);
+        });
+        assert(cells == 3001);
+        assertSameWorld(streamed, expected);
+    }
+
+    // Errors name the line; earlier cells stay blocked
+    MatrixWorld world(4, 4);
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(throughPipe("0,1\n# c\n1,9\n", 3,
+                           [&](int fd) { return streamBlockedCells(fd, world, StreamFormat::Cells); }));
+    }
+    catch (const std::invalid_argument &e)
+    {
+        exceptionThrown = std::string(e.what()).find("outside the matrix at line 3") != std::string::npos;
+    }
+    assert(exceptionThrown);
+    assert(!world.isUnblocked(0, 1));
+
+    std::cout << "✓ Cells stream test passed" << std::endl;
+}
+
+/**
+ * @brief Tests a packed rows stream
+ */
+void testRowsStream()
+{
+    std::cout << "Testing rows stream..." << std::endl;
+
+    const uint16_t rows = 50;
+    const uint16_t cols = 70;
+    MatrixWorld expected(rows, cols);
+    std::mt19937_64 generator(69);
+    std::vector<uint64_t> mask(rows * expected.getWordsPerRow());
+    for (uint64_t &word : mask)
+    {
+        word = generator() & generator();
+    }
+    assert(expected.matrixBlankingMask(mask));
+
+    std::string data(mask.size() * sizeof(uint64_t), '\0');
+    for (size_t word = 0; word < mask.size(); word++)
+    {
+        for (size_t byte = 0; byte < sizeof(uint64_t); byte++)
+        {
+            data[(word * sizeof(uint64_t)) + byte] = static_cast<char>(mask[word] >> (8 * byte));
+        }
+    }
+
+    MatrixWorld streamed(rows, cols);
+    size_t streamedRows =
+        throughPipe(data, 13, [&](int fd) { return streamBlockedCells(fd, streamed, StreamFormat::Rows); });
+    assert(streamedRows == rows);
+    assertSameWorld(streamed, expected);
+
+    // Fewer rows are fine, a partial row or an extra row is not
+    MatrixWorld partial(rows, cols);
+    assert(throughPipe(data.substr(0, 32), 32,
+                       [&](int fd) { return streamBlockedCells(fd, partial, StreamFormat::Rows); }) == 2);
+    for (const std::string &bad : {data.substr(0, 20), data + std::string(16, '\0')})
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            MatrixWorld world(rows, cols);
+            UNUSED(throughPipe(bad, 64, [&](int fd) { return streamBlockedCells(fd, world, StreamFormat::Rows); }));
+        }
+        catch (const std::invalid_argument &)
+        {
+            exceptionThrown = true;
+        }
+        assert(exceptionThrown);
+    }
+
+    std::cout << "✓ Rows stream test passed" << std::endl;
+}
+
+/**
+ * @brief Tests an image stream
+ */
+void testImageStream()
+{
+    std::cout << "Testing image stream..." << std::endl;
+
+    std::string image = "P5\n# streamed\n300 40\n255\n";
+    std::mt19937 generator(69);
+    for (int pixel = 0; pixel < 300 * 40; pixel++)
+    {
+        image += static_cast<char>(generator() & 0xFF);
+    }
+
+    MatrixWorld expected = loadWorldImage(image, 0.3);
+    for (size_t piece : {size_t{3}, size_t{1000}, image.size()})
+    {
+        MatrixWorld streamed = throughPipe(image, piece, [](int fd) { return streamWorldImage(fd, 0.3); });
+        assertSameWorld(streamed, expected);
+    }
+
+    for (const std::string &bad : {image.substr(0, image.size() - 1), std::string("P5\n300 40\n"),
+                                   std::string("P6\n1 1\n255\n\x01")})
+    {
+        bool exceptionThrown = false;
+        try
+        {
+            UNUSED(throughPipe(bad, 7, [](int fd) { return streamWorldImage(fd); }));
+        }
+        catch (const std::invalid_argument &)
+        {
+            exceptionThrown = true;
+        }
+        assert(exceptionThrown);
+    }
+
+    std::cout << "✓ Image stream test passed" << std::endl;
+}
+
+/**
+ * @brief Tests format names and misuse
+ */
+void testFormats()
+{
+    std::cout << "Testing stream formats..." << std::endl;
+
+    assert(parseStreamFormat("cells") == StreamFormat::Cells);
+    assert(parseStreamFormat("rows") == StreamFormat::Rows);
+    assert(parseStreamFormat("image") == StreamFormat::Image);
+
+    bool exceptionThrown = false;
+    try
+    {
+        UNUSED(parseStreamFormat("png"));
+    }
+    catch (const std::invalid_argument &)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    exceptionThrown = false;
+    try
+    {
+        MatrixWorld world(2, 2);
+        UNUSED(throughPipe("", 1, [&](int fd) { return streamBlockedCells(fd, world, StreamFormat::Image); }));
+    }
+    catch (const std::invalid_argument &)
+    {
+        exceptionThrown = true;
+    }
+    assert(exceptionThrown);
+
+    std::cout << "✓ Stream formats test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for the stream loaders
+ */
+int main()
+{
+    std::cout << "=== World Stream Loader Test Suite ===" << std::endl;
+    std::signal(SIGPIPE, SIG_IGN); // Producers may outlive a rejected stream
+
+    try
+    {
+        testCellsStream();
+        testRowsStream();
+        testImageStream();
+        testFormats();
+
+        std::cout << "\n✅ All World Stream Loader tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,251 @@
+/**
+ * @file test_world_symmetry.cpp
+ * @brief Unit tests for world symmetry detection and orbit pruning
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Test suite validating:
+ * - Detected symmetries match a cell-by-cell check, also across word padding
+ * - Transformed paths stay valid
+ * - Pruned rankings keep one start per orbit and DFS still finds paths
+ */
+
+#include "../test_main.hpp"
+#include "candidate_ranking.hpp"
+#include "dfs_algorithm.hpp"
+#include "path_validation.hpp"
+#include "world_symmetry.hpp"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <set>
+
+/// Every transform, in declaration order
+static const std::vector<CellTransform> ALL_TRANSFORMS = {
+    CellTransform::MirrorRows, CellTransform::MirrorCols, CellTransform::Rotate180, CellTransform::Rotate90,
+    CellTransform::Rotate270,  CellTransform::Transpose,  CellTransform::AntiTranspose};
+
+/**
+ * @brief Checks a transform cell by cell
+ * @param world World to check
+ * @param transform Transform to check
+ * @return true if the transform maps the world onto itself
+ */
+static bool isSymmetricUnder(const MatrixWorld &world, CellTransform transform)
+{
+    const uint16_t rows = world.getColSize();
+    const uint16_t cols = world.getRowSize();
+    bool square = rows == cols;
+    if (!square && transform != CellTransform::MirrorRows && transform != CellTransform::MirrorCols &&
+        transform != CellTransform::Rotate180)
+    {
+        return false;
+    }
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (uint16_t col = 0; col < cols; col++)
+        {
+            auto [imageRow, imageCol] = applyTransform(transform, {row, col}, rows, cols);
+            if (world.isUnblocked(row, col) != world.isUnblocked(imageRow, imageCol))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Builds a random world made symmetric under the given transforms
+ * @param rows Number of rows
+ * @param cols Number of columns
+ * @param transforms Transforms whose orbits get a common state
+ * @param seed Random seed
+ * @param density Probability of blocking the orbit of a cell
+ */
+static MatrixWorld makeSymmetricWorld(uint16_t rows, uint16_t cols, const std::vector<CellTransform> &transforms,
+                                      unsigned seed, double density = 0.3)
+{
+    MatrixWorld world(rows, cols);
+    std::mt19937 generator(seed);
+    std::bernoulli_distribution isBlocked(density);
+    for (uint16_t row = 0; row < rows; row++)
+    {
+        for (uint16_t col = 0; col < cols; col++)
+        {
+            if (!isBlocked(generator))
+            {
+                continue;
+            }
+            // Block the whole orbit (closure under repeated application)
+            std::vector<std::pair<uint16_t, uint16_t>> pending = {{row, col}};
+            while (!pending.empty())
+            {
+                auto cell = pending.back();
+                pending.pop_back();
+                if (!world.isUnblocked(cell.first, cell.second))
+                {
+                    continue;
+                }
+                world.setCell(cell.first, cell.second, true);
+                for (CellTransform transform : transforms)
+                {
+                    pending.push_back(applyTransform(transform, cell, rows, cols));
+                }
+            }
+        }
+    }
+    return world;
+}
+
+/**
+ * @brief Tests detection against the cell-by-cell check
+ */
+void testDetection()
+{
+    std::cout << "Testing symmetry detection..." << std::endl;
+
+    const std::vector<std::vector<CellTransform>> generators = {
+        {},
+        {CellTransform::MirrorRows},
+        {CellTransform::MirrorCols},
+        {CellTransform::Rotate180},
+        {CellTransform::Rotate90},
+        {CellTransform::Transpose},
+        {CellTransform::AntiTranspose},
+        {CellTransform::Rotate90, CellTransform::MirrorCols}};
+    const std::vector<std::pair<uint16_t, uint16_t>> sizes = {{7, 7}, {64, 64}, {70, 70}, {9, 130}, {1, 1}};
+
+    unsigned seed = 64;
+    for (const auto &size : sizes)
+    {
+        for (const auto &transforms : generators)
+        {
+            bool square = size.first == size.second;
+            bool needsSquare = std::any_of(transforms.begin(), transforms.end(), [](CellTransform transform) {
+                return transform == CellTransform::Rotate90 || transform == CellTransform::Transpose ||
+                       transform == CellTransform::AntiTranspose;
+            });
+            if (needsSquare && !square)
+            {
+                continue;
+            }
+
+            MatrixWorld world = makeSymmetricWorld(size.first, size.second, transforms, seed++);
+            std::vector<CellTransform> detected = detectSymmetries(world);
+            for (CellTransform transform : ALL_TRANSFORMS)
+            {
+                bool found = std::find(detected.begin(), detected.end(), transform) != detected.end();
+                assert(found == isSymmetricUnder(world, transform));
+            }
+            for (CellTransform transform : transforms)
+            {
+                assert(std::find(detected.begin(), detected.end(), transform) != detected.end());
+            }
+        }
+    }
+
+    // An open world has every symmetry of its shape
+    assert(detectSymmetries(MatrixWorld(6, 6)).size() == ALL_TRANSFORMS.size());
+    assert(detectSymmetries(MatrixWorld(6, 9)).size() == 3);
+
+    std::cout << "✓ Symmetry detection test passed" << std::endl;
+}
+
+/**
+ * @brief Tests that transformed paths stay valid
+ */
+void testTransformPath()
+{
+    std::cout << "Testing path transforms..." << std::endl;
+
+    MatrixWorld world = makeSymmetricWorld(12, 12, {CellTransform::Rotate90, CellTransform::MirrorCols}, 7, 0.1);
+    DFSAlgorithm dfs;
+    Path path = dfs.findViablePath(world, {15});
+    assert(path.getLength() == 15);
+
+    for (CellTransform transform : detectSymmetries(world))
+    {
+        Path image = transformPath(transform, path, 12, 12);
+        assert(image.getLength() == 15);
+        assert(isViablePath(world, image, {15}));
+    }
+
+    std::cout << "✓ Path transforms test passed" << std::endl;
+}
+
+/**
+ * @brief Tests one candidate per orbit in pruned rankings
+ */
+void testPrunedRanking()
+{
+    std::cout << "Testing pruned ranking..." << std::endl;
+
+    // Open 4x4: centre, edge and corner orbits
+    MatrixWorld open(4, 4);
+    auto pruned = CandidateRanking::getShared(open, {}, StartPruning::Symmetry);
+    assert(pruned->size() == 3);
+    assert((pruned->getCell(0) == std::pair<uint16_t, uint16_t>{1, 1}));
+    assert((pruned->getCell(1) == std::pair<uint16_t, uint16_t>{0, 1}));
+    assert((pruned->getCell(2) == std::pair<uint16_t, uint16_t>{0, 0}));
+    assert(pruned->getBucketStart(4) == 0);
+    assert(pruned->getBucketStart(3) == 1);
+    assert(pruned->getBucketStart(2) == 2);
+
+    // Every free cell is the image of exactly one kept candidate
+    MatrixWorld world = makeSymmetricWorld(20, 20, {CellTransform::Rotate90}, 11);
+    auto ranking = CandidateRanking::getShared(world, {}, StartPruning::Symmetry);
+    auto full = CandidateRanking::getShared(world);
+    assert(ranking->getPruning() == StartPruning::Symmetry);
+    assert(ranking != full);
+    assert(ranking->getCell(0) == full->getCell(0));
+    std::vector<CellTransform> symmetries = detectSymmetries(world);
+    std::set<std::pair<uint16_t, uint16_t>> covered;
+    for (size_t rank = 0; rank < ranking->size(); rank++)
+    {
+        auto cell = ranking->getCell(rank);
+        covered.insert(cell);
+        for (CellTransform transform : symmetries)
+        {
+            covered.insert(applyTransform(transform, cell, 20, 20));
+        }
+    }
+    assert(covered.size() == world.getNoOfUnblockedCells());
+
+    // Asymmetric worlds keep every candidate
+    MatrixWorld asymmetric(5, 6);
+    asymmetric.setCell(0, 0, true);
+    assert(CandidateRanking::getShared(asymmetric, {}, StartPruning::Symmetry)->size() == 29);
+
+    std::cout << "✓ Pruned ranking test passed" << std::endl;
+}
+
+/**
+ * @brief Main test runner for world symmetry
+ */
+int main()
+{
+    std::cout << "=== World Symmetry Test Suite ===" << std::endl;
+
+    try
+    {
+        testDetection();
+        testTransformPath();
+        testPrunedRanking();
+
+        std::cout << "\n✅ All World Symmetry tests passed successfully!" << std::endl;
+        return 0;
+    }
+    catch (const std::exception &e)
+    {
+        std::cout << "\n❌ Test failed with exception: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (...)
+    {
+        std::cout << "\n❌ Test failed with unknown exception" << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,248 @@
+/**
+ * @file path_load_generator.cpp
+ * @brief Load generator for the path service
+ * @author Slepotek
+ * @date October 2026
+ * @version 1.0
+ *
+ * Loads one world into a running service (pathFinder --serve), then runs
+ * concurrent clients issuing queries back to back and reports throughput,
+ * latency percentiles (nearest rank, client side round trip) and the count
+ * of every response status.
+ */
+
+#include "path_client.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/**
+ * @struct LoadOptions
+ * @brief Command line of the load generator
+ */
+struct LoadOptions
+{
+    std::string socketPath;                  ///< Service socket
+    std::string world = "100x100";           ///< World reference loaded as "load"
+    PathLength pathLength{50};               ///< Requested length
+    std::string algorithm = "dfs";           ///< Engine name
+    MaxStartingPoints maxStartingPoints;     ///< Starting points limit
+    uint32_t clients = 4;                    ///< Concurrent connections
+    uint32_t requests = 1000;                ///< Queries per client
+    uint32_t deadlineMillis = 0;             ///< Per-query deadline (0 = none)
+};
+
+void printUsage()
+{
+    std::cout << R"(pathLoadGen - Load generator for pathFinder --serve
+
+USAGE:
+    pathLoadGen --socket PATH [OPTIONS]
+
+OPTIONS:
+    --world REF             World reference loaded by the service (default: 100x100)
+    --pathLength N          Requested path length (default: 50)
+    --algorithm NAME        Engine of every query (default: dfs)
+    --maxStartingPoints N   Starting points limit (default: 5)
+    --clients N             Concurrent connections (default: 4)
+    --requests N            Queries per connection (default: 1000)
+    --deadline MS           Per-query deadline in milliseconds (default: 0 = none)
+)" << std::endl;
+}
+
+template <typename Unsigned> Unsigned parseNumber(const std::string &text, const std::string &flag)
+{
+    Unsigned value = 0;
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc{} || end != text.data() + text.size())
+    {
+        throw std::invalid_argument("Invalid value for " + flag + ": " + text);
+    }
+    return value;
+}
+
+LoadOptions parseOptions(int argc, char *argv[])
+{
+    LoadOptions options;
+    for (int index = 1; index < argc; index++)
+    {
+        const std::string flag = argv[index];
+        if (flag == "--help" || flag == "-h")
+        {
+            printUsage();
+            std::exit(0);
+        }
+        if (index + 1 >= argc)
+        {
+            throw std::invalid_argument("Missing value for " + flag);
+        }
+        const std::string value = argv[++index];
+        if (flag == "--socket")
+        {
+            options.socketPath = value;
+        }
+        else if (flag == "--world")
+        {
+            options.world = value;
+        }
+        else if (flag == "--pathLength")
+        {
+            options.pathLength.value = parseNumber<uint16_t>(value, flag);
+        }
+        else if (flag == "--algorithm")
+        {
+            options.algorithm = value;
+        }
+        else if (flag == "--maxStartingPoints")
+        {
+            options.maxStartingPoints.value = parseNumber<uint16_t>(value, flag);
+        }
+        else if (flag == "--clients")
+        {
+            options.clients = std::max(1U, parseNumber<uint32_t>(value, flag));
+        }
+        else if (flag == "--requests")
+        {
+            options.requests = parseNumber<uint32_t>(value, flag);
+        }
+        else if (flag == "--deadline")
+        {
+            options.deadlineMillis = parseNumber<uint32_t>(value, flag);
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown option " + flag);
+        }
+    }
+    if (options.socketPath.empty())
+    {
+        throw std::invalid_argument("--socket is required");
+    }
+    return options;
+}
+} // namespace
+
+/**
+ * @brief Runs the load and prints the report
+ * @return 0 on success, 1 if the service could not be reached or the world not loaded
+ */
+int main(int argc, char *argv[])
+{
+    LoadOptions options;
+    try
+    {
+        options = parseOptions(argc, argv);
+        PathClient setup(options.socketPath);
+        ServiceResponse loaded = setup.loadWorld("load", options.world);
+        if (loaded.status != ResponseStatus::Ok)
+        {
+            std::cerr << "Error: " << loaded.message << std::endl;
+            return 1;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::mutex reportMutex;
+    std::vector<double> latencies;
+    std::map<std::string, size_t> statusCounts;
+    size_t failedClients = 0;
+    std::string firstError;
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> clients;
+    for (uint32_t client = 0; client < options.clients; client++)
+    {
+        clients.emplace_back([&]() {
+            std::vector<double> clientLatencies;
+            std::map<std::string, size_t> clientCounts;
+            std::string clientError;
+            bool failed = false;
+            try
+            {
+                PathClient connection(options.socketPath);
+                clientLatencies.reserve(options.requests);
+                for (uint32_t request = 0; request < options.requests; request++)
+                {
+                    auto sent = std::chrono::steady_clock::now();
+                    ServiceResponse response = connection.queryPath("load", options.pathLength, options.algorithm,
+                                                                    options.maxStartingPoints, options.deadlineMillis);
+                    auto answered = std::chrono::steady_clock::now();
+                    clientLatencies.push_back(std::chrono::duration<double, std::micro>(answered - sent).count());
+                    clientCounts[responseStatusName(response.status)]++;
+                    if (response.status == ResponseStatus::Error && clientError.empty())
+                    {
+                        clientError = response.message;
+                    }
+                }
+            }
+            catch (const std::exception &e)
+            {
+                failed = true;
+                clientError = e.what();
+            }
+
+            std::lock_guard<std::mutex> lock(reportMutex);
+            latencies.insert(latencies.end(), clientLatencies.begin(), clientLatencies.end());
+            for (const auto &[status, count] : clientCounts)
+            {
+                statusCounts[status] += count;
+            }
+            failedClients += failed ? 1 : 0;
+            if (firstError.empty())
+            {
+                firstError = clientError;
+            }
+        });
+    }
+    for (auto &client : clients)
+    {
+        client.join();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double fraction) {
+        if (latencies.empty())
+        {
+            return 0.0;
+        }
+        const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(latencies.size())));
+        return latencies[std::max<size_t>(rank, 1) - 1];
+    };
+
+    std::cout << "Clients: " << options.clients << std::endl;
+    std::cout << "Queries: " << latencies.size() << std::endl;
+    std::cout << "Seconds: " << seconds << std::endl;
+    std::cout << "Queries/s: " << (seconds > 0.0 ? static_cast<double>(latencies.size()) / seconds : 0.0)
+              << std::endl;
+    std::cout << "Latency p50/p90/p99/max (us): " << percentile(0.50) << " / " << percentile(0.90) << " / "
+              << percentile(0.99) << " / " << (latencies.empty() ? 0.0 : latencies.back()) << std::endl;
+    for (const auto &[status, count] : statusCounts)
+    {
+        std::cout << "Status " << status << ": " << count << std::endl;
+    }
+    if (failedClients != 0)
+    {
+        std::cout << "Failed clients: " << failedClients << std::endl;
+    }
+    if (!firstError.empty())
+    {
+        std::cout << "First error: " << firstError << std::endl;
+    }
+    return failedClients == 0 ? 0 : 1;
+}